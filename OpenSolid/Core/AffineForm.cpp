@@ -0,0 +1,377 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#include <OpenSolid/Core/AffineForm.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace opensolid
+{
+    namespace
+    {
+        bool
+        isBounded(Interval interval) {
+            return (
+                std::abs(interval.lowerBound()) < std::numeric_limits<double>::infinity() &&
+                std::abs(interval.upperBound()) < std::numeric_limits<double>::infinity()
+            );
+        }
+
+        // Compute slope * affineForm + offset, with the given additional error
+        AffineForm
+        linearized(const AffineForm& affineForm, double slope, double offset, double error) {
+            std::array<double, AffineForm::NUM_SYMBOLS> coefficients;
+            for (int symbolIndex = 0; symbolIndex < AffineForm::NUM_SYMBOLS; ++symbolIndex) {
+                coefficients[symbolIndex] = slope * affineForm.coefficient(symbolIndex);
+            }
+            return AffineForm(
+                slope * affineForm.center() + offset,
+                coefficients,
+                std::abs(slope) * affineForm.error() + error
+            );
+        }
+
+        // Best (Chebyshev) linear approximation of a function that is either convex or concave
+        // over the given bounds: the slope is that of the secant between the two endpoints,
+        // and the offset is halfway between the secant and the parallel tangent line. The
+        // inverse derivative function must return the point at which the derivative of the
+        // function is equal to the given slope.
+        template <class TFunction, class TInverseDerivative>
+        AffineForm
+        secantApproximation(
+            const AffineForm& affineForm,
+            Interval bounds,
+            TFunction function,
+            TInverseDerivative inverseDerivative
+        ) {
+            double lowerBound = bounds.lowerBound();
+            double upperBound = bounds.upperBound();
+            double lowerValue = function(lowerBound);
+            double upperValue = function(upperBound);
+            if (!(upperBound > lowerBound)) {
+                return AffineForm(Interval::hull(lowerValue, upperValue));
+            }
+            double slope = (upperValue - lowerValue) / (upperBound - lowerBound);
+            double tangentPoint = std::min(
+                std::max(inverseDerivative(slope), lowerBound),
+                upperBound
+            );
+            double secantOffset = lowerValue - slope * lowerBound;
+            double tangentOffset = function(tangentPoint) - slope * tangentPoint;
+            return linearized(
+                affineForm,
+                slope,
+                0.5 * (secantOffset + tangentOffset),
+                0.5 * std::abs(secantOffset - tangentOffset)
+            );
+        }
+
+        // First-order Taylor expansion about the center, with the remainder bounded using an
+        // interval enclosure of the second derivative over the given bounds
+        AffineForm
+        taylorApproximation(
+            const AffineForm& affineForm,
+            double value,
+            double derivative,
+            Interval secondDerivativeBounds
+        ) {
+            double radius = affineForm.radius();
+            Interval remainder = 0.5 * secondDerivativeBounds * Interval(0.0, radius * radius);
+            if (!isBounded(remainder)) {
+                return AffineForm(Interval::WHOLE());
+            }
+            return linearized(
+                affineForm,
+                derivative,
+                value - derivative * affineForm.center() + remainder.median(),
+                0.5 * remainder.width()
+            );
+        }
+
+        AffineForm
+        reciprocal(const AffineForm& affineForm) {
+            Interval bounds = affineForm.bounds();
+            if (!isBounded(bounds) || bounds.contains(0.0, 0.0)) {
+                return AffineForm(1.0 / bounds);
+            }
+            double sign = bounds.lowerBound() > 0.0 ? 1.0 : -1.0;
+            return secantApproximation(
+                affineForm,
+                bounds,
+                [] (double value) {
+                    return 1.0 / value;
+                },
+                [sign] (double slope) {
+                    return sign * std::sqrt(-1.0 / slope);
+                }
+            );
+        }
+    }
+
+    AffineForm
+    AffineForm::squared() const {
+        Interval bounds = this->bounds();
+        if (!isBounded(bounds)) {
+            return AffineForm(bounds.squared());
+        }
+        return secantApproximation(
+            *this,
+            bounds,
+            [] (double value) {
+                return value * value;
+            },
+            [] (double slope) {
+                return 0.5 * slope;
+            }
+        );
+    }
+
+    AffineForm
+    operator/(const AffineForm& firstAffineForm, const AffineForm& secondAffineForm) {
+        return firstAffineForm * reciprocal(secondAffineForm);
+    }
+
+    AffineForm
+    sqrt(const AffineForm& affineForm) {
+        Interval bounds = affineForm.bounds();
+        if (!isBounded(bounds) || !(bounds.lowerBound() >= 0.0)) {
+            return AffineForm(sqrt(bounds));
+        }
+        return secantApproximation(
+            affineForm,
+            bounds,
+            [] (double value) {
+                return std::sqrt(value);
+            },
+            [] (double slope) {
+                return 0.25 / (slope * slope);
+            }
+        );
+    }
+
+    AffineForm
+    sin(const AffineForm& affineForm) {
+        Interval bounds = affineForm.bounds();
+        if (!isBounded(bounds)) {
+            return AffineForm(sin(bounds));
+        }
+        double center = affineForm.center();
+        return taylorApproximation(affineForm, std::sin(center), std::cos(center), -sin(bounds));
+    }
+
+    AffineForm
+    cos(const AffineForm& affineForm) {
+        Interval bounds = affineForm.bounds();
+        if (!isBounded(bounds)) {
+            return AffineForm(cos(bounds));
+        }
+        double center = affineForm.center();
+        return taylorApproximation(affineForm, std::cos(center), -std::sin(center), -cos(bounds));
+    }
+
+    AffineForm
+    tan(const AffineForm& affineForm) {
+        Interval bounds = affineForm.bounds();
+        Interval tangentBounds = tan(bounds);
+        if (!isBounded(bounds) || !isBounded(tangentBounds)) {
+            return AffineForm(tangentBounds);
+        }
+        double tangent = std::tan(affineForm.center());
+        Interval secondDerivativeBounds = 2.0 * tangentBounds * (1.0 + tangentBounds.squared());
+        return taylorApproximation(
+            affineForm,
+            tangent,
+            1.0 + tangent * tangent,
+            secondDerivativeBounds
+        );
+    }
+
+    AffineForm
+    asin(const AffineForm& affineForm) {
+        // Arguments not strictly within the domain are clamped to it, as for the interval
+        // version (see detail::arcsine()), losing any correlation information
+        Interval bounds = affineForm.bounds();
+        if (!(bounds.lowerBound() > -1.0 && bounds.upperBound() < 1.0)) {
+            return AffineForm(asin(bounds.intersection(Interval(-1.0, 1.0))));
+        }
+        if (bounds.lowerBound() >= 0.0 || bounds.upperBound() <= 0.0) {
+            // Convex for positive arguments, concave for negative ones
+            double sign = bounds.lowerBound() >= 0.0 ? 1.0 : -1.0;
+            return secantApproximation(
+                affineForm,
+                bounds,
+                [] (double value) {
+                    return std::asin(value);
+                },
+                [sign] (double slope) {
+                    return sign * std::sqrt(std::max(0.0, 1.0 - 1.0 / (slope * slope)));
+                }
+            );
+        }
+        double center = affineForm.center();
+        Interval secondDerivativeBounds = bounds / pow(1.0 - bounds.squared(), 1.5);
+        return taylorApproximation(
+            affineForm,
+            std::asin(center),
+            1.0 / std::sqrt(1.0 - center * center),
+            secondDerivativeBounds
+        );
+    }
+
+    AffineForm
+    acos(const AffineForm& affineForm) {
+        return M_PI / 2.0 - asin(affineForm);
+    }
+
+    AffineForm
+    exp(const AffineForm& affineForm) {
+        Interval bounds = affineForm.bounds();
+        if (!isBounded(bounds)) {
+            return AffineForm(exp(bounds));
+        }
+        return secantApproximation(
+            affineForm,
+            bounds,
+            [] (double value) {
+                return std::exp(value);
+            },
+            [] (double slope) {
+                return std::log(slope);
+            }
+        );
+    }
+
+    AffineForm
+    log(const AffineForm& affineForm) {
+        Interval bounds = affineForm.bounds();
+        if (!isBounded(bounds) || !(bounds.lowerBound() > 0.0)) {
+            return AffineForm(log(bounds));
+        }
+        return secantApproximation(
+            affineForm,
+            bounds,
+            [] (double value) {
+                return std::log(value);
+            },
+            [] (double slope) {
+                return 1.0 / slope;
+            }
+        );
+    }
+
+    AffineForm
+    pow(const AffineForm& base, int exponent) {
+        if (exponent == 0) {
+            return AffineForm(1.0);
+        } else if (exponent == 1) {
+            return base;
+        } else if (exponent < 0) {
+            return reciprocal(pow(base, -exponent));
+        }
+        Interval bounds = base.bounds();
+        if (!isBounded(bounds)) {
+            return AffineForm(pow(bounds, double(exponent)));
+        }
+        auto function = [exponent] (double value) {
+            return std::pow(value, exponent);
+        };
+        double root = 1.0 / (exponent - 1);
+        if (exponent % 2 == 0) {
+            // Convex everywhere
+            return secantApproximation(
+                base,
+                bounds,
+                function,
+                [exponent, root] (double slope) {
+                    double magnitude = std::pow(std::abs(slope) / exponent, root);
+                    return slope < 0.0 ? -magnitude : magnitude;
+                }
+            );
+        } else if (bounds.lowerBound() >= 0.0 || bounds.upperBound() <= 0.0) {
+            // Odd powers are convex for positive arguments and concave for negative ones
+            double sign = bounds.lowerBound() >= 0.0 ? 1.0 : -1.0;
+            return secantApproximation(
+                base,
+                bounds,
+                function,
+                [exponent, root, sign] (double slope) {
+                    return sign * std::pow(slope / exponent, root);
+                }
+            );
+        } else {
+            // Second derivative n * (n - 1) * x^(n - 2) with n - 2 odd, so monotonic in x
+            double center = base.center();
+            Interval secondDerivativeBounds = exponent * (exponent - 1) * Interval(
+                std::pow(bounds.lowerBound(), exponent - 2),
+                std::pow(bounds.upperBound(), exponent - 2)
+            );
+            return taylorApproximation(
+                base,
+                function(center),
+                exponent * std::pow(center, exponent - 1),
+                secondDerivativeBounds
+            );
+        }
+    }
+
+    AffineForm
+    pow(const AffineForm& base, double exponent) {
+        if (exponent == std::floor(exponent) && std::abs(exponent) <= 64) {
+            return pow(base, int(exponent));
+        }
+        Interval bounds = base.bounds();
+        if (!isBounded(bounds) || !(bounds.lowerBound() > 0.0)) {
+            return AffineForm(pow(bounds, exponent));
+        }
+        // Convex for exponents less than zero or greater than one, concave otherwise
+        double root = 1.0 / (exponent - 1.0);
+        return secantApproximation(
+            base,
+            bounds,
+            [exponent] (double value) {
+                return std::pow(value, exponent);
+            },
+            [exponent, root] (double slope) {
+                return std::pow(slope / exponent, root);
+            }
+        );
+    }
+
+    AffineForm
+    pow(const AffineForm& base, const AffineForm& exponent) {
+        return exp(exponent * log(base));
+    }
+
+    std::ostream&
+    operator<<(std::ostream& stream, const AffineForm& affineForm) {
+        stream << "AffineForm(" << affineForm.center();
+        for (int symbolIndex = 0; symbolIndex < AffineForm::NUM_SYMBOLS; ++symbolIndex) {
+            stream << "," << affineForm.coefficient(symbolIndex);
+        }
+        stream << "," << affineForm.error() << ")";
+        return stream;
+    }
+}
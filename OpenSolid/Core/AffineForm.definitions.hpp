@@ -0,0 +1,160 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#pragma once
+
+#include <OpenSolid/config.hpp>
+
+#include <OpenSolid/Core/AffineForm.declarations.hpp>
+
+#include <OpenSolid/Core/Interval.declarations.hpp>
+#include <OpenSolid/Core/Zero.declarations.hpp>
+
+#include <array>
+#include <ostream>
+
+namespace opensolid
+{
+    // A scalar value represented in reduced affine arithmetic: a center value plus a linear
+    // combination of noise symbols (each ranging over [-1, 1]) plus an accumulated error term.
+    // Each noise symbol corresponds to one independent input quantity (for instance one
+    // parameter of an expression), so that correlations between intermediate values are
+    // tracked and cancel where they should; 't - t * t' evaluated over a small interval gives
+    // a much tighter enclosure than plain interval arithmetic, since both occurrences of 't'
+    // share the same noise symbol. Nonlinear operations are replaced by linear approximations
+    // with the approximation error added to the error term.
+    class AffineForm
+    {
+    public:
+        static const int NUM_SYMBOLS = 3;
+    private:
+        double _center;
+        std::array<double, NUM_SYMBOLS> _coefficients;
+        double _error;
+    public:
+        AffineForm();
+
+        AffineForm(double value);
+
+        // Interval with no known correlation to any other quantity (represented using only the
+        // error term)
+        explicit
+        AffineForm(Interval interval);
+
+        // Interval corresponding to the given noise symbol
+        AffineForm(Interval interval, int symbolIndex);
+
+        AffineForm(
+            double center,
+            const std::array<double, NUM_SYMBOLS>& coefficients,
+            double error
+        );
+
+        double
+        center() const;
+
+        double
+        coefficient(int symbolIndex) const;
+
+        double
+        error() const;
+
+        double
+        radius() const;
+
+        Interval
+        bounds() const;
+
+        OPENSOLID_CORE_EXPORT
+        AffineForm
+        squared() const;
+    };
+
+    bool
+    operator==(const AffineForm& affineForm, Zero zero);
+
+    AffineForm
+    operator-(const AffineForm& argument);
+
+    AffineForm
+    operator+(const AffineForm& firstAffineForm, const AffineForm& secondAffineForm);
+
+    AffineForm
+    operator-(const AffineForm& firstAffineForm, const AffineForm& secondAffineForm);
+
+    AffineForm
+    operator*(const AffineForm& firstAffineForm, const AffineForm& secondAffineForm);
+
+    OPENSOLID_CORE_EXPORT
+    AffineForm
+    operator/(const AffineForm& firstAffineForm, const AffineForm& secondAffineForm);
+
+    OPENSOLID_CORE_EXPORT
+    AffineForm
+    sqrt(const AffineForm& affineForm);
+
+    OPENSOLID_CORE_EXPORT
+    AffineForm
+    sin(const AffineForm& affineForm);
+
+    OPENSOLID_CORE_EXPORT
+    AffineForm
+    cos(const AffineForm& affineForm);
+
+    OPENSOLID_CORE_EXPORT
+    AffineForm
+    tan(const AffineForm& affineForm);
+
+    OPENSOLID_CORE_EXPORT
+    AffineForm
+    asin(const AffineForm& affineForm);
+
+    OPENSOLID_CORE_EXPORT
+    AffineForm
+    acos(const AffineForm& affineForm);
+
+    OPENSOLID_CORE_EXPORT
+    AffineForm
+    exp(const AffineForm& affineForm);
+
+    OPENSOLID_CORE_EXPORT
+    AffineForm
+    log(const AffineForm& affineForm);
+
+    OPENSOLID_CORE_EXPORT
+    AffineForm
+    pow(const AffineForm& base, int exponent);
+
+    OPENSOLID_CORE_EXPORT
+    AffineForm
+    pow(const AffineForm& base, double exponent);
+
+    OPENSOLID_CORE_EXPORT
+    AffineForm
+    pow(const AffineForm& base, const AffineForm& exponent);
+
+    OPENSOLID_CORE_EXPORT
+    std::ostream&
+    operator<<(std::ostream& stream, const AffineForm& affineForm);
+}
@@ -0,0 +1,195 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#pragma once
+
+#include <OpenSolid/config.hpp>
+
+#include <OpenSolid/Core/AffineForm.definitions.hpp>
+
+#include <OpenSolid/Core/Interval.hpp>
+#include <OpenSolid/Core/Zero.hpp>
+
+#include <cmath>
+#include <limits>
+
+namespace opensolid
+{
+    inline
+    AffineForm::AffineForm() :
+        _center(0.0),
+        _error(0.0) {
+
+        _coefficients.fill(0.0);
+    }
+
+    inline
+    AffineForm::AffineForm(double value) :
+        _center(value),
+        _error(0.0) {
+
+        _coefficients.fill(0.0);
+    }
+
+    inline
+    AffineForm::AffineForm(Interval interval) :
+        _center(interval.median()),
+        _error(0.5 * interval.width()) {
+
+        _coefficients.fill(0.0);
+        double infinity = std::numeric_limits<double>::infinity();
+        if (interval.lowerBound() == -infinity || interval.upperBound() == infinity) {
+            _center = 0.0;
+            _error = infinity;
+        }
+    }
+
+    inline
+    AffineForm::AffineForm(Interval interval, int symbolIndex) :
+        _center(interval.median()),
+        _error(0.0) {
+
+        assert(symbolIndex >= 0 && symbolIndex < NUM_SYMBOLS);
+        _coefficients.fill(0.0);
+        _coefficients[symbolIndex] = 0.5 * interval.width();
+    }
+
+    inline
+    AffineForm::AffineForm(
+        double center,
+        const std::array<double, NUM_SYMBOLS>& coefficients,
+        double error
+    ) : _center(center),
+        _coefficients(coefficients),
+        _error(error) {
+    }
+
+    inline
+    double
+    AffineForm::center() const {
+        return _center;
+    }
+
+    inline
+    double
+    AffineForm::coefficient(int symbolIndex) const {
+        return _coefficients[symbolIndex];
+    }
+
+    inline
+    double
+    AffineForm::error() const {
+        return _error;
+    }
+
+    inline
+    double
+    AffineForm::radius() const {
+        double result = _error;
+        for (int symbolIndex = 0; symbolIndex < NUM_SYMBOLS; ++symbolIndex) {
+            result += std::abs(_coefficients[symbolIndex]);
+        }
+        return result;
+    }
+
+    inline
+    Interval
+    AffineForm::bounds() const {
+        // Widen slightly to cover rounding error accumulated in the center and coefficients
+        double radius = this->radius();
+        radius += 4 * std::numeric_limits<double>::epsilon() * (std::abs(_center) + radius);
+        if (std::isnan(_center) || std::isnan(radius)) {
+            return Interval::EMPTY();
+        }
+        return Interval(_center - radius, _center + radius);
+    }
+
+    inline
+    bool
+    operator==(const AffineForm& affineForm, Zero zero) {
+        return affineForm.bounds() == zero;
+    }
+
+    inline
+    AffineForm
+    operator-(const AffineForm& argument) {
+        std::array<double, AffineForm::NUM_SYMBOLS> coefficients;
+        for (int symbolIndex = 0; symbolIndex < AffineForm::NUM_SYMBOLS; ++symbolIndex) {
+            coefficients[symbolIndex] = -argument.coefficient(symbolIndex);
+        }
+        return AffineForm(-argument.center(), coefficients, argument.error());
+    }
+
+    inline
+    AffineForm
+    operator+(const AffineForm& firstAffineForm, const AffineForm& secondAffineForm) {
+        std::array<double, AffineForm::NUM_SYMBOLS> coefficients;
+        for (int symbolIndex = 0; symbolIndex < AffineForm::NUM_SYMBOLS; ++symbolIndex) {
+            double firstCoefficient = firstAffineForm.coefficient(symbolIndex);
+            double secondCoefficient = secondAffineForm.coefficient(symbolIndex);
+            coefficients[symbolIndex] = firstCoefficient + secondCoefficient;
+        }
+        return AffineForm(
+            firstAffineForm.center() + secondAffineForm.center(),
+            coefficients,
+            firstAffineForm.error() + secondAffineForm.error()
+        );
+    }
+
+    inline
+    AffineForm
+    operator-(const AffineForm& firstAffineForm, const AffineForm& secondAffineForm) {
+        std::array<double, AffineForm::NUM_SYMBOLS> coefficients;
+        for (int symbolIndex = 0; symbolIndex < AffineForm::NUM_SYMBOLS; ++symbolIndex) {
+            double firstCoefficient = firstAffineForm.coefficient(symbolIndex);
+            double secondCoefficient = secondAffineForm.coefficient(symbolIndex);
+            coefficients[symbolIndex] = firstCoefficient - secondCoefficient;
+        }
+        return AffineForm(
+            firstAffineForm.center() - secondAffineForm.center(),
+            coefficients,
+            firstAffineForm.error() + secondAffineForm.error()
+        );
+    }
+
+    inline
+    AffineForm
+    operator*(const AffineForm& firstAffineForm, const AffineForm& secondAffineForm) {
+        // The product of the two linear parts is kept, and the product of the two deviations
+        // from the centers is bounded by the product of the radii
+        double firstCenter = firstAffineForm.center();
+        double secondCenter = secondAffineForm.center();
+        std::array<double, AffineForm::NUM_SYMBOLS> coefficients;
+        for (int symbolIndex = 0; symbolIndex < AffineForm::NUM_SYMBOLS; ++symbolIndex) {
+            double firstCoefficient = firstAffineForm.coefficient(symbolIndex);
+            double secondCoefficient = secondAffineForm.coefficient(symbolIndex);
+            coefficients[symbolIndex] = firstCenter * secondCoefficient;
+            coefficients[symbolIndex] += secondCenter * firstCoefficient;
+        }
+        double error = firstAffineForm.radius() * secondAffineForm.radius();
+        error += std::abs(firstCenter) * secondAffineForm.error();
+        error += std::abs(secondCenter) * firstAffineForm.error();
+        return AffineForm(firstCenter * secondCenter, coefficients, error);
+    }
+}
@@ -34,6 +34,7 @@
 #include <OpenSolid/Core/ParametricSurface.hpp>
 #include <OpenSolid/Core/Point.hpp>
 #include <OpenSolid/Core/SpatialSet.hpp>
+#include <OpenSolid/Core/ThreadPool.hpp>
 #include <OpenSolid/Core/Transformable.hpp>
 #include <OpenSolid/Core/UnitVector.hpp>
 
@@ -58,6 +59,27 @@ namespace opensolid
         _boundaries(std::move(boundaries)) {
     }
 
+    std::vector<std::vector<Point<2>>>
+    BoundedArea2d::tessellatedBoundaries(double chordTolerance, double angleTolerance) const {
+        int numBoundaries = int(boundaries().size());
+        std::vector<std::vector<Point<2>>> results(numBoundaries);
+        // Each curve is a substantial amount of work, so allow every curve to run on its own
+        // thread
+        ThreadPool::global().parallelFor(
+            numBoundaries,
+            1,
+            [&] (int begin, int end) {
+                for (int index = begin; index < end; ++index) {
+                    results[index] = boundaries()[index].tessellate(
+                        chordTolerance,
+                        angleTolerance
+                    );
+                }
+            }
+        );
+        return results;
+    }
+
     ParametricSurface3d
     BoundedArea2d::placedOnto(const Plane3d& plane) const {
         return ParametricSurface3d(plane.expression(), *this);
@@ -37,6 +37,8 @@
 #include <OpenSolid/Core/SpatialSet.definitions.hpp>
 #include <OpenSolid/Core/Transformable.definitions.hpp>
 
+#include <vector>
+
 namespace opensolid
 {
     template <>
@@ -81,6 +83,12 @@ namespace opensolid
         Box<2>
         bounds() const;
 
+        // Polylines approximating each boundary curve (see ParametricCurveBase::tessellate()),
+        // in the same order as boundaries(). Curves are tessellated in parallel.
+        OPENSOLID_CORE_EXPORT
+        std::vector<std::vector<Point<2>>>
+        tessellatedBoundaries(double chordTolerance, double angleTolerance) const;
+
         template <class TTransformation>
         BoundedArea2d
         transformedBy(const TTransformation& transformation) const;
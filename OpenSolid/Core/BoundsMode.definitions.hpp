@@ -26,43 +26,26 @@
 
 #include <OpenSolid/config.hpp>
 
-#include <OpenSolid/Core/ParametricExpression/Bytecode/Variable.declarations.hpp>
-
-#include <OpenSolid/Core/ParametricExpression/Bytecode/Compiler.declarations.hpp>
-#include <OpenSolid/Core/ParametricExpression/Bytecode/Expr.declarations.hpp>
-
 namespace opensolid
 {
-    namespace detail
+    // Method used to compute bounds on the values of a ParametricExpression over a given
+    // parameter domain
+    enum BoundsMode
     {
-        class Variable
-        {
-        public:
-            enum Type
-            {
-                DOUBLE = 1,
-                INTERVAL = 2
-            };
-        private:
-            Compiler* _compiler;
-            Type _type;
-            int _numDimensions;
-        protected:
-            Variable(Compiler* compiler, Type type, int numDimensions);
-
-            Compiler*
-            compiler();
-        public:
-            Type
-            type() const;
-
-            int
-            numDimensions() const;
-
-            int
-            size() const;
-
-            
-        };
-    }
+        // Plain interval arithmetic; fastest, but each occurrence of a parameter is treated
+        // independently, which can give very loose bounds for nonlinear expressions
+        NATURAL_BOUNDS,
+
+        // Affine arithmetic (see AffineForm), intersected with the natural bounds; tracks
+        // linear correlations between intermediate values so is usually much tighter,
+        // particularly over small domains
+        AFFINE_BOUNDS,
+
+        // Mean value form f(m) + J(X) * (X - m), where m is the center of the parameter
+        // domain X and J(X) bounds the Jacobian over X, intersected with the natural bounds;
+        // the overestimation shrinks quadratically with the size of the domain instead of
+        // linearly, so this is most effective for small domains such as those encountered
+        // deep in recursive subdivision
+        MEAN_VALUE_BOUNDS
+    };
 }
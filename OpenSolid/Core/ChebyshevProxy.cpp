@@ -0,0 +1,385 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#include <OpenSolid/Core/ChebyshevProxy.hpp>
+
+#include <OpenSolid/Core/Error.hpp>
+#include <OpenSolid/Core/ParametricExpression/CompiledExpression.hpp>
+#include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace opensolid
+{
+    namespace
+    {
+        // Segments narrower than this fraction of the domain are never subdivided further
+        const double MIN_RELATIVE_SEGMENT_WIDTH = 1e-9;
+
+        const int MAX_NUM_SEGMENTS = 1 << 16;
+
+        // Sum a fixed number of interleaved Chebyshev series at the given point in [-1, 1]
+        // using the Clenshaw recurrence. The series are summed together so that their
+        // (independent) recurrences can proceed in parallel, and with the number of series
+        // known at compile time so that all intermediate values can be kept in registers.
+        template <int iNumSeries, class TScalar>
+        void
+        clenshawBlock(
+            const double* coefficients,
+            int stride,
+            int degree,
+            TScalar x,
+            TScalar* results
+        ) {
+            TScalar twoX = 2.0 * x;
+            TScalar next[iNumSeries];
+            TScalar nextNext[iNumSeries];
+            for (int series = 0; series < iNumSeries; ++series) {
+                next[series] = TScalar(0.0);
+                nextNext[series] = TScalar(0.0);
+            }
+            for (int index = degree; index >= 1; --index) {
+                const double* terms = coefficients + index * stride;
+                for (int series = 0; series < iNumSeries; ++series) {
+                    TScalar current = terms[series] + twoX * next[series] - nextNext[series];
+                    nextNext[series] = next[series];
+                    next[series] = current;
+                }
+            }
+            for (int series = 0; series < iNumSeries; ++series) {
+                results[series] = coefficients[series] + x * next[series] - nextNext[series];
+            }
+        }
+
+        // Sum Chebyshev series with interleaved coefficients (the coefficients of degree k
+        // for all series stored consecutively, before those of degree k + 1)
+        template <class TScalar>
+        void
+        clenshaw(
+            const double* coefficients,
+            int degree,
+            int numSeries,
+            TScalar x,
+            TScalar* results
+        ) {
+            // Handle blocks of four series at a time, then any remaining series
+            int start = 0;
+            while (numSeries - start > 4) {
+                clenshawBlock<4>(coefficients + start, numSeries, degree, x, results + start);
+                start += 4;
+            }
+            int numRemaining = numSeries - start;
+            const double* remainingCoefficients = coefficients + start;
+            TScalar* remainingResults = results + start;
+            if (numRemaining == 1) {
+                clenshawBlock<1>(remainingCoefficients, numSeries, degree, x, remainingResults);
+            } else if (numRemaining == 2) {
+                clenshawBlock<2>(remainingCoefficients, numSeries, degree, x, remainingResults);
+            } else if (numRemaining == 3) {
+                clenshawBlock<3>(remainingCoefficients, numSeries, degree, x, remainingResults);
+            } else if (numRemaining == 4) {
+                clenshawBlock<4>(remainingCoefficients, numSeries, degree, x, remainingResults);
+            }
+        }
+    }
+
+    namespace detail
+    {
+        int
+        PiecewiseChebyshev::segmentIndex(double parameterValue) const {
+            // Parameter values outside the domain map to the first or last segment
+            auto begin = _breakpoints.begin() + 1;
+            auto end = _breakpoints.end() - 1;
+            return int(std::upper_bound(begin, end, parameterValue) - begin);
+        }
+
+        double
+        PiecewiseChebyshev::fit(
+            const CompiledExpression& compiledExpression,
+            Interval segment,
+            std::vector<double>& coefficients
+        ) const {
+            // Interpolate at the Chebyshev nodes (roots of T_(n+1)), then check the error at
+            // twice as many points interleaved with the nodes, plus both endpoints so that
+            // adjacent segments meet to within the tolerance
+            int numNodes = _degree + 1;
+            int numCheckPoints = 2 * numNodes + 2;
+            int numPoints = numNodes + numCheckPoints;
+            std::vector<double> xValues(numPoints);
+            for (int index = 0; index < numNodes; ++index) {
+                xValues[index] = std::cos(M_PI * (index + 0.5) / numNodes);
+            }
+            for (int index = 0; index < 2 * numNodes; ++index) {
+                xValues[numNodes + index] = std::cos(M_PI * (index + 0.5) / (2 * numNodes));
+            }
+            xValues[numPoints - 2] = -1.0;
+            xValues[numPoints - 1] = 1.0;
+
+            double center = segment.median();
+            double halfWidth = 0.5 * segment.width();
+            std::vector<double> parameterValues(numPoints);
+            for (int index = 0; index < numPoints; ++index) {
+                parameterValues[index] = center + halfWidth * xValues[index];
+            }
+            std::vector<double> values(_numDimensions * numPoints);
+            ConstMatrixViewXd parameterView(parameterValues.data(), 1, numPoints, sizeof(double));
+            MatrixViewXd valueView(
+                values.data(),
+                _numDimensions,
+                numPoints,
+                _numDimensions * sizeof(double)
+            );
+            compiledExpression.evaluate(parameterView, valueView);
+
+            coefficients.assign(_numDimensions * numNodes, 0.0);
+            for (int degree = 0; degree <= _degree; ++degree) {
+                for (int index = 0; index < numNodes; ++index) {
+                    double weight = 2.0 * std::cos(M_PI * degree * (index + 0.5) / numNodes);
+                    for (int dimension = 0; dimension < _numDimensions; ++dimension) {
+                        double term = weight * valueView(dimension, index) / numNodes;
+                        coefficients[degree * _numDimensions + dimension] += term;
+                    }
+                }
+            }
+            for (int dimension = 0; dimension < _numDimensions; ++dimension) {
+                coefficients[dimension] *= 0.5;
+            }
+
+            // Use the size of the highest-order coefficients as a second error estimate, in
+            // case the check points happen to miss the largest errors
+            double error = 0.0;
+            for (int dimension = 0; dimension < _numDimensions; ++dimension) {
+                double tail = std::abs(coefficients[_degree * _numDimensions + dimension]);
+                if (_degree > 1) {
+                    tail += std::abs(coefficients[(_degree - 1) * _numDimensions + dimension]);
+                }
+                error = std::max(error, tail);
+            }
+            std::vector<double> approximation(_numDimensions);
+            for (int index = numNodes; index < numPoints; ++index) {
+                clenshaw(
+                    coefficients.data(),
+                    _degree,
+                    _numDimensions,
+                    xValues[index],
+                    approximation.data()
+                );
+                for (int dimension = 0; dimension < _numDimensions; ++dimension) {
+                    double difference = std::abs(
+                        approximation[dimension] - valueView(dimension, index)
+                    );
+                    if (!(difference <= error)) {
+                        error = difference;
+                    }
+                }
+            }
+            return error;
+        }
+
+        PiecewiseChebyshev::PiecewiseChebyshev() :
+            _numDimensions(0),
+            _degree(0),
+            _errorBound(0.0) {
+        }
+
+        PiecewiseChebyshev::PiecewiseChebyshev(
+            const CompiledExpression& compiledExpression,
+            Interval domain,
+            double tolerance,
+            int degree
+        ) : _numDimensions(compiledExpression.implementation()->numDimensions()),
+            _degree(degree),
+            _domain(domain),
+            _errorBound(0.0) {
+
+            bool isValidDomain = (
+                domain.width() > 0.0 &&
+                domain.width() < std::numeric_limits<double>::infinity()
+            );
+            if (!isValidDomain || !(tolerance > 0.0) || degree < 1) {
+                throw Error(new PlaceholderError());
+            }
+            int numCoefficients = _numDimensions * (_degree + 1);
+            double minWidth = MIN_RELATIVE_SEGMENT_WIDTH * domain.width();
+
+            // Depth-first, processing the lower half of each bisected segment first so that
+            // accepted segments are produced in order
+            std::vector<Interval> stack(1, domain);
+            std::vector<double> coefficients;
+            while (!stack.empty()) {
+                Interval segment = stack.back();
+                stack.pop_back();
+                double error = fit(compiledExpression, segment, coefficients);
+                int numSegments = int(_breakpoints.size() + stack.size());
+                bool canBisect = segment.width() > minWidth && numSegments < MAX_NUM_SEGMENTS;
+                if (!(error <= tolerance) && canBisect) {
+                    std::pair<Interval, Interval> halves = segment.bisected();
+                    stack.push_back(halves.second);
+                    stack.push_back(halves.first);
+                    continue;
+                }
+                if (!(error <= _errorBound)) {
+                    _errorBound = error;
+                }
+                _breakpoints.push_back(segment.lowerBound());
+                _coefficients.insert(_coefficients.end(), coefficients.begin(), coefficients.end());
+
+                // Differentiate each series using the recurrence d_(k-1) = d_(k+1) + 2k c_k,
+                // scaling from [-1, 1] back to the segment
+                double scale = 2.0 / segment.width();
+                std::vector<double> derivativeCoefficients(numCoefficients + 2 * _numDimensions);
+                for (int index = _degree; index >= 1; --index) {
+                    for (int dimension = 0; dimension < _numDimensions; ++dimension) {
+                        derivativeCoefficients[(index - 1) * _numDimensions + dimension] = (
+                            derivativeCoefficients[(index + 1) * _numDimensions + dimension] +
+                            2.0 * index * coefficients[index * _numDimensions + dimension]
+                        );
+                    }
+                }
+                for (int dimension = 0; dimension < _numDimensions; ++dimension) {
+                    derivativeCoefficients[dimension] *= 0.5;
+                    double coefficientSum = 0.0;
+                    double derivativeSum = 0.0;
+                    for (int index = 0; index <= _degree; ++index) {
+                        int offset = index * _numDimensions + dimension;
+                        if (index > 0) {
+                            coefficientSum += std::abs(coefficients[offset]);
+                        }
+                        if (index < _degree) {
+                            derivativeCoefficients[offset] *= scale;
+                            derivativeSum += std::abs(derivativeCoefficients[offset]);
+                        } else {
+                            derivativeCoefficients[offset] = 0.0;
+                        }
+                    }
+                    _coefficientSums.push_back(coefficientSum);
+                    _derivativeSums.push_back(derivativeSum);
+                }
+                _derivativeCoefficients.insert(
+                    _derivativeCoefficients.end(),
+                    derivativeCoefficients.begin(),
+                    derivativeCoefficients.begin() + numCoefficients
+                );
+            }
+            _breakpoints.push_back(domain.upperBound());
+        }
+
+        void
+        PiecewiseChebyshev::evaluate(double parameterValue, MatrixViewXd& resultView) const {
+            int index = segmentIndex(parameterValue);
+            double lowerBound = _breakpoints[index];
+            double upperBound = _breakpoints[index + 1];
+            double x = (2.0 * parameterValue - lowerBound - upperBound) / (upperBound - lowerBound);
+            int offset = index * _numDimensions * (_degree + 1);
+            clenshaw(&_coefficients[offset], _degree, _numDimensions, x, resultView.data());
+        }
+
+        void
+        PiecewiseChebyshev::evaluateDerivative(
+            double parameterValue,
+            MatrixViewXd& resultView
+        ) const {
+            int index = segmentIndex(parameterValue);
+            double lowerBound = _breakpoints[index];
+            double upperBound = _breakpoints[index + 1];
+            double x = (2.0 * parameterValue - lowerBound - upperBound) / (upperBound - lowerBound);
+            int offset = index * _numDimensions * (_degree + 1);
+            const double* coefficients = &_derivativeCoefficients[offset];
+            clenshaw(coefficients, _degree - 1, _numDimensions, x, resultView.data());
+        }
+
+        void
+        PiecewiseChebyshev::evaluate(
+            Interval parameterBounds,
+            IntervalMatrixViewXd& resultView
+        ) const {
+            for (int dimension = 0; dimension < _numDimensions; ++dimension) {
+                resultView(dimension, 0) = Interval::EMPTY();
+            }
+            if (parameterBounds.isEmpty()) {
+                return;
+            }
+            int firstIndex = segmentIndex(parameterBounds.lowerBound());
+            int lastIndex = segmentIndex(parameterBounds.upperBound());
+            for (int index = firstIndex; index <= lastIndex; ++index) {
+                double segmentLower = _breakpoints[index];
+                double segmentUpper = _breakpoints[index + 1];
+                double lowerBound = std::max(parameterBounds.lowerBound(), segmentLower);
+                double upperBound = std::min(parameterBounds.upperBound(), segmentUpper);
+                if (index == firstIndex) {
+                    lowerBound = parameterBounds.lowerBound();
+                }
+                if (index == lastIndex) {
+                    upperBound = parameterBounds.upperBound();
+                }
+                double segmentWidth = segmentUpper - segmentLower;
+                Interval x(
+                    (2.0 * lowerBound - segmentLower - segmentUpper) / segmentWidth,
+                    (2.0 * upperBound - segmentLower - segmentUpper) / segmentWidth
+                );
+                double xCenter = x.median();
+                double radius = 0.5 * (upperBound - lowerBound);
+                bool isInside = x.lowerBound() >= -1.0 && x.upperBound() <= 1.0;
+
+                int offset = index * _numDimensions * (_degree + 1);
+                const double* coefficients = &_coefficients[offset];
+                std::vector<double> centerValues(_numDimensions);
+                std::vector<Interval> seriesBounds(_numDimensions);
+                if (isInside) {
+                    clenshaw(coefficients, _degree, _numDimensions, xCenter, centerValues.data());
+                } else {
+                    // Extrapolating, so fall back to evaluating the series directly
+                    clenshaw(coefficients, _degree, _numDimensions, x, seriesBounds.data());
+                }
+                for (int dimension = 0; dimension < _numDimensions; ++dimension) {
+                    Interval bounds = seriesBounds[dimension];
+                    if (isInside) {
+                        // Each |T_k(x)| is at most one within the segment, giving bounds on
+                        // both the series and its derivative (for a mean value form)
+                        int sumIndex = index * _numDimensions + dimension;
+                        double coefficientSum = _coefficientSums[sumIndex];
+                        double derivativeBound = _derivativeSums[sumIndex] * radius;
+                        double centerValue = centerValues[dimension];
+                        Interval meanValue(
+                            centerValue - derivativeBound,
+                            centerValue + derivativeBound
+                        );
+                        Interval range(
+                            coefficients[dimension] - coefficientSum,
+                            coefficients[dimension] + coefficientSum
+                        );
+                        bounds = meanValue.intersection(range);
+                    }
+                    bounds = Interval(
+                        bounds.lowerBound() - _errorBound,
+                        bounds.upperBound() + _errorBound
+                    );
+                    resultView(dimension, 0) = resultView(dimension, 0).hull(bounds);
+                }
+            }
+        }
+    }
+}
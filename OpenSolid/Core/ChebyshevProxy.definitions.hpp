@@ -0,0 +1,171 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#pragma once
+
+#include <OpenSolid/config.hpp>
+
+#include <OpenSolid/Core/ChebyshevProxy.declarations.hpp>
+
+#include <OpenSolid/Core/BoundsType.declarations.hpp>
+#include <OpenSolid/Core/Interval.definitions.hpp>
+#include <OpenSolid/Core/MatrixView.declarations.hpp>
+#include <OpenSolid/Core/ParametricExpression.declarations.hpp>
+#include <OpenSolid/Core/ParametricExpression/CompiledExpression.declarations.hpp>
+
+#include <vector>
+
+namespace opensolid
+{
+    namespace detail
+    {
+        // Piecewise Chebyshev approximation of a vector-valued function of a single parameter.
+        // The domain is split into segments, each small enough that a fixed-degree Chebyshev
+        // series interpolating the function at Chebyshev nodes within the segment matches the
+        // function to within the requested tolerance at a denser set of check points. Series
+        // are evaluated using the Clenshaw recurrence.
+        class PiecewiseChebyshev
+        {
+        private:
+            int _numDimensions;
+            int _degree;
+            Interval _domain;
+            double _errorBound;
+
+            // Lower bound of each segment followed by the upper bound of the last segment
+            std::vector<double> _breakpoints;
+
+            // Series coefficients for each segment and dimension, of the function and of its
+            // derivative with respect to the parameter
+            std::vector<double> _coefficients;
+            std::vector<double> _derivativeCoefficients;
+
+            // Sums of the absolute values of the non-constant function coefficients and of all
+            // derivative coefficients, for each segment and dimension
+            std::vector<double> _coefficientSums;
+            std::vector<double> _derivativeSums;
+
+            int
+            segmentIndex(double parameterValue) const;
+
+            double
+            fit(
+                const CompiledExpression& compiledExpression,
+                Interval segment,
+                std::vector<double>& coefficients
+            ) const;
+        public:
+            OPENSOLID_CORE_EXPORT
+            PiecewiseChebyshev();
+
+            OPENSOLID_CORE_EXPORT
+            PiecewiseChebyshev(
+                const CompiledExpression& compiledExpression,
+                Interval domain,
+                double tolerance,
+                int degree
+            );
+
+            int
+            degree() const;
+
+            Interval
+            domain() const;
+
+            double
+            errorBound() const;
+
+            int
+            numSegments() const;
+
+            OPENSOLID_CORE_EXPORT
+            void
+            evaluate(double parameterValue, MatrixView<double, -1, -1, -1>& resultView) const;
+
+            OPENSOLID_CORE_EXPORT
+            void
+            evaluateDerivative(
+                double parameterValue,
+                MatrixView<double, -1, -1, -1>& resultView
+            ) const;
+
+            OPENSOLID_CORE_EXPORT
+            void
+            evaluate(
+                Interval parameterBounds,
+                MatrixView<Interval, -1, -1, -1>& resultView
+            ) const;
+        };
+    }
+
+    // Fast approximation of a ParametricExpression (or curve) of a single parameter, for use
+    // where many evaluations are needed and a small, known error is acceptable (interactive
+    // editing, collision checks etc.). The expression is replaced by a piecewise Chebyshev
+    // series of the given degree, with segments subdivided until the estimated error is within
+    // the given tolerance; errorBound() returns the largest estimated error over all segments.
+    // Evaluating a proxy costs a few multiply-adds per component regardless of how complex the
+    // original expression was. Parameter values outside the domain are extrapolated from the
+    // first or last segment.
+    template <class TValue>
+    class ChebyshevProxy
+    {
+    private:
+        detail::PiecewiseChebyshev _piecewiseChebyshev;
+    public:
+        ChebyshevProxy();
+
+        ChebyshevProxy(
+            const ParametricExpression<TValue, double>& expression,
+            Interval domain,
+            double tolerance = 1e-9,
+            int degree = 12
+        );
+
+        Interval
+        domain() const;
+
+        int
+        degree() const;
+
+        int
+        numSegments() const;
+
+        double
+        errorBound() const;
+
+        TValue
+        evaluate(double parameterValue) const;
+
+        // Bounds on the original expression over the given parameter bounds, derived from the
+        // series coefficients and widened by the error bound
+        typename BoundsType<TValue>::Type
+        evaluate(Interval parameterBounds) const;
+
+        std::vector<TValue>
+        evaluate(const std::vector<double>& parameterValues) const;
+
+        typename DerivativeType<TValue>::Type
+        derivative(double parameterValue) const;
+    };
+}
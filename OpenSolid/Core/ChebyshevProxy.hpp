@@ -0,0 +1,151 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#pragma once
+
+#include <OpenSolid/config.hpp>
+
+#include <OpenSolid/Core/ChebyshevProxy.definitions.hpp>
+
+#include <OpenSolid/Core/Box.hpp>
+#include <OpenSolid/Core/Interval.hpp>
+#include <OpenSolid/Core/MatrixView.hpp>
+#include <OpenSolid/Core/ParametricExpression.hpp>
+#include <OpenSolid/Core/Point.hpp>
+#include <OpenSolid/Core/Vector.hpp>
+
+namespace opensolid
+{
+    namespace detail
+    {
+        inline
+        int
+        PiecewiseChebyshev::degree() const {
+            return _degree;
+        }
+
+        inline
+        Interval
+        PiecewiseChebyshev::domain() const {
+            return _domain;
+        }
+
+        inline
+        double
+        PiecewiseChebyshev::errorBound() const {
+            return _errorBound;
+        }
+
+        inline
+        int
+        PiecewiseChebyshev::numSegments() const {
+            return int(_breakpoints.size()) - 1;
+        }
+    }
+
+    template <class TValue>
+    inline
+    ChebyshevProxy<TValue>::ChebyshevProxy() {
+    }
+
+    template <class TValue>
+    inline
+    ChebyshevProxy<TValue>::ChebyshevProxy(
+        const ParametricExpression<TValue, double>& expression,
+        Interval domain,
+        double tolerance,
+        int degree
+    ) : _piecewiseChebyshev(*expression.compiledExpression(), domain, tolerance, degree) {
+    }
+
+    template <class TValue>
+    inline
+    Interval
+    ChebyshevProxy<TValue>::domain() const {
+        return _piecewiseChebyshev.domain();
+    }
+
+    template <class TValue>
+    inline
+    int
+    ChebyshevProxy<TValue>::degree() const {
+        return _piecewiseChebyshev.degree();
+    }
+
+    template <class TValue>
+    inline
+    int
+    ChebyshevProxy<TValue>::numSegments() const {
+        return _piecewiseChebyshev.numSegments();
+    }
+
+    template <class TValue>
+    inline
+    double
+    ChebyshevProxy<TValue>::errorBound() const {
+        return _piecewiseChebyshev.errorBound();
+    }
+
+    template <class TValue>
+    inline
+    TValue
+    ChebyshevProxy<TValue>::evaluate(double parameterValue) const {
+        TValue result;
+        MatrixViewXd resultView = detail::mutableView(result);
+        _piecewiseChebyshev.evaluate(parameterValue, resultView);
+        return result;
+    }
+
+    template <class TValue>
+    inline
+    typename BoundsType<TValue>::Type
+    ChebyshevProxy<TValue>::evaluate(Interval parameterBounds) const {
+        typename BoundsType<TValue>::Type result;
+        IntervalMatrixViewXd resultView = detail::mutableView(result);
+        _piecewiseChebyshev.evaluate(parameterBounds, resultView);
+        return result;
+    }
+
+    template <class TValue>
+    inline
+    std::vector<TValue>
+    ChebyshevProxy<TValue>::evaluate(const std::vector<double>& parameterValues) const {
+        std::vector<TValue> results(parameterValues.size());
+        for (std::size_t index = 0; index < parameterValues.size(); ++index) {
+            MatrixViewXd resultView = detail::mutableView(results[index]);
+            _piecewiseChebyshev.evaluate(parameterValues[index], resultView);
+        }
+        return results;
+    }
+
+    template <class TValue>
+    inline
+    typename DerivativeType<TValue>::Type
+    ChebyshevProxy<TValue>::derivative(double parameterValue) const {
+        typename DerivativeType<TValue>::Type result;
+        MatrixViewXd resultView = detail::mutableView(result);
+        _piecewiseChebyshev.evaluateDerivative(parameterValue, resultView);
+        return result;
+    }
+}
@@ -0,0 +1,495 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#include <OpenSolid/Core/EquationSolver.hpp>
+
+#include <OpenSolid/Core/Error.hpp>
+#include <OpenSolid/Core/ParametricExpression/CompiledExpression.hpp>
+#include <OpenSolid/Core/ThreadPool.hpp>
+#include <OpenSolid/Core/Zero.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace opensolid
+{
+    namespace
+    {
+        typedef std::vector<Interval> IntervalVector;
+
+        // Maximum number of Krawczyk contractions applied to a single box before giving up
+        // and bisecting it (or accepting it as a solution, if uniqueness has been proven)
+        const int MAX_NUM_CONTRACTIONS = 64;
+
+        double
+        maxWidth(const IntervalVector& box) {
+            double result = 0.0;
+            for (Interval interval : box) {
+                result = std::max(result, interval.width());
+            }
+            return result;
+        }
+
+        // Invert a dense square matrix (stored column-major) using Gauss-Jordan elimination with
+        // partial pivoting, returning false if it is singular to working precision
+        bool
+        invert(std::vector<double> matrix, int size, std::vector<double>& inverse) {
+            inverse.assign(size * size, 0.0);
+            for (int index = 0; index < size; ++index) {
+                inverse[index * size + index] = 1.0;
+            }
+            double scale = 0.0;
+            for (double component : matrix) {
+                scale = std::max(scale, std::abs(component));
+            }
+            if (!(scale > 0.0) || !(scale < std::numeric_limits<double>::infinity())) {
+                return false;
+            }
+            double minPivot = 1e3 * std::numeric_limits<double>::epsilon() * scale;
+            for (int column = 0; column < size; ++column) {
+                int pivotRow = column;
+                for (int row = column + 1; row < size; ++row) {
+                    double magnitude = std::abs(matrix[column * size + row]);
+                    if (magnitude > std::abs(matrix[column * size + pivotRow])) {
+                        pivotRow = row;
+                    }
+                }
+                double pivot = matrix[column * size + pivotRow];
+                if (!(std::abs(pivot) > minPivot)) {
+                    return false;
+                }
+                for (int index = 0; index < size; ++index) {
+                    std::swap(matrix[index * size + column], matrix[index * size + pivotRow]);
+                    std::swap(inverse[index * size + column], inverse[index * size + pivotRow]);
+                }
+                for (int index = 0; index < size; ++index) {
+                    matrix[index * size + column] /= pivot;
+                    inverse[index * size + column] /= pivot;
+                }
+                for (int row = 0; row < size; ++row) {
+                    double factor = matrix[column * size + row];
+                    if (row == column || factor == 0.0) {
+                        continue;
+                    }
+                    for (int index = 0; index < size; ++index) {
+                        matrix[index * size + row] -= factor * matrix[index * size + column];
+                        inverse[index * size + row] -= factor * inverse[index * size + column];
+                    }
+                }
+            }
+            return true;
+        }
+
+        // Result of processing a single box
+        struct Subdivision
+        {
+            IntervalVector solution;
+            bool isUnique;
+            std::vector<IntervalVector> children;
+        };
+
+        class Search
+        {
+        private:
+            const detail::CompiledExpression& _compiledExpression;
+            int _numDimensions;
+            double _tolerance;
+
+            // Function values within these distances of zero are treated as zero (see
+            // CompiledExpression::zeroPrecisions()), so that rounding error near a singular
+            // solution does not produce many spurious solutions
+            std::vector<double> _zeroPrecisions;
+
+            // Evaluate f(X) and J(X) over a box, returning false if evaluation failed
+            bool
+            evaluate(
+                const IntervalVector& box,
+                IntervalVector& values,
+                IntervalVector& jacobian
+            ) const {
+                int numDimensions = _numDimensions;
+                IntervalVector results(numDimensions + numDimensions * numDimensions);
+                ConstIntervalMatrixViewXd parameterView(
+                    box.data(),
+                    numDimensions,
+                    1,
+                    numDimensions * sizeof(Interval)
+                );
+                IntervalMatrixViewXd resultView(
+                    results.data(),
+                    int(results.size()),
+                    1,
+                    int(results.size()) * sizeof(Interval)
+                );
+                try {
+                    _compiledExpression.evaluateWithJacobian(parameterView, resultView);
+                } catch (const Error&) {
+                    return false;
+                }
+                values.assign(results.begin(), results.begin() + numDimensions);
+                jacobian.assign(results.begin() + numDimensions, results.end());
+                return true;
+            }
+
+            // Evaluate f(c) at a single point, using interval arithmetic so that the result
+            // is a (nearly) rigorous enclosure of the exact value
+            bool
+            evaluate(const IntervalVector& point, IntervalVector& values) const {
+                values.resize(_numDimensions);
+                ConstIntervalMatrixViewXd parameterView(
+                    point.data(),
+                    _numDimensions,
+                    1,
+                    _numDimensions * sizeof(Interval)
+                );
+                IntervalMatrixViewXd resultView(
+                    values.data(),
+                    _numDimensions,
+                    1,
+                    _numDimensions * sizeof(Interval)
+                );
+                try {
+                    _compiledExpression.evaluate(parameterView, resultView);
+                } catch (const Error&) {
+                    return false;
+                }
+                return true;
+            }
+
+            enum ContractionResult
+            {
+                EXCLUDED,
+                ZERO,
+                CONTRACTED,
+                UNIQUE,
+                FAILED
+            };
+
+            // Apply the Krawczyk operator to the given box, replacing it by its intersection
+            // with K(X)
+            ContractionResult
+            contract(IntervalVector& box) const {
+                int numDimensions = _numDimensions;
+                IntervalVector values;
+                IntervalVector jacobian;
+                if (!evaluate(box, values, jacobian)) {
+                    return FAILED;
+                }
+                bool isZero = true;
+                for (int index = 0; index < numDimensions; ++index) {
+                    Interval value = values[index];
+                    double zeroPrecision = _zeroPrecisions[index];
+                    if (value.isEmpty() || !value.overlaps(Interval(0.0), zeroPrecision)) {
+                        return EXCLUDED;
+                    }
+                    isZero = isZero && value == Zero(zeroPrecision);
+                }
+                if (isZero) {
+                    return ZERO;
+                }
+
+                IntervalVector center(numDimensions);
+                for (int index = 0; index < numDimensions; ++index) {
+                    center[index] = Interval(box[index].median());
+                }
+                IntervalVector centerValues;
+                if (!evaluate(center, centerValues)) {
+                    return FAILED;
+                }
+                for (int index = 0; index < numDimensions; ++index) {
+                    double zeroPrecision = _zeroPrecisions[index];
+                    centerValues[index] += Interval(-zeroPrecision, zeroPrecision);
+                }
+
+                // Preconditioner: inverse of the Jacobian at the center of its bounds
+                std::vector<double> medianJacobian(jacobian.size());
+                for (std::size_t index = 0; index < jacobian.size(); ++index) {
+                    medianJacobian[index] = jacobian[index].median();
+                }
+                std::vector<double> preconditioner;
+                if (!invert(medianJacobian, numDimensions, preconditioner)) {
+                    return FAILED;
+                }
+
+                // Jacobian entry (row, column) is stored at column * numDimensions + row, as
+                // are entries of the preconditioner
+                bool isStrictlyInside = true;
+                for (int row = 0; row < numDimensions; ++row) {
+                    Interval krawczyk = center[row];
+                    for (int index = 0; index < numDimensions; ++index) {
+                        double coefficient = preconditioner[index * numDimensions + row];
+                        krawczyk -= coefficient * centerValues[index];
+                    }
+                    for (int column = 0; column < numDimensions; ++column) {
+                        Interval residual(row == column ? 1.0 : 0.0);
+                        for (int index = 0; index < numDimensions; ++index) {
+                            double coefficient = preconditioner[index * numDimensions + row];
+                            residual -= coefficient * jacobian[column * numDimensions + index];
+                        }
+                        krawczyk += residual * (box[column] - center[column]);
+                    }
+                    if (krawczyk.isEmpty()) {
+                        return FAILED;
+                    }
+                    isStrictlyInside = isStrictlyInside && (
+                        krawczyk.lowerBound() > box[row].lowerBound() &&
+                        krawczyk.upperBound() < box[row].upperBound()
+                    );
+                    Interval intersection = box[row].intersection(krawczyk);
+                    if (intersection.isEmpty()) {
+                        return EXCLUDED;
+                    }
+                    box[row] = intersection;
+                }
+                return isStrictlyInside ? UNIQUE : CONTRACTED;
+            }
+        public:
+            Search(
+                const detail::CompiledExpression& compiledExpression,
+                const ConstIntervalMatrixViewXd& domainView,
+                double tolerance
+            ) : _compiledExpression(compiledExpression),
+                _numDimensions(domainView.numRows()),
+                _tolerance(tolerance),
+                _zeroPrecisions(compiledExpression.zeroPrecisions(domainView)) {
+            }
+
+            void
+            subdivide(IntervalVector box, Subdivision& subdivision) const {
+                subdivision.solution.clear();
+                subdivision.isUnique = false;
+                subdivision.children.clear();
+                for (int iteration = 0; iteration < MAX_NUM_CONTRACTIONS; ++iteration) {
+                    double previousWidth = maxWidth(box);
+                    ContractionResult result = contract(box);
+                    if (result == EXCLUDED) {
+                        return;
+                    }
+                    if (result == ZERO) {
+                        // Zero (to within precision) over the entire box, so there is no point
+                        // subdividing further
+                        subdivision.solution = box;
+                        return;
+                    }
+                    if (result == FAILED) {
+                        break;
+                    }
+                    // Uniqueness, once proven, also holds for all contractions of the box
+                    subdivision.isUnique = subdivision.isUnique || result == UNIQUE;
+                    double width = maxWidth(box);
+                    if (width <= _tolerance) {
+                        subdivision.solution = box;
+                        return;
+                    }
+                    // Keep contracting as long as the box shrinks (by at least half, unless it is
+                    // already known to contain a unique solution)
+                    double requiredWidth = (subdivision.isUnique ? 1.0 : 0.5) * previousWidth;
+                    if (!(width < requiredWidth)) {
+                        break;
+                    }
+                }
+                if (subdivision.isUnique) {
+                    // Contraction stalled at the limits of precision
+                    subdivision.solution = box;
+                    return;
+                }
+
+                int splitIndex = -1;
+                double splitWidth = 0.0;
+                for (int index = 0; index < _numDimensions; ++index) {
+                    double width = box[index].width();
+                    double median = box[index].median();
+                    double minWidth = 4 * std::numeric_limits<double>::epsilon() * (
+                        1.0 + std::abs(median)
+                    );
+                    if (width > splitWidth && width > minWidth) {
+                        splitWidth = width;
+                        splitIndex = index;
+                    }
+                }
+                if (splitIndex < 0 || maxWidth(box) <= _tolerance) {
+                    subdivision.solution = box;
+                    return;
+                }
+                std::pair<Interval, Interval> halves = box[splitIndex].bisected();
+                subdivision.children.resize(2, box);
+                subdivision.children[0][splitIndex] = halves.first;
+                subdivision.children[1][splitIndex] = halves.second;
+            }
+        };
+
+        bool
+        overlaps(const IntervalVector& firstBox, const IntervalVector& secondBox) {
+            for (std::size_t index = 0; index < firstBox.size(); ++index) {
+                if (!firstBox[index].overlaps(secondBox[index], 0.0)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    EquationSolver::EquationSolver(double tolerance, bool isParallel, int maxNumBoxes) :
+        _tolerance(tolerance),
+        _isParallel(isParallel),
+        _maxNumBoxes(maxNumBoxes) {
+
+        if (!(tolerance > 0.0) || maxNumBoxes < 1) {
+            throw Error(new PlaceholderError());
+        }
+    }
+
+    void
+    EquationSolver::solve(
+        const detail::CompiledExpression& compiledExpression,
+        const ConstIntervalMatrixViewXd& domainView,
+        std::vector<Interval>& solutionBounds,
+        std::vector<bool>& solutionUniqueness
+    ) const {
+        int numDimensions = domainView.numRows();
+
+        std::vector<IntervalVector> solutions;
+        std::vector<bool> uniqueness;
+
+        IntervalVector domain(numDimensions);
+        for (int index = 0; index < numDimensions; ++index) {
+            domain[index] = domainView(index, 0);
+            if (domain[index].isEmpty()) {
+                solutionBounds.clear();
+                solutionUniqueness.clear();
+                return;
+            }
+        }
+        Search search(compiledExpression, domainView, _tolerance);
+
+        ThreadPool& threadPool = ThreadPool::global();
+        int batchSize = _isParallel ? 4 * threadPool.numThreads() : 1;
+        std::vector<IntervalVector> boxes(1, domain);
+        std::vector<IntervalVector> batch;
+        std::vector<Subdivision> subdivisions;
+        int numBoxes = 0;
+        while (!boxes.empty() && numBoxes < _maxNumBoxes) {
+            // Depth-first, so that the number of pending boxes stays small
+            batch.clear();
+            while (!boxes.empty() && int(batch.size()) < batchSize) {
+                batch.push_back(std::move(boxes.back()));
+                boxes.pop_back();
+            }
+            int numCandidates = int(batch.size());
+            subdivisions.resize(numCandidates);
+            if (numCandidates > 1) {
+                threadPool.parallelFor(
+                    numCandidates,
+                    1,
+                    [&search, &batch, &subdivisions] (int begin, int end) {
+                        for (int index = begin; index < end; ++index) {
+                            search.subdivide(batch[index], subdivisions[index]);
+                        }
+                    }
+                );
+            } else {
+                search.subdivide(batch[0], subdivisions[0]);
+            }
+            numBoxes += numCandidates;
+
+            // Push children in reverse order so that the first child is processed next
+            for (int index = numCandidates - 1; index >= 0; --index) {
+                Subdivision& subdivision = subdivisions[index];
+                if (!subdivision.solution.empty()) {
+                    solutions.push_back(std::move(subdivision.solution));
+                    uniqueness.push_back(subdivision.isUnique);
+                }
+                for (int child = int(subdivision.children.size()) - 1; child >= 0; --child) {
+                    boxes.push_back(std::move(subdivision.children[child]));
+                }
+            }
+        }
+
+        // Any boxes left unresolved once the limit is reached may still contain solutions
+        for (IntervalVector& box : boxes) {
+            solutions.push_back(std::move(box));
+            uniqueness.push_back(false);
+        }
+
+        // Merge touching solution boxes (for instance on either side of a bisection plane
+        // passing through a solution); a merged box is not known to contain a unique solution
+        std::vector<IntervalVector> mergedSolutions;
+        std::vector<bool> mergedUniqueness;
+        for (std::size_t index = 0; index < solutions.size(); ++index) {
+            IntervalVector box = solutions[index];
+            bool isUnique = uniqueness[index];
+            bool merged = true;
+            while (merged) {
+                merged = false;
+                for (std::size_t other = 0; other < mergedSolutions.size(); ++other) {
+                    const IntervalVector& otherBox = mergedSolutions[other];
+                    if (overlaps(box, otherBox)) {
+                        for (int dimension = 0; dimension < numDimensions; ++dimension) {
+                            box[dimension] = box[dimension].hull(otherBox[dimension]);
+                        }
+                        isUnique = false;
+                        mergedSolutions.erase(mergedSolutions.begin() + other);
+                        mergedUniqueness.erase(mergedUniqueness.begin() + other);
+                        merged = true;
+                        break;
+                    }
+                }
+            }
+            mergedSolutions.push_back(std::move(box));
+            mergedUniqueness.push_back(isUnique);
+        }
+
+        // Sort solutions lexicographically so that results do not depend on the order in
+        // which boxes happened to be processed
+        std::vector<int> order(mergedSolutions.size());
+        for (std::size_t index = 0; index < order.size(); ++index) {
+            order[index] = int(index);
+        }
+        std::sort(
+            order.begin(),
+            order.end(),
+            [&mergedSolutions] (int firstIndex, int secondIndex) {
+                const IntervalVector& firstBox = mergedSolutions[firstIndex];
+                const IntervalVector& secondBox = mergedSolutions[secondIndex];
+                for (std::size_t index = 0; index < firstBox.size(); ++index) {
+                    double firstValue = firstBox[index].lowerBound();
+                    double secondValue = secondBox[index].lowerBound();
+                    if (firstValue != secondValue) {
+                        return firstValue < secondValue;
+                    }
+                }
+                return false;
+            }
+        );
+        solutionBounds.clear();
+        solutionUniqueness.clear();
+        for (int index : order) {
+            const IntervalVector& box = mergedSolutions[index];
+            solutionBounds.insert(solutionBounds.end(), box.begin(), box.end());
+            solutionUniqueness.push_back(mergedUniqueness[index]);
+        }
+    }
+}
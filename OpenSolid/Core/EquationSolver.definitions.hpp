@@ -0,0 +1,110 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#pragma once
+
+#include <OpenSolid/config.hpp>
+
+#include <OpenSolid/Core/EquationSolver.declarations.hpp>
+
+#include <OpenSolid/Core/BoundsType.declarations.hpp>
+#include <OpenSolid/Core/Interval.definitions.hpp>
+#include <OpenSolid/Core/MatrixView.declarations.hpp>
+#include <OpenSolid/Core/ParametricExpression.declarations.hpp>
+#include <OpenSolid/Core/ParametricExpression/CompiledExpression.declarations.hpp>
+
+#include <vector>
+
+namespace opensolid
+{
+    template <class TParameter>
+    struct Solution
+    {
+        // Guaranteed to contain at least one solution (up to floating-point rounding error)
+        // when 'isUnique' is true; otherwise may contain any number of solutions, including
+        // none
+        typename BoundsType<TParameter>::Type bounds;
+
+        // Center of 'bounds'
+        TParameter parameterValue;
+
+        // Whether the Krawczyk test proved that 'bounds' contains exactly one solution
+        bool isUnique;
+    };
+
+    // Finds all solutions of a square system of equations f(x) = 0 (an expression with the
+    // same number of components as parameters, such as a ParametricExpression<Vector2d,
+    // Point2d>) within a parameter domain, using the interval Krawczyk operator
+    //
+    //     K(X) = c - Y f(c) + (I - Y J(X)) (X - c)
+    //
+    // where c is the center of the box X, J(X) is the interval Jacobian over X and Y is the
+    // inverse of the Jacobian at its center. Boxes are discarded when f(X) excludes zero or
+    // K(X) does not intersect X, and are otherwise contracted to K(X) intersected with X; if
+    // K(X) lies strictly inside X then X contains exactly one solution, which the contraction
+    // then converges to quadratically. Boxes that do not contract sufficiently are bisected
+    // along their widest dimension. Every solution within the domain lies within one of the
+    // returned boxes; solution boxes that touch each other are merged. In parallel mode,
+    // batches of boxes are processed concurrently on the global thread pool.
+    class EquationSolver
+    {
+    private:
+        double _tolerance;
+        bool _isParallel;
+        int _maxNumBoxes;
+
+        OPENSOLID_CORE_EXPORT
+        void
+        solve(
+            const detail::CompiledExpression& compiledExpression,
+            const MatrixView<const Interval, -1, -1, -1>& domainView,
+            std::vector<Interval>& solutionBounds,
+            std::vector<bool>& solutionUniqueness
+        ) const;
+    public:
+        OPENSOLID_CORE_EXPORT
+        explicit
+        EquationSolver(double tolerance = 1e-12, bool isParallel = true, int maxNumBoxes = 100000);
+
+        double
+        tolerance() const;
+
+        bool
+        isParallel() const;
+
+        int
+        maxNumBoxes() const;
+
+        // Solve f(x) = 0 for x within the given domain, returning solutions sorted
+        // lexicographically by their lower bounds. If more than the maximum number of
+        // boxes would need to be processed, the remaining unresolved boxes are returned as
+        // (non-unique) solutions.
+        template <class TValue, class TParameter>
+        std::vector<Solution<TParameter>>
+        solutions(
+            const ParametricExpression<TValue, TParameter>& expression,
+            const typename BoundsType<TParameter>::Type& domain
+        ) const;
+    };
+}
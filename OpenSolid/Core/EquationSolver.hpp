@@ -0,0 +1,93 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#pragma once
+
+#include <OpenSolid/config.hpp>
+
+#include <OpenSolid/Core/EquationSolver.definitions.hpp>
+
+#include <OpenSolid/Core/Box.hpp>
+#include <OpenSolid/Core/Interval.hpp>
+#include <OpenSolid/Core/MatrixView.hpp>
+#include <OpenSolid/Core/ParametricExpression.hpp>
+#include <OpenSolid/Core/Point.hpp>
+
+namespace opensolid
+{
+    inline
+    double
+    EquationSolver::tolerance() const {
+        return _tolerance;
+    }
+
+    inline
+    bool
+    EquationSolver::isParallel() const {
+        return _isParallel;
+    }
+
+    inline
+    int
+    EquationSolver::maxNumBoxes() const {
+        return _maxNumBoxes;
+    }
+
+    template <class TValue, class TParameter>
+    inline
+    std::vector<Solution<TParameter>>
+    EquationSolver::solutions(
+        const ParametricExpression<TValue, TParameter>& expression,
+        const typename BoundsType<TParameter>::Type& domain
+    ) const {
+        static const int NUM_DIMENSIONS = NumDimensions<TParameter>::Value;
+        static_assert(
+            NumDimensions<TValue>::Value == NUM_DIMENSIONS,
+            "Equation system must have as many components as parameters"
+        );
+
+        std::vector<Interval> solutionBounds;
+        std::vector<bool> solutionUniqueness;
+        solve(
+            *expression.compiledExpression(),
+            detail::constView(domain),
+            solutionBounds,
+            solutionUniqueness
+        );
+
+        std::vector<Solution<TParameter>> results(solutionUniqueness.size());
+        for (std::size_t index = 0; index < results.size(); ++index) {
+            Solution<TParameter>& solution = results[index];
+            IntervalMatrixViewXd boundsView = detail::mutableView(solution.bounds);
+            MatrixViewXd parameterView = detail::mutableView(solution.parameterValue);
+            for (int dimension = 0; dimension < NUM_DIMENSIONS; ++dimension) {
+                Interval bounds = solutionBounds[index * NUM_DIMENSIONS + dimension];
+                boundsView(dimension, 0) = bounds;
+                parameterView(dimension, 0) = bounds.median();
+            }
+            solution.isUnique = solutionUniqueness[index];
+        }
+        return results;
+    }
+}
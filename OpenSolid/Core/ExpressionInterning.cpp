@@ -0,0 +1,125 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#include <OpenSolid/Core/ExpressionInterning.hpp>
+
+#include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+namespace opensolid
+{
+    namespace
+    {
+        typedef std::unordered_multimap<
+            std::size_t,
+            std::weak_ptr<const detail::ExpressionImplementation>
+        > InterningMap;
+
+        struct InterningTable
+        {
+            std::atomic<bool> isEnabled;
+            std::mutex mutex;
+            InterningMap entries;
+            std::size_t purgeThreshold;
+
+            InterningTable() :
+                isEnabled(false),
+                purgeThreshold(1024) {
+            }
+
+            void
+            purge() {
+                auto iterator = entries.begin();
+                while (iterator != entries.end()) {
+                    if (iterator->second.expired()) {
+                        iterator = entries.erase(iterator);
+                    } else {
+                        ++iterator;
+                    }
+                }
+                // Purge again once the table has doubled in size, so that purging takes
+                // amortized constant time per insertion
+                purgeThreshold = std::max(std::size_t(1024), 2 * entries.size());
+            }
+        };
+
+        InterningTable&
+        interningTable() {
+            static InterningTable table;
+            return table;
+        }
+    }
+
+    void
+    ExpressionInterning::setEnabled(bool enabled) {
+        interningTable().isEnabled = enabled;
+    }
+
+    bool
+    ExpressionInterning::isEnabled() {
+        return interningTable().isEnabled;
+    }
+
+    int
+    ExpressionInterning::numEntries() {
+        InterningTable& table = interningTable();
+        std::lock_guard<std::mutex> lock(table.mutex);
+        return int(table.entries.size());
+    }
+
+    void
+    ExpressionInterning::clear() {
+        InterningTable& table = interningTable();
+        std::lock_guard<std::mutex> lock(table.mutex);
+        table.entries.clear();
+    }
+
+    detail::ExpressionImplementationPtr
+    ExpressionInterning::intern(const detail::ExpressionImplementationPtr& expressionPtr) {
+        InterningTable& table = interningTable();
+        if (!table.isEnabled) {
+            return expressionPtr;
+        }
+
+        std::size_t structuralHash = expressionPtr->structuralHash();
+        std::lock_guard<std::mutex> lock(table.mutex);
+        auto range = table.entries.equal_range(structuralHash);
+        for (auto iterator = range.first; iterator != range.second; ++iterator) {
+            detail::ExpressionImplementationPtr candidatePtr = iterator->second.lock();
+            if (candidatePtr && expressionPtr->isDuplicateOf(candidatePtr)) {
+                return candidatePtr;
+            }
+        }
+
+        if (table.entries.size() >= table.purgeThreshold) {
+            table.purge();
+        }
+        table.entries.insert(InterningMap::value_type(structuralHash, expressionPtr));
+        return expressionPtr;
+    }
+}
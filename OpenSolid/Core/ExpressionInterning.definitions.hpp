@@ -0,0 +1,70 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#pragma once
+
+#include <OpenSolid/config.hpp>
+
+#include <OpenSolid/Core/ExpressionInterning.declarations.hpp>
+
+#include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.declarations.hpp>
+
+namespace opensolid
+{
+    // Opt-in global interning of parametric expression nodes. When enabled, constructing an
+    // expression (via operators such as +, * or sin()) that is structurally identical to an
+    // existing live expression returns that existing expression instead of a new one, so that
+    // common subexpressions are automatically shared (and only evaluated once when compiled).
+    // The table only holds weak references, so interned expressions are still freed once they
+    // are no longer used.
+    class ExpressionInterning
+    {
+    public:
+        OPENSOLID_CORE_EXPORT
+        static void
+        setEnabled(bool enabled);
+
+        OPENSOLID_CORE_EXPORT
+        static bool
+        isEnabled();
+
+        // Number of entries in the interning table, including any whose expressions have
+        // been freed but not yet purged
+        OPENSOLID_CORE_EXPORT
+        static int
+        numEntries();
+
+        // Remove all entries from the interning table
+        OPENSOLID_CORE_EXPORT
+        static void
+        clear();
+
+        // Return an existing live duplicate of the given expression if there is one, otherwise
+        // add the given expression to the table and return it. Returns the given expression
+        // unchanged if interning is disabled.
+        OPENSOLID_CORE_EXPORT
+        static detail::ExpressionImplementationPtr
+        intern(const detail::ExpressionImplementationPtr& expressionPtr);
+    };
+}
@@ -26,4 +26,4 @@
 
 #include <OpenSolid/config.hpp>
 
-#include <OpenSolid/Core/ParametricExpression/EvaluationSequence.definitions.hpp>
+#include <OpenSolid/Core/ExpressionInterning.definitions.hpp>
@@ -0,0 +1,341 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#include <OpenSolid/Core/GlobalOptimizer.hpp>
+
+#include <OpenSolid/Core/Error.hpp>
+#include <OpenSolid/Core/ParametricExpression/CompiledExpression.hpp>
+#include <OpenSolid/Core/ThreadPool.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <vector>
+
+namespace opensolid
+{
+    namespace
+    {
+        struct Candidate
+        {
+            std::vector<Interval> box;
+            double lowerBound;
+        };
+
+        struct CandidateOrder
+        {
+            // Gives a priority queue with the smallest lower bound at the top
+            bool
+            operator()(const Candidate& firstCandidate, const Candidate& secondCandidate) const {
+                return firstCandidate.lowerBound > secondCandidate.lowerBound;
+            }
+        };
+
+        typedef std::priority_queue<Candidate, std::vector<Candidate>, CandidateOrder> Queue;
+
+        // Result of processing (sampling and bisecting) a single candidate
+        struct Subdivision
+        {
+            double sampleValue;
+            std::vector<double> sampleParameterValues;
+            std::vector<Candidate> children;
+
+            // Smallest lower bound of any child too small to be bisected further
+            double unresolvedLowerBound;
+        };
+
+        class Search
+        {
+        private:
+            const detail::CompiledExpression& _compiledExpression;
+            std::vector<Interval> _domain;
+            int _numParameters;
+
+            double
+            value(const std::vector<double>& parameterValues) const {
+                double result;
+                ConstMatrixViewXd parameterView(
+                    parameterValues.data(),
+                    _numParameters,
+                    1,
+                    _numParameters * sizeof(double)
+                );
+                MatrixViewXd resultView(&result, 1, 1, sizeof(double));
+                try {
+                    _compiledExpression.evaluate(parameterView, resultView);
+                } catch (const Error&) {
+                    return std::numeric_limits<double>::quiet_NaN();
+                }
+                return result;
+            }
+
+            // Evaluate the expression and its gradient over the given box in a single pass, use
+            // the gradient to shrink the box with the monotonicity test and then to bound the
+            // expression over the shrunk box using the mean value form (intersected with the
+            // natural bounds). Returns false if the box cannot contain the minimum at all.
+            bool
+            bound(std::vector<Interval>& box, double& lowerBound) const {
+                std::vector<Interval> results(_numParameters + 1);
+                ConstIntervalMatrixViewXd parameterView(
+                    box.data(),
+                    _numParameters,
+                    1,
+                    _numParameters * sizeof(Interval)
+                );
+                IntervalMatrixViewXd resultView(
+                    results.data(),
+                    _numParameters + 1,
+                    1,
+                    (_numParameters + 1) * sizeof(Interval)
+                );
+                try {
+                    _compiledExpression.evaluateWithJacobian(parameterView, resultView);
+                } catch (const Error&) {
+                    lowerBound = -std::numeric_limits<double>::infinity();
+                    return true;
+                }
+                Interval bounds = results[0];
+                const Interval* gradient = results.data() + 1;
+
+                for (int index = 0; index < _numParameters; ++index) {
+                    // If the expression is strictly increasing along this parameter, the
+                    // minimum can only be on the lower boundary of the domain (and similarly
+                    // for strictly decreasing)
+                    if (gradient[index].lowerBound() > 0.0) {
+                        if (box[index].lowerBound() > _domain[index].lowerBound()) {
+                            return false;
+                        }
+                        box[index] = box[index].lowerBound();
+                    } else if (gradient[index].upperBound() < 0.0) {
+                        if (box[index].upperBound() < _domain[index].upperBound()) {
+                            return false;
+                        }
+                        box[index] = box[index].upperBound();
+                    }
+                }
+                if (bounds.isEmpty()) {
+                    // Expression is undefined everywhere in the box
+                    lowerBound = std::numeric_limits<double>::infinity();
+                    return true;
+                }
+
+                // Gradient bounds over the original box remain valid over the shrunk box, so
+                // only the value at the center of the shrunk box needs to be evaluated
+                std::vector<Interval> center(_numParameters);
+                for (int index = 0; index < _numParameters; ++index) {
+                    center[index] = box[index].median();
+                }
+                Interval centered;
+                ConstIntervalMatrixViewXd centerView(
+                    center.data(),
+                    _numParameters,
+                    1,
+                    _numParameters * sizeof(Interval)
+                );
+                IntervalMatrixViewXd centeredView(&centered, 1, 1, sizeof(Interval));
+                bool hasCenterValue = true;
+                try {
+                    _compiledExpression.evaluate(centerView, centeredView);
+                } catch (const Error&) {
+                    hasCenterValue = false;
+                }
+                if (hasCenterValue) {
+                    for (int index = 0; index < _numParameters; ++index) {
+                        centered += gradient[index] * (box[index] - center[index]);
+                    }
+                    // Both enclosures are valid, so their intersection is too; it can only be
+                    // empty due to rounding error
+                    Interval intersection = bounds.intersection(centered);
+                    if (!intersection.isEmpty()) {
+                        bounds = intersection;
+                    }
+                }
+                lowerBound = bounds.lowerBound();
+                return true;
+            }
+        public:
+            Search(
+                const detail::CompiledExpression& compiledExpression,
+                const ConstIntervalMatrixViewXd& domainView
+            ) : _compiledExpression(compiledExpression),
+                _domain(domainView.numRows()),
+                _numParameters(domainView.numRows()) {
+
+                for (int index = 0; index < _numParameters; ++index) {
+                    _domain[index] = domainView(index, 0);
+                }
+            }
+
+            const std::vector<Interval>&
+            domain() const {
+                return _domain;
+            }
+
+            bool
+            initialCandidate(Candidate& candidate) const {
+                candidate.box = _domain;
+                return bound(candidate.box, candidate.lowerBound);
+            }
+
+            void
+            subdivide(const Candidate& candidate, Subdivision& subdivision) const {
+                const std::vector<Interval>& box = candidate.box;
+                subdivision.sampleParameterValues.resize(_numParameters);
+                int splitIndex = -1;
+                double maxWidth = 0.0;
+                for (int index = 0; index < _numParameters; ++index) {
+                    double median = box[index].median();
+                    subdivision.sampleParameterValues[index] = median;
+                    double width = box[index].width();
+                    // Don't bisect intervals that can no longer be split in floating point
+                    double minWidth = 4 * std::numeric_limits<double>::epsilon() * (
+                        1.0 + std::abs(median)
+                    );
+                    if (width > maxWidth && width > minWidth) {
+                        maxWidth = width;
+                        splitIndex = index;
+                    }
+                }
+                subdivision.sampleValue = value(subdivision.sampleParameterValues);
+                subdivision.children.clear();
+                subdivision.unresolvedLowerBound = std::numeric_limits<double>::infinity();
+                if (splitIndex < 0) {
+                    subdivision.unresolvedLowerBound = candidate.lowerBound;
+                    return;
+                }
+
+                std::pair<Interval, Interval> halves = box[splitIndex].bisected();
+                for (int childIndex = 0; childIndex < 2; ++childIndex) {
+                    Candidate child;
+                    child.box = box;
+                    child.box[splitIndex] = childIndex == 0 ? halves.first : halves.second;
+                    double childLowerBound;
+                    if (bound(child.box, childLowerBound)) {
+                        // Bounds of a child are never worse than those of its parent
+                        child.lowerBound = std::max(childLowerBound, candidate.lowerBound);
+                        subdivision.children.push_back(std::move(child));
+                    }
+                }
+            }
+        };
+    }
+
+    GlobalOptimizer::GlobalOptimizer(double tolerance, bool isParallel, int maxNumIterations) :
+        _tolerance(tolerance),
+        _isParallel(isParallel),
+        _maxNumIterations(maxNumIterations) {
+
+        if (tolerance < 0.0 || maxNumIterations < 1) {
+            throw Error(new PlaceholderError());
+        }
+    }
+
+    void
+    GlobalOptimizer::minimize(
+        const detail::CompiledExpression& compiledExpression,
+        const ConstIntervalMatrixViewXd& domainView,
+        Interval& value,
+        MatrixViewXd& parameterView
+    ) const {
+        Search search(compiledExpression, domainView);
+        int numParameters = domainView.numRows();
+        double infinity = std::numeric_limits<double>::infinity();
+
+        double upperBound = infinity;
+        double unresolvedLowerBound = infinity;
+        std::vector<double> bestParameterValues(numParameters);
+        for (int index = 0; index < numParameters; ++index) {
+            bestParameterValues[index] = search.domain()[index].median();
+        }
+
+        Queue queue;
+        Candidate initialCandidate;
+        if (search.initialCandidate(initialCandidate)) {
+            queue.push(std::move(initialCandidate));
+        }
+
+        ThreadPool& threadPool = ThreadPool::global();
+        int batchSize = _isParallel ? 4 * threadPool.numThreads() : 1;
+        std::vector<Candidate> batch;
+        std::vector<Subdivision> subdivisions;
+        int numIterations = 0;
+        while (!queue.empty() && numIterations < _maxNumIterations) {
+            // Once no remaining candidate can improve on the best value found so far by more
+            // than the tolerance, the minimum is known to sufficient accuracy
+            if (queue.top().lowerBound >= upperBound - _tolerance) {
+                break;
+            }
+            batch.clear();
+            while (!queue.empty() && int(batch.size()) < batchSize) {
+                if (queue.top().lowerBound >= upperBound - _tolerance) {
+                    break;
+                }
+                batch.push_back(queue.top());
+                queue.pop();
+            }
+            int numCandidates = int(batch.size());
+            subdivisions.resize(numCandidates);
+            if (numCandidates > 1) {
+                threadPool.parallelFor(
+                    numCandidates,
+                    1,
+                    [&search, &batch, &subdivisions] (int begin, int end) {
+                        for (int index = begin; index < end; ++index) {
+                            search.subdivide(batch[index], subdivisions[index]);
+                        }
+                    }
+                );
+            } else {
+                search.subdivide(batch[0], subdivisions[0]);
+            }
+            numIterations += numCandidates;
+
+            for (int index = 0; index < numCandidates; ++index) {
+                const Subdivision& subdivision = subdivisions[index];
+                if (subdivision.sampleValue < upperBound) {
+                    upperBound = subdivision.sampleValue;
+                    bestParameterValues = subdivision.sampleParameterValues;
+                }
+                unresolvedLowerBound = std::min(
+                    unresolvedLowerBound,
+                    subdivision.unresolvedLowerBound
+                );
+            }
+            for (int index = 0; index < numCandidates; ++index) {
+                for (const Candidate& child : subdivisions[index].children) {
+                    if (child.lowerBound <= upperBound) {
+                        queue.push(child);
+                    }
+                }
+            }
+        }
+
+        double lowerBound = queue.empty() ? upperBound : queue.top().lowerBound;
+        lowerBound = std::min(lowerBound, std::min(unresolvedLowerBound, upperBound));
+        value = Interval(lowerBound, upperBound);
+        for (int index = 0; index < numParameters; ++index) {
+            parameterView(index, 0) = bestParameterValues[index];
+        }
+    }
+}
@@ -0,0 +1,107 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#pragma once
+
+#include <OpenSolid/config.hpp>
+
+#include <OpenSolid/Core/GlobalOptimizer.declarations.hpp>
+
+#include <OpenSolid/Core/BoundsType.declarations.hpp>
+#include <OpenSolid/Core/Interval.definitions.hpp>
+#include <OpenSolid/Core/MatrixView.declarations.hpp>
+#include <OpenSolid/Core/ParametricExpression.declarations.hpp>
+#include <OpenSolid/Core/ParametricExpression/CompiledExpression.declarations.hpp>
+
+namespace opensolid
+{
+    template <class TParameter>
+    struct Extremum
+    {
+        // Guaranteed to contain the global minimum or maximum (up to floating-point rounding
+        // error); its width is at most the optimizer tolerance unless the iteration limit was
+        // reached first
+        Interval value;
+
+        // Parameter value at which the best value (the upper bound of 'value' for minimization,
+        // the lower bound for maximization) was found
+        TParameter parameterValue;
+    };
+
+    // Branch-and-bound search for the guaranteed global minimum or maximum of a scalar
+    // expression over a parameter domain. Candidate boxes are processed best-first (smallest
+    // lower bound first), and are discarded when their interval bounds show that they cannot
+    // contain a better value than one already found, or when the interval Jacobian shows that
+    // the expression is monotonic over them (only boxes touching the boundary of the domain
+    // can then contain the extremum, and those are collapsed onto the boundary). In parallel
+    // mode, batches of the most promising boxes are processed concurrently on the global
+    // thread pool.
+    class GlobalOptimizer
+    {
+    private:
+        double _tolerance;
+        bool _isParallel;
+        int _maxNumIterations;
+
+        OPENSOLID_CORE_EXPORT
+        void
+        minimize(
+            const detail::CompiledExpression& compiledExpression,
+            const MatrixView<const Interval, -1, -1, -1>& domainView,
+            Interval& value,
+            MatrixView<double, -1, -1, -1>& parameterView
+        ) const;
+    public:
+        OPENSOLID_CORE_EXPORT
+        explicit
+        GlobalOptimizer(
+            double tolerance = 1e-9,
+            bool isParallel = true,
+            int maxNumIterations = 100000
+        );
+
+        double
+        tolerance() const;
+
+        bool
+        isParallel() const;
+
+        int
+        maxNumIterations() const;
+
+        template <class TParameter>
+        Extremum<TParameter>
+        minimum(
+            const ParametricExpression<double, TParameter>& expression,
+            const typename BoundsType<TParameter>::Type& domain
+        ) const;
+
+        template <class TParameter>
+        Extremum<TParameter>
+        maximum(
+            const ParametricExpression<double, TParameter>& expression,
+            const typename BoundsType<TParameter>::Type& domain
+        ) const;
+    };
+}
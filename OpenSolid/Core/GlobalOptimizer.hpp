@@ -0,0 +1,82 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#pragma once
+
+#include <OpenSolid/config.hpp>
+
+#include <OpenSolid/Core/GlobalOptimizer.definitions.hpp>
+
+#include <OpenSolid/Core/Box.hpp>
+#include <OpenSolid/Core/Interval.hpp>
+#include <OpenSolid/Core/MatrixView.hpp>
+#include <OpenSolid/Core/ParametricExpression.hpp>
+#include <OpenSolid/Core/Point.hpp>
+
+namespace opensolid
+{
+    inline
+    double
+    GlobalOptimizer::tolerance() const {
+        return _tolerance;
+    }
+
+    inline
+    bool
+    GlobalOptimizer::isParallel() const {
+        return _isParallel;
+    }
+
+    inline
+    int
+    GlobalOptimizer::maxNumIterations() const {
+        return _maxNumIterations;
+    }
+
+    template <class TParameter>
+    inline
+    Extremum<TParameter>
+    GlobalOptimizer::minimum(
+        const ParametricExpression<double, TParameter>& expression,
+        const typename BoundsType<TParameter>::Type& domain
+    ) const {
+        Extremum<TParameter> result;
+        ConstIntervalMatrixViewXd domainView = detail::constView(domain);
+        MatrixViewXd parameterView = detail::mutableView(result.parameterValue);
+        minimize(*expression.compiledExpression(), domainView, result.value, parameterView);
+        return result;
+    }
+
+    template <class TParameter>
+    inline
+    Extremum<TParameter>
+    GlobalOptimizer::maximum(
+        const ParametricExpression<double, TParameter>& expression,
+        const typename BoundsType<TParameter>::Type& domain
+    ) const {
+        Extremum<TParameter> result = minimum(-expression, domain);
+        result.value = -result.value;
+        return result;
+    }
+}
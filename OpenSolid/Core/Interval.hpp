@@ -492,7 +492,9 @@ namespace opensolid
     inline
     Interval
     operator/(double value, Interval interval) {
-        if (interval.lowerBound() >= 0.0 || interval.upperBound() <= 0.0) {
+        if (interval.isEmpty()) {
+            return Interval::EMPTY();
+        } else if (interval.lowerBound() > 0.0 || interval.upperBound() < 0.0) {
             if (value > 0.0) {
                 return Interval(value / interval.upperBound(), value / interval.lowerBound());
             } else if (value < 0.0) {
@@ -500,12 +502,8 @@ namespace opensolid
             } else {
                 return 0.0;
             }
-        } else if (interval.isEmpty()) {
-            return Interval::EMPTY();
-        } else if (value == 0.0) {
-            return 0.0;
         } else {
-            return Interval::WHOLE();
+            return Interval(value) / interval;
         }
     }
 
@@ -528,18 +526,42 @@ namespace opensolid
     inline
     Interval
     operator/(Interval firstInterval, Interval secondInterval) {
-        if (secondInterval.lowerBound() >= 0.0 || secondInterval.upperBound() <= 0.0) {
+        if (firstInterval.isEmpty() || secondInterval.isEmpty()) {
+            return Interval::EMPTY();
+        } else if (secondInterval.lowerBound() > 0.0 || secondInterval.upperBound() < 0.0) {
             Interval reciprocal(
                 1.0 / secondInterval.upperBound(),
                 1.0 / secondInterval.lowerBound()
             );
             return firstInterval * reciprocal;
-        } else if (firstInterval.isEmpty() || secondInterval.isEmpty()) {
-            return Interval::EMPTY();
         } else if (firstInterval == 0.0) {
             return 0.0;
-        } else {
+        } else if (firstInterval.lowerBound() <= 0.0 && firstInterval.upperBound() >= 0.0) {
+            return Interval::WHOLE();
+        } else if (secondInterval.lowerBound() < 0.0 && secondInterval.upperBound() > 0.0) {
             return Interval::WHOLE();
+        } else if (secondInterval.lowerBound() == 0.0 && secondInterval.upperBound() == 0.0) {
+            return Interval::WHOLE();
+        }
+
+        // Divisor touches zero at one end only, and the dividend has a single sign, so the
+        // quotient is unbounded in one direction and its finite bound comes from the dividend
+        // bound nearest zero (signs are determined explicitly so that they do not depend on the
+        // sign of the zero divisor bound)
+        bool positiveDividend = firstInterval.lowerBound() > 0.0;
+        bool positiveDivisor = secondInterval.upperBound() > 0.0;
+        double nearestDividend = (
+            positiveDividend ? firstInterval.lowerBound() : firstInterval.upperBound()
+        );
+        double nonzeroDivisor = (
+            positiveDivisor ? secondInterval.upperBound() : secondInterval.lowerBound()
+        );
+        double bound = nearestDividend / nonzeroDivisor;
+        double infinity = std::numeric_limits<double>::infinity();
+        if (positiveDividend == positiveDivisor) {
+            return Interval(bound, infinity);
+        } else {
+            return Interval(-infinity, bound);
         }
     }
 
@@ -130,6 +130,7 @@ namespace opensolid
     typedef MatrixView<const double, -1, -1, -1> ConstMatrixViewXd;
     typedef MatrixView<Interval, -1, -1, -1> IntervalMatrixViewXd;
     typedef MatrixView<const Interval, -1, -1, -1> ConstIntervalMatrixViewXd;
+    typedef MatrixView<float, -1, -1, -1> MatrixViewXf;
 
     template <class TScalar, int iNumRows, int iNumColumns, int iColumnStrideInBytes>
     struct MatrixTraits<MatrixView<TScalar, iNumRows, iNumColumns, iColumnStrideInBytes>>
@@ -0,0 +1,494 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#include <OpenSolid/Core/NativeCode.hpp>
+
+#include <OpenSolid/Core/Error.hpp>
+#include <OpenSolid/Core/ParametricExpression/Bytecode/Bytecode.hpp>
+#include <OpenSolid/Core/ParametricExpression/Bytecode/Compiler.hpp>
+#include <OpenSolid/Core/ParametricExpression/Bytecode/Evaluator.hpp>
+#include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
+
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace opensolid
+{
+    namespace
+    {
+        struct Registration
+        {
+            std::vector<int> integerData;
+            std::vector<double> doubleData;
+            NativeCode::DoubleFunction doubleFunction;
+            NativeCode::IntervalFunction intervalFunction;
+        };
+
+        // Several registrations may share a fingerprint; they are distinguished by their data
+        typedef std::unordered_multimap<std::uint64_t, Registration> FunctionMap;
+
+        struct FunctionRegistry
+        {
+            std::mutex mutex;
+            FunctionMap functions;
+        };
+
+        FunctionRegistry&
+        registry() {
+            static FunctionRegistry instance;
+            return instance;
+        }
+
+        // Everything generated functions depend on, other than floating-point values: sizes,
+        // instructions and register indices
+        std::vector<int>
+        integerData(const detail::Evaluator& evaluator) {
+            std::vector<int> results;
+            results.push_back(evaluator.numParameters());
+            results.push_back(evaluator.numRegisters());
+            results.push_back(int(evaluator.instructions().size()));
+            results.insert(
+                results.end(),
+                evaluator.instructions().begin(),
+                evaluator.instructions().end()
+            );
+            results.push_back(int(evaluator.literals().size()));
+            results.push_back(int(evaluator.constantRegisters().size()));
+            results.insert(
+                results.end(),
+                evaluator.constantRegisters().begin(),
+                evaluator.constantRegisters().end()
+            );
+            results.push_back(int(evaluator.resultRegisters().size()));
+            results.insert(
+                results.end(),
+                evaluator.resultRegisters().begin(),
+                evaluator.resultRegisters().end()
+            );
+            return results;
+        }
+
+        // Literal and constant values used by generated functions
+        std::vector<double>
+        doubleData(const detail::Evaluator& evaluator) {
+            std::vector<double> results(evaluator.literals());
+            results.insert(
+                results.end(),
+                evaluator.constantValues().begin(),
+                evaluator.constantValues().end()
+            );
+            return results;
+        }
+
+        std::string
+        literal(double value) {
+            // Infinities and NaNs have no literal representation, so use the standard library
+            // constants (keeping the sign bit, which negation in the generated code preserves)
+            if (std::isinf(value) || std::isnan(value)) {
+                std::string result = std::signbit(value) ? "-" : "";
+                result += "std::numeric_limits<double>::";
+                result += std::isinf(value) ? "infinity()" : "quiet_NaN()";
+                return result;
+            }
+            // 17 significant digits are enough to exactly reproduce any double; always include a
+            // decimal point or exponent so that the literal is never interpreted as an integer
+            std::ostringstream stream;
+            stream << std::setprecision(17) << value;
+            std::string result = stream.str();
+            if (result.find_first_of(".e") == std::string::npos) {
+                result += ".0";
+            }
+            return result;
+        }
+
+        // Compares data exactly: NaNs match each other (unlike with ==, so that bytecode
+        // containing NaN constants can still be matched) and negative zero does not match
+        // positive zero
+        bool
+        identicalData(const std::vector<double>& first, const std::vector<double>& second) {
+            if (first.size() != second.size()) {
+                return false;
+            }
+            for (std::size_t index = 0; index < first.size(); ++index) {
+                double firstValue = first[index];
+                double secondValue = second[index];
+                if (std::isnan(firstValue) || std::isnan(secondValue)) {
+                    if (!(std::isnan(firstValue) && std::isnan(secondValue))) {
+                        return false;
+                    }
+                } else if (std::memcmp(&firstValue, &secondValue, sizeof(double)) != 0) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        std::string
+        reg(int registerIndex) {
+            return "r" + std::to_string(registerIndex);
+        }
+
+        const char*
+        unaryFunctionName(detail::Bytecode::Instruction instruction) {
+            switch (instruction) {
+            case detail::Bytecode::SQUARE:
+                return "opensolid::detail::square";
+            case detail::Bytecode::SQRT:
+                return "opensolid::detail::squareRoot";
+            case detail::Bytecode::SIN:
+                return "opensolid::sin";
+            case detail::Bytecode::COS:
+                return "opensolid::cos";
+            case detail::Bytecode::TAN:
+                return "opensolid::tan";
+            case detail::Bytecode::ASIN:
+                return "opensolid::detail::arcsine";
+            case detail::Bytecode::ACOS:
+                return "opensolid::detail::arccosine";
+            case detail::Bytecode::EXP:
+                return "opensolid::exp";
+            case detail::Bytecode::LOG:
+                return "opensolid::log";
+            default:
+                assert(false);
+                return "";
+            }
+        }
+
+        const char*
+        binaryOperatorSymbol(detail::Bytecode::Instruction instruction) {
+            switch (instruction) {
+            case detail::Bytecode::ADD:
+                return "+";
+            case detail::Bytecode::SUBTRACT:
+                return "-";
+            case detail::Bytecode::MULTIPLY:
+                return "*";
+            case detail::Bytecode::DIVIDE:
+                return "/";
+            default:
+                assert(false);
+                return "";
+            }
+        }
+
+        // Emit a function template performing the same operations as the given evaluator, with
+        // each register stored in its own local variable (the compiler never writes to the same
+        // register twice, so every local can be const)
+        void
+        generateFunction(
+            std::ostream& stream,
+            const detail::Evaluator& evaluator,
+            const std::string& functionName
+        ) {
+            const std::vector<int>& instructions = evaluator.instructions();
+
+            std::unordered_set<int> usedRegisters;
+            for (std::size_t index = 0; index < instructions.size();) {
+                detail::Bytecode::Instruction instruction =
+                    detail::Bytecode::Instruction(instructions[index]);
+                int numOperands = detail::Bytecode::numOperands(instruction);
+                usedRegisters.insert(instructions[index + 1]);
+                bool secondOperandIsRegister = (
+                    numOperands == 3 &&
+                    instruction != detail::Bytecode::CONSTANT_POW &&
+                    instruction != detail::Bytecode::INTEGER_POW
+                );
+                if (secondOperandIsRegister) {
+                    usedRegisters.insert(instructions[index + 2]);
+                }
+                index += 1 + numOperands;
+            }
+            usedRegisters.insert(
+                evaluator.resultRegisters().begin(),
+                evaluator.resultRegisters().end()
+            );
+
+            stream << "template <class TScalar>" << std::endl;
+            stream << "inline" << std::endl;
+            stream << "void" << std::endl;
+            stream << functionName << "(const TScalar* parameters, TScalar* results) {";
+            stream << std::endl;
+
+            int numParameters = evaluator.numParameters();
+            for (int parameterIndex = 0; parameterIndex < numParameters; ++parameterIndex) {
+                if (usedRegisters.count(parameterIndex)) {
+                    stream << "    const TScalar " << reg(parameterIndex) << " = parameters[";
+                    stream << parameterIndex << "];" << std::endl;
+                }
+            }
+
+            const std::vector<int>& constantRegisters = evaluator.constantRegisters();
+            const std::vector<double>& constantValues = evaluator.constantValues();
+            for (std::size_t index = 0; index < constantRegisters.size(); ++index) {
+                if (usedRegisters.count(constantRegisters[index])) {
+                    stream << "    const TScalar " << reg(constantRegisters[index]);
+                    stream << " = TScalar(" << literal(constantValues[index]) << ");" << std::endl;
+                }
+            }
+
+            for (std::size_t index = 0; index < instructions.size();) {
+                detail::Bytecode::Instruction instruction =
+                    detail::Bytecode::Instruction(instructions[index]);
+                const int* operands = &instructions[index + 1];
+                int resultRegister = -1;
+                switch (instruction) {
+                case detail::Bytecode::NEGATE:
+                    resultRegister = operands[1];
+                    stream << "    const TScalar " << reg(resultRegister) << " = -";
+                    stream << reg(operands[0]) << ";" << std::endl;
+                    break;
+                case detail::Bytecode::ADD:
+                case detail::Bytecode::SUBTRACT:
+                case detail::Bytecode::MULTIPLY:
+                case detail::Bytecode::DIVIDE:
+                    resultRegister = operands[2];
+                    stream << "    const TScalar " << reg(resultRegister) << " = ";
+                    stream << reg(operands[0]) << " " << binaryOperatorSymbol(instruction) << " ";
+                    stream << reg(operands[1]) << ";" << std::endl;
+                    break;
+                case detail::Bytecode::POW:
+                    resultRegister = operands[2];
+                    stream << "    const TScalar " << reg(resultRegister) << " = opensolid::pow(";
+                    stream << reg(operands[0]) << ", " << reg(operands[1]) << ");" << std::endl;
+                    break;
+                case detail::Bytecode::CONSTANT_POW:
+                    resultRegister = operands[2];
+                    stream << "    const TScalar " << reg(resultRegister) << " = opensolid::pow(";
+                    stream << reg(operands[0]) << ", ";
+                    stream << literal(evaluator.literals()[operands[1]]) << ");" << std::endl;
+                    break;
+                case detail::Bytecode::INTEGER_POW:
+                    resultRegister = operands[2];
+                    stream << "    const TScalar " << reg(resultRegister) << " = opensolid::pow(";
+                    stream << reg(operands[0]) << ", " << operands[1] << ");" << std::endl;
+                    break;
+                case detail::Bytecode::CHECK_NONZERO:
+                    stream << "    opensolid::detail::checkNonZero(" << reg(operands[0]) << ");";
+                    stream << std::endl;
+                    break;
+                default:
+                    resultRegister = operands[1];
+                    stream << "    const TScalar " << reg(resultRegister) << " = ";
+                    stream << unaryFunctionName(instruction) << "(" << reg(operands[0]) << ");";
+                    stream << std::endl;
+                    break;
+                }
+                if (resultRegister >= 0 && !usedRegisters.count(resultRegister)) {
+                    stream << "    static_cast<void>(" << reg(resultRegister) << ");" << std::endl;
+                }
+                index += 1 + detail::Bytecode::numOperands(instruction);
+            }
+
+            const std::vector<int>& resultRegisters = evaluator.resultRegisters();
+            for (std::size_t index = 0; index < resultRegisters.size(); ++index) {
+                stream << "    results[" << index << "] = " << reg(resultRegisters[index]) << ";";
+                stream << std::endl;
+            }
+            stream << "}" << std::endl << std::endl;
+        }
+
+        // Emit a braced list of values, a fixed number per line
+        template <class TValue, class TFormat>
+        void
+        generateList(std::ostream& stream, const std::vector<TValue>& values, TFormat format) {
+            const std::size_t valuesPerLine = 8;
+            stream << "        {";
+            for (std::size_t index = 0; index < values.size(); ++index) {
+                if (index % valuesPerLine == 0) {
+                    stream << std::endl << "            ";
+                } else {
+                    stream << " ";
+                }
+                stream << format(values[index]);
+                if (index + 1 < values.size()) {
+                    stream << ",";
+                }
+            }
+            if (!values.empty()) {
+                stream << std::endl << "        ";
+            }
+            stream << "}," << std::endl;
+        }
+
+        void
+        generateRegistration(
+            std::ostream& stream,
+            const detail::Evaluator& evaluator,
+            const std::string& functionName
+        ) {
+            stream << "    opensolid::NativeCode::registerFunctions(" << std::endl;
+            stream << "        " << evaluator.fingerprint() << "ULL," << std::endl;
+            generateList(
+                stream,
+                integerData(evaluator),
+                [] (int value) {
+                    return std::to_string(value);
+                }
+            );
+            generateList(stream, doubleData(evaluator), literal);
+            stream << "        &" << functionName << "<double>," << std::endl;
+            stream << "        &" << functionName << "<opensolid::Interval>" << std::endl;
+            stream << "    );" << std::endl;
+        }
+    }
+
+    std::string
+    NativeCode::generate(
+        const detail::ExpressionImplementationPtr& expressionPtr,
+        const std::string& name
+    ) {
+        detail::Evaluator valueEvaluator = detail::Compiler::compile(expressionPtr);
+        detail::Evaluator jacobianEvaluator = detail::Compiler::compileJacobian(expressionPtr);
+        detail::Evaluator valueAndJacobianEvaluator =
+            detail::Compiler::compileWithJacobian(expressionPtr);
+        if (!valueEvaluator.splineCalls().empty()) {
+            // Spline data is not embedded in generated code
+            throw Error(new PlaceholderError());
+        }
+
+        std::ostringstream stream;
+        stream << "// Generated by opensolid::NativeCode::generate(); do not edit" << std::endl;
+        stream << std::endl;
+        stream << "#include <OpenSolid/Core/NativeCode.hpp>" << std::endl;
+        stream << std::endl;
+        stream << "#include <limits>" << std::endl;
+        stream << std::endl;
+        generateFunction(stream, valueEvaluator, name + "_value");
+        generateFunction(stream, jacobianEvaluator, name + "_jacobian");
+        generateFunction(stream, valueAndJacobianEvaluator, name + "_valueAndJacobian");
+
+        stream << "inline" << std::endl;
+        stream << "void" << std::endl;
+        stream << name << "_register() {" << std::endl;
+        generateRegistration(stream, valueEvaluator, name + "_value");
+        generateRegistration(stream, jacobianEvaluator, name + "_jacobian");
+        generateRegistration(stream, valueAndJacobianEvaluator, name + "_valueAndJacobian");
+        stream << "}" << std::endl;
+        return stream.str();
+    }
+
+    void
+    NativeCode::registerFunctions(
+        std::uint64_t fingerprint,
+        const std::vector<int>& integerData,
+        const std::vector<double>& doubleData,
+        DoubleFunction doubleFunction,
+        IntervalFunction intervalFunction
+    ) {
+        FunctionRegistry& instance = registry();
+        std::lock_guard<std::mutex> lock(instance.mutex);
+        auto range = instance.functions.equal_range(fingerprint);
+        for (auto iterator = range.first; iterator != range.second; ++iterator) {
+            Registration& registration = iterator->second;
+            bool sameBytecode = (
+                registration.integerData == integerData &&
+                identicalData(registration.doubleData, doubleData)
+            );
+            if (sameBytecode) {
+                // Replace existing registration for the same bytecode
+                registration.doubleFunction = doubleFunction;
+                registration.intervalFunction = intervalFunction;
+                return;
+            }
+        }
+        Registration registration;
+        registration.integerData = integerData;
+        registration.doubleData = doubleData;
+        registration.doubleFunction = doubleFunction;
+        registration.intervalFunction = intervalFunction;
+        instance.functions.insert(std::make_pair(fingerprint, std::move(registration)));
+    }
+
+    void
+    NativeCode::registerFunctions(
+        const detail::Evaluator& evaluator,
+        DoubleFunction doubleFunction,
+        IntervalFunction intervalFunction
+    ) {
+        registerFunctions(
+            evaluator.fingerprint(),
+            integerData(evaluator),
+            doubleData(evaluator),
+            doubleFunction,
+            intervalFunction
+        );
+    }
+
+    bool
+    NativeCode::find(
+        const detail::Evaluator& evaluator,
+        DoubleFunction& doubleFunction,
+        IntervalFunction& intervalFunction
+    ) {
+        if (!evaluator.splineCalls().empty()) {
+            // Generated code never contains splines, and spline data is not part of the data
+            // compared below
+            return false;
+        }
+        FunctionRegistry& instance = registry();
+        std::lock_guard<std::mutex> lock(instance.mutex);
+        auto range = instance.functions.equal_range(evaluator.fingerprint());
+        if (range.first == range.second) {
+            return false;
+        }
+        std::vector<int> evaluatorIntegerData = integerData(evaluator);
+        std::vector<double> evaluatorDoubleData = doubleData(evaluator);
+        for (auto iterator = range.first; iterator != range.second; ++iterator) {
+            const Registration& registration = iterator->second;
+            if (registration.integerData != evaluatorIntegerData) {
+                continue;
+            }
+            if (!identicalData(registration.doubleData, evaluatorDoubleData)) {
+                continue;
+            }
+            doubleFunction = registration.doubleFunction;
+            intervalFunction = registration.intervalFunction;
+            return true;
+        }
+        // Fingerprint collision with different bytecode
+        return false;
+    }
+
+    int
+    NativeCode::numRegisteredFunctions() {
+        FunctionRegistry& instance = registry();
+        std::lock_guard<std::mutex> lock(instance.mutex);
+        return int(instance.functions.size());
+    }
+
+    void
+    NativeCode::clear() {
+        FunctionRegistry& instance = registry();
+        std::lock_guard<std::mutex> lock(instance.mutex);
+        instance.functions.clear();
+    }
+}
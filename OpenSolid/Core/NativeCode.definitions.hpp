@@ -0,0 +1,114 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#pragma once
+
+#include <OpenSolid/config.hpp>
+
+#include <OpenSolid/Core/NativeCode.declarations.hpp>
+
+#include <OpenSolid/Core/Interval.declarations.hpp>
+#include <OpenSolid/Core/ParametricExpression.declarations.hpp>
+#include <OpenSolid/Core/ParametricExpression/Bytecode/Evaluator.declarations.hpp>
+#include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.declarations.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace opensolid
+{
+    // Ahead-of-time generation of native C++ code for parametric expressions. generate()
+    // produces a self-contained C++ source fragment containing straight-line functions that
+    // compute the value, Jacobian, and value plus Jacobian of an expression (for both double
+    // and Interval parameters), along with a function that registers them. Once registered,
+    // any compiled expression whose bytecode matches one of the generated functions calls the
+    // native function instead of interpreting the bytecode. Functions are looked up by a
+    // fingerprint of the bytecode, but the complete bytecode is stored with each registration
+    // and compared on lookup, so a fingerprint collision can never select the wrong function.
+    // Expressions whose bytecode does not match, for instance because the generated code is from
+    // a different version of this library, silently fall back to interpretation.
+    class NativeCode
+    {
+    public:
+        typedef void (*DoubleFunction)(const double*, double*);
+        typedef void (*IntervalFunction)(const Interval*, Interval*);
+
+        // Generate source code for the given expression. The generated functions are named
+        // name_value, name_jacobian and name_valueAndJacobian, and are registered by calling
+        // name_register(). Throws for expressions containing B-splines.
+        OPENSOLID_CORE_EXPORT
+        static std::string
+        generate(const detail::ExpressionImplementationPtr& expressionPtr, const std::string& name);
+
+        template <class TValue, class TParameter>
+        static std::string
+        generate(
+            const ParametricExpression<TValue, TParameter>& expression,
+            const std::string& name
+        );
+
+        // Register native functions for the bytecode with the given fingerprint. integerData and
+        // doubleData hold the complete bytecode in the layout produced by generate(); they are
+        // compared against the bytecode of each evaluator with a matching fingerprint.
+        OPENSOLID_CORE_EXPORT
+        static void
+        registerFunctions(
+            std::uint64_t fingerprint,
+            const std::vector<int>& integerData,
+            const std::vector<double>& doubleData,
+            DoubleFunction doubleFunction,
+            IntervalFunction intervalFunction
+        );
+
+        // Register native functions for the bytecode of the given evaluator
+        OPENSOLID_CORE_EXPORT
+        static void
+        registerFunctions(
+            const detail::Evaluator& evaluator,
+            DoubleFunction doubleFunction,
+            IntervalFunction intervalFunction
+        );
+
+        // Look up the registered functions for the given evaluator, returning false if there are
+        // none whose bytecode exactly matches that of the evaluator
+        OPENSOLID_CORE_EXPORT
+        static bool
+        find(
+            const detail::Evaluator& evaluator,
+            DoubleFunction& doubleFunction,
+            IntervalFunction& intervalFunction
+        );
+
+        OPENSOLID_CORE_EXPORT
+        static int
+        numRegisteredFunctions();
+
+        // Remove all registered functions. Expressions that have already been compiled keep
+        // using any native functions they were compiled with.
+        OPENSOLID_CORE_EXPORT
+        static void
+        clear();
+    };
+}
@@ -0,0 +1,164 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#include <OpenSolid/Core/ParametricCurve/CurveTessellator.hpp>
+
+#include <OpenSolid/Core/Error.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace opensolid
+{
+    namespace
+    {
+        // Intervals needing more uniform segments than this are bisected instead, since
+        // bounds over each half will usually be tighter
+        const int MAX_UNIFORM_SEGMENTS = 8;
+
+        // Intervals narrower than this fraction of the domain are never bisected further
+        const double MIN_RELATIVE_WIDTH = 1e-9;
+
+        // Segment counts above this are treated as unknown, to avoid integer overflow
+        const double MAX_SEGMENT_COUNT = 1e9;
+
+        // Parameter interval along with the number of uniform segments to split it into
+        typedef std::pair<Interval, int> Segment;
+    }
+
+    namespace detail
+    {
+        int
+        CurveTessellator::numSegments(
+            double width,
+            Interval squaredSpeedBounds,
+            Interval squaredAccelerationBounds
+        ) const {
+            double maxSquaredAcceleration = std::max(squaredAccelerationBounds.upperBound(), 0.0);
+            double maxAcceleration = std::sqrt(maxSquaredAcceleration);
+            if (!(maxAcceleration < MAX_SEGMENT_COUNT)) {
+                return -1;
+            }
+            if (maxAcceleration == 0.0) {
+                return 1;
+            }
+            double count = width * std::sqrt(maxAcceleration / (8 * _chordTolerance));
+            double minSpeed = std::sqrt(std::max(squaredSpeedBounds.lowerBound(), 0.0));
+            if (!(minSpeed > 0.0)) {
+                return -1;
+            }
+            count = std::max(count, width * maxAcceleration / (minSpeed * _angleTolerance));
+            if (!(count < MAX_SEGMENT_COUNT)) {
+                return -1;
+            }
+            return std::max(int(std::ceil(count)), 1);
+        }
+
+        CurveTessellator::CurveTessellator(
+            const ParametricExpression<double, double>& squaredSpeed,
+            const ParametricExpression<double, double>& squaredAcceleration,
+            Interval domain,
+            double chordTolerance,
+            double angleTolerance
+        ) : _squaredSpeed(squaredSpeed),
+            _squaredAcceleration(squaredAcceleration),
+            _domain(domain),
+            _chordTolerance(chordTolerance),
+            _angleTolerance(angleTolerance) {
+
+            if (!(chordTolerance > 0.0) || !(angleTolerance > 0.0)) {
+                throw Error(new PlaceholderError());
+            }
+        }
+
+        std::vector<double>
+        CurveTessellator::parameterValues() const {
+            if (_domain.isEmpty()) {
+                return std::vector<double>();
+            }
+            if (_domain.width() == 0.0) {
+                return std::vector<double>(1, _domain.lowerBound());
+            }
+            double minWidth = MIN_RELATIVE_WIDTH * _domain.width();
+
+            std::vector<Segment> segments;
+            std::vector<Interval> pending(1, _domain);
+            while (!pending.empty()) {
+                std::vector<Interval> squaredSpeedBounds =
+                    _squaredSpeed.evaluate(pending, AFFINE_BOUNDS);
+                std::vector<Interval> squaredAccelerationBounds =
+                    _squaredAcceleration.evaluate(pending, AFFINE_BOUNDS);
+                std::vector<Interval> next;
+                for (std::size_t index = 0; index < pending.size(); ++index) {
+                    Interval interval = pending[index];
+                    int count = numSegments(
+                        interval.width(),
+                        squaredSpeedBounds[index],
+                        squaredAccelerationBounds[index]
+                    );
+                    if (count >= 1 && count <= MAX_UNIFORM_SEGMENTS) {
+                        segments.push_back(std::make_pair(interval, count));
+                        continue;
+                    }
+                    std::pair<Interval, Interval> halves = interval.bisected();
+                    bool canBisect = (
+                        interval.width() > minWidth &&
+                        halves.first.width() < interval.width() &&
+                        halves.second.width() < interval.width()
+                    );
+                    if (canBisect) {
+                        next.push_back(halves.first);
+                        next.push_back(halves.second);
+                    } else {
+                        // Degenerate (for instance at a cusp, where the tangent direction is
+                        // undefined), but already tiny
+                        count = std::min(std::max(count, 1), MAX_UNIFORM_SEGMENTS);
+                        segments.push_back(std::make_pair(interval, count));
+                    }
+                }
+                pending.swap(next);
+            }
+
+            std::sort(
+                segments.begin(),
+                segments.end(),
+                [] (const Segment& firstSegment, const Segment& secondSegment) {
+                    return firstSegment.first.lowerBound() < secondSegment.first.lowerBound();
+                }
+            );
+            std::vector<double> results;
+            for (const Segment& segment : segments) {
+                Interval interval = segment.first;
+                int count = segment.second;
+                results.push_back(interval.lowerBound());
+                for (int index = 1; index < count; ++index) {
+                    results.push_back(interval.interpolated(double(index) / count));
+                }
+            }
+            results.push_back(_domain.upperBound());
+            return results;
+        }
+    }
+}
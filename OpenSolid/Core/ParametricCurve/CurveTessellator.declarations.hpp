@@ -28,7 +28,6 @@ namespace opensolid
 {
     namespace detail
     {
-        template <class TScalar>
-        class MatrixID;
+        class CurveTessellator;
     }
 }
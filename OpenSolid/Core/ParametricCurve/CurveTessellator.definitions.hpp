@@ -0,0 +1,84 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#pragma once
+
+#include <OpenSolid/config.hpp>
+
+#include <OpenSolid/Core/ParametricCurve/CurveTessellator.declarations.hpp>
+
+#include <OpenSolid/Core/Interval.definitions.hpp>
+#include <OpenSolid/Core/ParametricExpression.definitions.hpp>
+
+#include <vector>
+
+namespace opensolid
+{
+    namespace detail
+    {
+        // Chooses parameter values at which to sample a curve so that the resulting polyline
+        // stays within a given distance of the curve, and so that the tangent direction turns
+        // by no more than a given angle along each segment. Works from bounds on the squared
+        // norms of the first and second derivatives of the curve (so it is independent of the
+        // number of dimensions): over a parameter interval of width h where the second
+        // derivative is at most M and the first derivative at least m in magnitude, the chord
+        // deviation is at most h^2 * M / 8 and the tangent turns by at most h * M / m. Each
+        // interval is split into the number of uniform segments given by these bounds, or
+        // bisected (to get tighter bounds) if that number is large. Bounds for all intervals
+        // at each level of bisection are evaluated together in a single batch.
+        class CurveTessellator
+        {
+        private:
+            ParametricExpression<double, double> _squaredSpeed;
+            ParametricExpression<double, double> _squaredAcceleration;
+            Interval _domain;
+            double _chordTolerance;
+            double _angleTolerance;
+
+            // Number of uniform segments needed over an interval of the given width, or -1 if
+            // the bounds are not good enough to say
+            int
+            numSegments(
+                double width,
+                Interval squaredSpeedBounds,
+                Interval squaredAccelerationBounds
+            ) const;
+        public:
+            // Throws if either tolerance is not positive
+            OPENSOLID_CORE_EXPORT
+            CurveTessellator(
+                const ParametricExpression<double, double>& squaredSpeed,
+                const ParametricExpression<double, double>& squaredAcceleration,
+                Interval domain,
+                double chordTolerance,
+                double angleTolerance
+            );
+
+            // Increasing parameter values starting and ending at the ends of the domain
+            OPENSOLID_CORE_EXPORT
+            std::vector<double>
+            parameterValues() const;
+        };
+    }
+}
@@ -29,6 +29,7 @@
 #include <OpenSolid/Core/ParametricCurve/ParametricCurveBase.declarations.hpp>
 
 #include <OpenSolid/Core/Box.definitions.hpp>
+#include <OpenSolid/Core/ChebyshevProxy.declarations.hpp>
 #include <OpenSolid/Core/Frame.declarations.hpp>
 #include <OpenSolid/Core/Interval.definitions.hpp>
 #include <OpenSolid/Core/ParametricCurve.declarations.hpp>
@@ -90,6 +91,18 @@ namespace opensolid
 
             ParametricExpression<UnitVector<iNumDimensions>, double>
             tangentVector() const;
+
+            // Piecewise Chebyshev approximation of this curve over its domain, for cheap
+            // repeated evaluation (see ChebyshevProxy)
+            ChebyshevProxy<Point<iNumDimensions>>
+            proxy(double tolerance = 1e-9) const;
+
+            // Polyline approximating this curve, with no point of the curve further than
+            // chordTolerance from the polyline and with the tangent direction turning by at most
+            // angleTolerance (in radians) along each segment. Points are spaced adaptively (see
+            // CurveTessellator), so straight portions of the curve use few points.
+            std::vector<Point<iNumDimensions>>
+            tessellate(double chordTolerance, double angleTolerance) const;
         };
     }
 }
@@ -29,9 +29,11 @@
 #include <OpenSolid/Core/ParametricCurve/ParametricCurveBase.definitions.hpp>
 
 #include <OpenSolid/Core/Box.hpp>
+#include <OpenSolid/Core/ChebyshevProxy.hpp>
 #include <OpenSolid/Core/Frame.hpp>
 #include <OpenSolid/Core/Interval.hpp>
 #include <OpenSolid/Core/Parameter.hpp>
+#include <OpenSolid/Core/ParametricCurve/CurveTessellator.hpp>
 #include <OpenSolid/Core/ParametricCurve.definitions.hpp>
 #include <OpenSolid/Core/ParametricExpression.hpp>
 #include <OpenSolid/Core/Point.hpp>
@@ -73,7 +75,7 @@ namespace opensolid
             Interval domain
         ) : _expression(expression),
             _domain(domain),
-            _bounds(expression.evaluate(domain)) {
+            _bounds(expression.evaluate(domain, AFFINE_BOUNDS)) {
         }
 
         template <int iNumDimensions>
@@ -141,5 +143,29 @@ namespace opensolid
         ParametricCurveBase<iNumDimensions>::tangentVector() const {
             return expression().derivative().normalized();
         }
+
+        template <int iNumDimensions>
+        ChebyshevProxy<Point<iNumDimensions>>
+        ParametricCurveBase<iNumDimensions>::proxy(double tolerance) const {
+            return ChebyshevProxy<Point<iNumDimensions>>(expression(), domain(), tolerance);
+        }
+
+        template <int iNumDimensions>
+        std::vector<Point<iNumDimensions>>
+        ParametricCurveBase<iNumDimensions>::tessellate(
+            double chordTolerance,
+            double angleTolerance
+        ) const {
+            ParametricExpression<Vector<double, iNumDimensions>, double> derivative =
+                expression().derivative();
+            CurveTessellator tessellator(
+                derivative.squaredNorm(),
+                derivative.derivative().squaredNorm(),
+                domain(),
+                chordTolerance,
+                angleTolerance
+            );
+            return evaluate(tessellator.parameterValues());
+        }
     }
 }
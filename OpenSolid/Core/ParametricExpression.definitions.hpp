@@ -28,6 +28,7 @@
  
 #include <OpenSolid/Core/ParametricExpression.declarations.hpp>
 
+#include <OpenSolid/Core/BoundsMode.definitions.hpp>
 #include <OpenSolid/Core/BoundsType.definitions.hpp>
 #include <OpenSolid/Core/Convertible.definitions.hpp>
 #include <OpenSolid/Core/Interval.declarations.hpp>
@@ -64,6 +65,12 @@ namespace opensolid
     {
     private:
         detail::CompiledExpressionPtr _compiledExpressionPtr;
+
+        explicit
+        ParametricExpression(detail::CompiledExpressionPtr compiledExpressionPtr);
+
+        template <class TOtherValue, class TOtherParameter>
+        friend class ParametricExpression;
     public:
         ParametricExpression();
         
@@ -71,6 +78,9 @@ namespace opensolid
         
         const detail::ExpressionImplementationPtr&
         implementation() const;
+
+        const detail::CompiledExpressionPtr&
+        compiledExpression() const;
         
         TValue
         evaluate(const TParameter& parameterValue) const;
@@ -83,13 +93,107 @@ namespace opensolid
 
         std::vector<typename BoundsType<TValue>::Type>
         evaluate(const std::vector<typename BoundsType<TParameter>::Type>& parameterBounds) const;
+
+        // Compute bounds using the given method (see BoundsMode); evaluate(parameterBounds) is
+        // equivalent to evaluate(parameterBounds, NATURAL_BOUNDS)
+        typename BoundsType<TValue>::Type
+        evaluate(
+            const typename BoundsType<TParameter>::Type& parameterBounds,
+            BoundsMode boundsMode
+        ) const;
+
+        std::vector<typename BoundsType<TValue>::Type>
+        evaluate(
+            const std::vector<typename BoundsType<TParameter>::Type>& parameterBounds,
+            BoundsMode boundsMode
+        ) const;
+
+        // Evaluate at many parameter values, storing results in single precision (for instance
+        // directly into a vertex buffer). Values are computed in double precision and converted
+        // as they are stored. The components of each value are stored consecutively, so the
+        // given buffer must have room for NumDimensions<TValue>::Value * parameterValues.size()
+        // floats.
+        void
+        evaluate(const std::vector<TParameter>& parameterValues, float* results) const;
         
         Matrix<double, NumDimensions<TValue>::Value, NumDimensions<TParameter>::Value>
         jacobian(const TParameter& parameterValue) const;
         
         Matrix<Interval, NumDimensions<TValue>::Value, NumDimensions<TParameter>::Value>
         jacobian(const typename BoundsType<TParameter>::Type& parameterBounds) const;
+
+        std::vector<Matrix<double, NumDimensions<TValue>::Value, NumDimensions<TParameter>::Value>>
+        jacobian(const std::vector<TParameter>& parameterValues) const;
+
+        std::vector<
+            Matrix<Interval, NumDimensions<TValue>::Value, NumDimensions<TParameter>::Value>
+        >
+        jacobian(const std::vector<typename BoundsType<TParameter>::Type>& parameterBounds) const;
+
+        // Compute values together with their Jacobians in a single pass, sharing any
+        // intermediate results between the two
+        void
+        evaluateWithJacobian(
+            const TParameter& parameterValue,
+            TValue& value,
+            Matrix<double, NumDimensions<TValue>::Value, NumDimensions<TParameter>::Value>& jacobian
+        ) const;
+
+        void
+        evaluateWithJacobian(
+            const typename BoundsType<TParameter>::Type& parameterBounds,
+            typename BoundsType<TValue>::Type& bounds,
+            Matrix<
+                Interval,
+                NumDimensions<TValue>::Value,
+                NumDimensions<TParameter>::Value
+            >& jacobian
+        ) const;
+
+        void
+        evaluateWithJacobian(
+            const std::vector<TParameter>& parameterValues,
+            std::vector<TValue>& values,
+            std::vector<
+                Matrix<double, NumDimensions<TValue>::Value, NumDimensions<TParameter>::Value>
+            >& jacobians
+        ) const;
+
+        void
+        evaluateWithJacobian(
+            const std::vector<typename BoundsType<TParameter>::Type>& parameterBounds,
+            std::vector<typename BoundsType<TValue>::Type>& bounds,
+            std::vector<
+                Matrix<Interval, NumDimensions<TValue>::Value, NumDimensions<TParameter>::Value>
+            >& jacobians
+        ) const;
         
+        // Find all zeros of a scalar expression of a single parameter within the given domain,
+        // in increasing order. Zeros closer together than the given tolerance (including
+        // multiple zeros such as tangential intersections) are reported only once.
+        std::vector<double>
+        zeros(Interval domain, double tolerance = 1e-12) const;
+
+        // Narrow the given parameter bounds to those for which the expression may have a value
+        // within the given value bounds, by propagating the value bounds backwards through the
+        // expression graph (HC4-revise). All bounds are empty if there are no such parameters.
+        typename BoundsType<TParameter>::Type
+        contracted(
+            const typename BoundsType<TParameter>::Type& parameterBounds,
+            const typename BoundsType<TValue>::Type& valueBounds
+        ) const;
+
+        // Cover the parameters within the given domain for which the expression has a value
+        // within the given value bounds, by alternating contraction and bisection. Each
+        // returned box either lies entirely inside the preimage or is no wider than the given
+        // tolerance.
+        std::vector<typename BoundsType<TParameter>::Type>
+        preimage(
+            const typename BoundsType<TValue>::Type& valueBounds,
+            const typename BoundsType<TParameter>::Type& domain,
+            double tolerance = 1e-6
+        ) const;
+
         template <class TInnerParameter>
         ParametricExpression<TValue, TInnerParameter>
         composed(const ParametricExpression<TParameter, TInnerParameter>& innerExpression) const;
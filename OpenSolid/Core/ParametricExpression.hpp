@@ -34,10 +34,12 @@
 #include <OpenSolid/Core/Matrix.hpp>
 #include <OpenSolid/Core/Parameter.hpp>
 #include <OpenSolid/Core/ParametricExpression/CompiledExpression.hpp>
+#include <OpenSolid/Core/ParametricExpression/Contractor.hpp>
 #include <OpenSolid/Core/ParametricExpression/DeduplicationCache.hpp>
 #include <OpenSolid/Core/ParametricExpression/ExpressionConstructors.hpp>
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
 #include <OpenSolid/Core/ParametricExpression/TransformableExpression.hpp>
+#include <OpenSolid/Core/ParametricExpression/ZeroFinder.hpp>
 #include <OpenSolid/Core/Point.hpp>
 #include <OpenSolid/Core/Sign.hpp>
 #include <OpenSolid/Core/Transformable.hpp>
@@ -316,6 +318,61 @@ namespace opensolid
             );
         }
 
+        // Views of Jacobian matrices as flattened (column-major) columns, matching the layout
+        // produced by CompiledExpression::evaluateJacobian
+        template <class TScalar, int iNumRows, int iNumColumns>
+        inline
+        MatrixView<TScalar, -1, -1, -1>
+        flattenedView(Matrix<TScalar, iNumRows, iNumColumns>& matrix) {
+            return MatrixView<TScalar, -1, -1, -1>(
+                matrix.data(),
+                iNumRows * iNumColumns,
+                1,
+                sizeof(Matrix<TScalar, iNumRows, iNumColumns>)
+            );
+        }
+
+        template <class TScalar, int iNumRows, int iNumColumns>
+        inline
+        MatrixView<TScalar, -1, -1, -1>
+        flattenedView(std::vector<Matrix<TScalar, iNumRows, iNumColumns>>& matrices) {
+            return MatrixView<TScalar, -1, -1, -1>(
+                matrices.front().data(),
+                iNumRows * iNumColumns,
+                int(matrices.size()),
+                sizeof(Matrix<TScalar, iNumRows, iNumColumns>)
+            );
+        }
+
+        // Split the combined results of CompiledExpression::evaluateWithJacobian into separate
+        // value and (flattened) Jacobian views
+        template <class TScalar>
+        inline
+        void
+        splitValueAndJacobian(
+            const MatrixView<const TScalar, -1, -1, -1>& combinedView,
+            MatrixView<TScalar, -1, -1, -1> valueView,
+            MatrixView<TScalar, -1, -1, -1> jacobianView
+        ) {
+            int numColumns = combinedView.numColumns();
+            int numValueRows = valueView.numRows();
+            valueView = combinedView.block(0, 0, numValueRows, numColumns);
+            jacobianView = combinedView.block(numValueRows, 0, jacobianView.numRows(), numColumns);
+        }
+
+        // Components of a scalar, vector or box of bounds as a vector of intervals
+        template <class TBounds>
+        inline
+        std::vector<Interval>
+        intervals(const TBounds& bounds) {
+            ConstIntervalMatrixViewXd view = constView(bounds);
+            std::vector<Interval> results(view.numRows());
+            for (int index = 0; index < view.numRows(); ++index) {
+                results[index] = view(index, 0);
+            }
+            return results;
+        }
+
         inline
         ColumnMatrixXd
         components(double value) {
@@ -412,12 +469,27 @@ namespace opensolid
         }
     }
 
+    template <class TValue, class TParameter>
+    ParametricExpression<TValue, TParameter>::ParametricExpression(
+        detail::CompiledExpressionPtr compiledExpressionPtr
+    ) : _compiledExpressionPtr(std::move(compiledExpressionPtr)) {
+        assert(implementation()->numDimensions() == NumDimensions<TValue>::Value);
+        assert(implementation()->numParameters() == NumDimensions<TParameter>::Value);
+    }
+
     template <class TValue, class TParameter>
     inline
     const detail::ExpressionImplementationPtr&
     ParametricExpression<TValue, TParameter>::implementation() const {
         return _compiledExpressionPtr->implementation();
     }
+
+    template <class TValue, class TParameter>
+    inline
+    const detail::CompiledExpressionPtr&
+    ParametricExpression<TValue, TParameter>::compiledExpression() const {
+        return _compiledExpressionPtr;
+    }
         
     template <class TValue, class TParameter>
     inline
@@ -481,6 +553,59 @@ namespace opensolid
         return results;
     }
     
+    template <class TValue, class TParameter>
+    inline
+    typename BoundsType<TValue>::Type
+    ParametricExpression<TValue, TParameter>::evaluate(
+        const typename BoundsType<TParameter>::Type& parameterBounds,
+        BoundsMode boundsMode
+    ) const {
+        ConstIntervalMatrixViewXd parameterView = detail::constView(parameterBounds);
+
+        typename BoundsType<TValue>::Type result;
+        IntervalMatrixViewXd resultView = detail::mutableView(result);
+
+        _compiledExpressionPtr->evaluate(parameterView, resultView, boundsMode);
+
+        return result;
+    }
+
+    template <class TValue, class TParameter>
+    inline
+    std::vector<typename BoundsType<TValue>::Type>
+    ParametricExpression<TValue, TParameter>::evaluate(
+        const std::vector<typename BoundsType<TParameter>::Type>& parameterBounds,
+        BoundsMode boundsMode
+    ) const {
+        ConstIntervalMatrixViewXd parameterView = detail::constView(parameterBounds);
+
+        std::vector<typename BoundsType<TValue>::Type> results(parameterBounds.size());
+        IntervalMatrixViewXd resultView = detail::mutableView(results);
+
+        _compiledExpressionPtr->evaluate(parameterView, resultView, boundsMode);
+
+        return results;
+    }
+
+    template <class TValue, class TParameter>
+    inline
+    void
+    ParametricExpression<TValue, TParameter>::evaluate(
+        const std::vector<TParameter>& parameterValues,
+        float* results
+    ) const {
+        ConstMatrixViewXd parameterView = detail::constView(parameterValues);
+
+        MatrixViewXf resultView(
+            results,
+            NumDimensions<TValue>::Value,
+            int(parameterValues.size()),
+            NumDimensions<TValue>::Value * sizeof(float)
+        );
+
+        _compiledExpressionPtr->evaluate(parameterView, resultView);
+    }
+
     template <class TValue, class TParameter>
     inline
     Matrix<double, NumDimensions<TValue>::Value, NumDimensions<TParameter>::Value>
@@ -488,7 +613,7 @@ namespace opensolid
         ConstMatrixViewXd parameterView = detail::constView(parameterValue);
 
         Matrix<double, NumDimensions<TValue>::Value, NumDimensions<TParameter>::Value> result;
-        MatrixViewXd resultView = result.view();
+        MatrixViewXd resultView = detail::flattenedView(result);
 
         _compiledExpressionPtr->evaluateJacobian(parameterView, resultView);
 
@@ -504,13 +629,229 @@ namespace opensolid
         ConstIntervalMatrixViewXd parameterView = detail::constView(parameterBounds);
 
         Matrix<Interval, NumDimensions<TValue>::Value, NumDimensions<TParameter>::Value> result;
-        IntervalMatrixViewXd resultView = result.view();
+        IntervalMatrixViewXd resultView = detail::flattenedView(result);
 
         _compiledExpressionPtr->evaluateJacobian(parameterView, resultView);
 
         return result;
     }
 
+    template <class TValue, class TParameter>
+    inline
+    std::vector<Matrix<double, NumDimensions<TValue>::Value, NumDimensions<TParameter>::Value>>
+    ParametricExpression<TValue, TParameter>::jacobian(
+        const std::vector<TParameter>& parameterValues
+    ) const {
+        std::vector<
+            Matrix<double, NumDimensions<TValue>::Value, NumDimensions<TParameter>::Value>
+        > results(parameterValues.size());
+        if (parameterValues.empty()) {
+            return results;
+        }
+
+        ConstMatrixViewXd parameterView = detail::constView(parameterValues);
+        MatrixViewXd resultView = detail::flattenedView(results);
+
+        _compiledExpressionPtr->evaluateJacobian(parameterView, resultView);
+
+        return results;
+    }
+
+    template <class TValue, class TParameter>
+    inline
+    std::vector<Matrix<Interval, NumDimensions<TValue>::Value, NumDimensions<TParameter>::Value>>
+    ParametricExpression<TValue, TParameter>::jacobian(
+        const std::vector<typename BoundsType<TParameter>::Type>& parameterBounds
+    ) const {
+        std::vector<
+            Matrix<Interval, NumDimensions<TValue>::Value, NumDimensions<TParameter>::Value>
+        > results(parameterBounds.size());
+        if (parameterBounds.empty()) {
+            return results;
+        }
+
+        ConstIntervalMatrixViewXd parameterView = detail::constView(parameterBounds);
+        IntervalMatrixViewXd resultView = detail::flattenedView(results);
+
+        _compiledExpressionPtr->evaluateJacobian(parameterView, resultView);
+
+        return results;
+    }
+
+    template <class TValue, class TParameter>
+    inline
+    void
+    ParametricExpression<TValue, TParameter>::evaluateWithJacobian(
+        const TParameter& parameterValue,
+        TValue& value,
+        Matrix<double, NumDimensions<TValue>::Value, NumDimensions<TParameter>::Value>& jacobian
+    ) const {
+        static const int NUM_ROWS =
+            NumDimensions<TValue>::Value * (NumDimensions<TParameter>::Value + 1);
+
+        ConstMatrixViewXd parameterView = detail::constView(parameterValue);
+
+        Matrix<double, NUM_ROWS, 1> combined;
+        MatrixViewXd combinedView = combined.view();
+
+        _compiledExpressionPtr->evaluateWithJacobian(parameterView, combinedView);
+
+        detail::splitValueAndJacobian(
+            ConstMatrixViewXd(combinedView),
+            detail::mutableView(value),
+            detail::flattenedView(jacobian)
+        );
+    }
+
+    template <class TValue, class TParameter>
+    inline
+    void
+    ParametricExpression<TValue, TParameter>::evaluateWithJacobian(
+        const typename BoundsType<TParameter>::Type& parameterBounds,
+        typename BoundsType<TValue>::Type& bounds,
+        Matrix<Interval, NumDimensions<TValue>::Value, NumDimensions<TParameter>::Value>& jacobian
+    ) const {
+        static const int NUM_ROWS =
+            NumDimensions<TValue>::Value * (NumDimensions<TParameter>::Value + 1);
+
+        ConstIntervalMatrixViewXd parameterView = detail::constView(parameterBounds);
+
+        Matrix<Interval, NUM_ROWS, 1> combined;
+        IntervalMatrixViewXd combinedView = combined.view();
+
+        _compiledExpressionPtr->evaluateWithJacobian(parameterView, combinedView);
+
+        detail::splitValueAndJacobian(
+            ConstIntervalMatrixViewXd(combinedView),
+            detail::mutableView(bounds),
+            detail::flattenedView(jacobian)
+        );
+    }
+
+    template <class TValue, class TParameter>
+    inline
+    void
+    ParametricExpression<TValue, TParameter>::evaluateWithJacobian(
+        const std::vector<TParameter>& parameterValues,
+        std::vector<TValue>& values,
+        std::vector<
+            Matrix<double, NumDimensions<TValue>::Value, NumDimensions<TParameter>::Value>
+        >& jacobians
+    ) const {
+        values.resize(parameterValues.size());
+        jacobians.resize(parameterValues.size());
+        if (parameterValues.empty()) {
+            return;
+        }
+
+        ConstMatrixViewXd parameterView = detail::constView(parameterValues);
+
+        MatrixXd combined(
+            NumDimensions<TValue>::Value * (NumDimensions<TParameter>::Value + 1),
+            int(parameterValues.size())
+        );
+        MatrixViewXd combinedView = combined.view();
+
+        _compiledExpressionPtr->evaluateWithJacobian(parameterView, combinedView);
+
+        detail::splitValueAndJacobian(
+            ConstMatrixViewXd(combinedView),
+            detail::mutableView(values),
+            detail::flattenedView(jacobians)
+        );
+    }
+
+    template <class TValue, class TParameter>
+    inline
+    void
+    ParametricExpression<TValue, TParameter>::evaluateWithJacobian(
+        const std::vector<typename BoundsType<TParameter>::Type>& parameterBounds,
+        std::vector<typename BoundsType<TValue>::Type>& bounds,
+        std::vector<
+            Matrix<Interval, NumDimensions<TValue>::Value, NumDimensions<TParameter>::Value>
+        >& jacobians
+    ) const {
+        bounds.resize(parameterBounds.size());
+        jacobians.resize(parameterBounds.size());
+        if (parameterBounds.empty()) {
+            return;
+        }
+
+        ConstIntervalMatrixViewXd parameterView = detail::constView(parameterBounds);
+
+        IntervalMatrixXd combined(
+            NumDimensions<TValue>::Value * (NumDimensions<TParameter>::Value + 1),
+            int(parameterBounds.size())
+        );
+        IntervalMatrixViewXd combinedView = combined.view();
+
+        _compiledExpressionPtr->evaluateWithJacobian(parameterView, combinedView);
+
+        detail::splitValueAndJacobian(
+            ConstIntervalMatrixViewXd(combinedView),
+            detail::mutableView(bounds),
+            detail::flattenedView(jacobians)
+        );
+    }
+
+    template <class TValue, class TParameter>
+    inline
+    std::vector<double>
+    ParametricExpression<TValue, TParameter>::zeros(Interval domain, double tolerance) const {
+        static_assert(
+            std::is_same<TValue, double>::value && std::is_same<TParameter, double>::value,
+            "Zeros can only be found for scalar expressions of a single parameter"
+        );
+        return detail::ZeroFinder(*_compiledExpressionPtr, tolerance).zeros(domain);
+    }
+
+    template <class TValue, class TParameter>
+    inline
+    typename BoundsType<TParameter>::Type
+    ParametricExpression<TValue, TParameter>::contracted(
+        const typename BoundsType<TParameter>::Type& parameterBounds,
+        const typename BoundsType<TValue>::Type& valueBounds
+    ) const {
+        std::vector<Interval> contractedBounds = detail::Contractor::contracted(
+            implementation(),
+            detail::intervals(parameterBounds),
+            detail::intervals(valueBounds)
+        );
+        typename BoundsType<TParameter>::Type result;
+        IntervalMatrixViewXd resultView = detail::mutableView(result);
+        for (int index = 0; index < resultView.numRows(); ++index) {
+            resultView(index, 0) = contractedBounds[index];
+        }
+        return result;
+    }
+
+    template <class TValue, class TParameter>
+    inline
+    std::vector<typename BoundsType<TParameter>::Type>
+    ParametricExpression<TValue, TParameter>::preimage(
+        const typename BoundsType<TValue>::Type& valueBounds,
+        const typename BoundsType<TParameter>::Type& domain,
+        double tolerance
+    ) const {
+        std::vector<Interval> flattenedBoxes = detail::Contractor::preimage(
+            implementation(),
+            detail::intervals(valueBounds),
+            detail::intervals(domain),
+            tolerance
+        );
+        int numParameters = NumDimensions<TParameter>::Value;
+        std::vector<typename BoundsType<TParameter>::Type> results(
+            flattenedBoxes.size() / numParameters
+        );
+        for (std::size_t boxIndex = 0; boxIndex < results.size(); ++boxIndex) {
+            IntervalMatrixViewXd resultView = detail::mutableView(results[boxIndex]);
+            for (int index = 0; index < numParameters; ++index) {
+                resultView(index, 0) = flattenedBoxes[boxIndex * numParameters + index];
+            }
+        }
+        return results;
+    }
+
     template <class TValue, class TParameter> template <class TInnerParameter>
     ParametricExpression<TValue, TInnerParameter>
     ParametricExpression<TValue, TParameter>::composed(
@@ -530,8 +871,9 @@ namespace opensolid
             "Must supply Parameter object or parameter index to derivative() if parametric "
             "expression has multiple parameters"
         );
-        detail::DeduplicationCache deduplicationCache;
-        return implementation()->derivative(0)->deduplicated(deduplicationCache);
+        return ParametricExpression<typename DerivativeType<TValue>::Type, TParameter>(
+            _compiledExpressionPtr->derivative(0)
+        );
     }
     
     template <class TValue, class TParameter>
@@ -540,8 +882,9 @@ namespace opensolid
         if (parameterIndex < 0 || parameterIndex >= NumDimensions<TParameter>::Value) {
             throw Error(new PlaceholderError());
         }
-        detail::DeduplicationCache deduplicationCache;
-        return implementation()->derivative(parameterIndex)->deduplicated(deduplicationCache);
+        return ParametricExpression<typename DerivativeType<TValue>::Type, TParameter>(
+            _compiledExpressionPtr->derivative(parameterIndex)
+        );
     }
     
     template <class TValue, class TParameter>
@@ -25,6 +25,7 @@
 #include <OpenSolid/Core/ParametricExpression/ArcsineExpression.hpp>
 
 #include <OpenSolid/Core/Error.hpp>
+#include <OpenSolid/Core/ParametricExpression/Contractor.hpp>
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
 
 namespace opensolid
@@ -36,94 +37,33 @@ namespace opensolid
             return 1;
         }
         
-        void
-        ArcsineExpression::evaluateImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            expressionCompiler.evaluate(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                resultID,
-                [] (MatrixViewXd results) {
-                    results.setMap(
-                        results,
-                        [] (double value) {
-                            if (-1.0 <= value && value <= 1.0) {
-                                return opensolid::asin(value);
-                            } else if (value + 1 == Zero()) {
-                                return - M_PI / 2.0;
-                            } else if (value - 1 == Zero()) {
-                                return M_PI / 2.0;
-                            } else {
-                                throw Error(new PlaceholderError());
-                            }
-                        }
-                    );
-                }
-            );
-        }
-        
-        void
-        ArcsineExpression::evaluateImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        std::vector<int>
+        ArcsineExpression::compileImpl(
+            const std::vector<int>& parameterRegisters,
+            Compiler& compiler
         ) const {
-            expressionCompiler.evaluate(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                resultID,
-                [] (IntervalMatrixViewXd results) {
-                    results.setMap(
-                        results,
-                        [] (Interval value) {
-                            Interval domain(-1, 1);
-                            return opensolid::asin(value.intersection(domain));
-                        }
-                    );
-                }
-            );
+            int operandRegister = compiler.evaluate(operand(), parameterRegisters).front();
+            return std::vector<int>(1, compiler.compute(Bytecode::ASIN, operandRegister));
         }
 
-        void
-        ArcsineExpression::evaluateJacobianImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            expressionCompiler.evaluateJacobian(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(operand(), parameterID),
-                resultID,
-                [] (ConstMatrixViewXd operandValues, MatrixViewXd results) {
-                    double operandValue = operandValues.value();
-                    double temp = 1 - operandValue * operandValue;
-                    if (temp > 0.0) {
-                        results *= 1.0 / opensolid::sqrt(temp);
-                    } else {
-                        throw Error(new PlaceholderError());
-                    }
-                }
-            );
+        std::vector<Interval>
+        ArcsineExpression::boundsImpl(Contractor& contractor) const {
+            const std::vector<Interval>& operandBounds = contractor.bounds(operand());
+            Interval domain(-1, 1);
+            Interval result = opensolid::asin(operandBounds.front().intersection(domain));
+            return std::vector<Interval>(1, result);
         }
-        
+
         void
-        ArcsineExpression::evaluateJacobianImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        ArcsineExpression::contractImpl(
+            const std::vector<Interval>& bounds,
+            Contractor& contractor
         ) const {
-            expressionCompiler.evaluateJacobian(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(operand(), parameterID),
-                resultID,
-                [] (ConstIntervalMatrixViewXd operandValues, IntervalMatrixViewXd results) {
-                    Interval operandValue = operandValues.value();
-                    results *= 1.0 / opensolid::sqrt(1 - operandValue.squared());
-                }
-            );
+            Interval range(-M_PI / 2, M_PI / 2);
+            Interval operandBounds = opensolid::sin(bounds.front().intersection(range));
+            contractor.narrow(operand(), 0, operandBounds);
         }
-        
+
         ExpressionImplementationPtr
         ArcsineExpression::derivativeImpl(int parameterIndex) const {
             return operand()->derivative(parameterIndex) / sqrt(1.0 - operand()->squaredNorm());
@@ -0,0 +1,640 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#include <OpenSolid/Core/ParametricExpression/BSplineExpression.hpp>
+
+#include <OpenSolid/Core/Error.hpp>
+#include <OpenSolid/Core/ParametricExpression/Contractor.hpp>
+#include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace opensolid
+{
+    namespace
+    {
+        // Local control nets of up to this many values are evaluated without heap allocation
+        const int LOCAL_BUFFER_SIZE = 256;
+
+        // Parameter bounds covering more than this many spans (or combinations of spans, for
+        // surfaces) are bounded using the hull of the original control points of each span,
+        // instead of the much tighter (but more expensive) hull of its restriction to the
+        // parameter bounds
+        const int MAX_NUM_RESTRICTED_SPANS = 16;
+
+        // De Boor's algorithm applied to degree + 1 consecutive blocks of the given length
+        // (single control points for curves, whole rows of the control net for surfaces),
+        // where span is the index of the knot span being evaluated. At level r, the parameter
+        // value given by parameterValue(r) is used; this is the same at every level for
+        // ordinary evaluation, but differs when evaluating the blossom. The result is left in
+        // the last block.
+        template <class TParameterValue>
+        inline
+        void
+        deBoor(
+            double* blocks,
+            int length,
+            int degree,
+            const double* knots,
+            int span,
+            TParameterValue parameterValue
+        ) {
+            for (int level = 1; level <= degree; ++level) {
+                double value = parameterValue(level);
+                for (int index = degree; index >= level; --index) {
+                    double lowerKnot = knots[span - degree + index];
+                    double upperKnot = knots[span + 1 + index - level];
+                    double alpha = (value - lowerKnot) / (upperKnot - lowerKnot);
+                    double* current = blocks + index * length;
+                    const double* previous = current - length;
+                    for (int offset = 0; offset < length; ++offset) {
+                        current[offset] = previous[offset] + alpha * (
+                            current[offset] - previous[offset]
+                        );
+                    }
+                }
+            }
+        }
+
+        // Replace each row of degree + 1 blocks in the given net by the control points of the
+        // same polynomial piece restricted to [lowerValue, upperValue], which are values of
+        // its blossom with every argument equal to one of the two bounds
+        void
+        restrict(
+            double* net,
+            int numRows,
+            int length,
+            int degree,
+            const double* knots,
+            int span,
+            double lowerValue,
+            double upperValue,
+            std::vector<double>& original,
+            std::vector<double>& work
+        ) {
+            int rowSize = (degree + 1) * length;
+            for (int rowIndex = 0; rowIndex < numRows; ++rowIndex) {
+                double* row = net + rowIndex * rowSize;
+                original.assign(row, row + rowSize);
+                for (int index = 0; index <= degree; ++index) {
+                    work = original;
+                    deBoor(
+                        work.data(),
+                        length,
+                        degree,
+                        knots,
+                        span,
+                        [degree, index, lowerValue, upperValue] (int level) {
+                            return level <= degree - index ? lowerValue : upperValue;
+                        }
+                    );
+                    const double* result = work.data() + degree * length;
+                    std::copy(result, result + length, row + index * length);
+                }
+            }
+        }
+
+        bool
+        isBounded(Interval interval) {
+            return (
+                std::abs(interval.lowerBound()) < std::numeric_limits<double>::infinity() &&
+                std::abs(interval.upperBound()) < std::numeric_limits<double>::infinity()
+            );
+        }
+    }
+
+    namespace detail
+    {
+        int
+        BSplineExpression::numDimensionsImpl() const {
+            return _numDimensions;
+        }
+
+        int
+        BSplineExpression::numParametersImpl() const {
+            return int(_degrees.size());
+        }
+
+        std::vector<int>
+        BSplineExpression::compileImpl(
+            const std::vector<int>& parameterRegisters,
+            Compiler& compiler
+        ) const {
+            return compiler.computeSpline(
+                std::static_pointer_cast<const BSplineExpression>(self()),
+                parameterRegisters
+            );
+        }
+
+        std::vector<Interval>
+        BSplineExpression::boundsImpl(Contractor& contractor) const {
+            std::vector<Interval> results(numDimensions());
+            evaluate(contractor.parameterBounds().data(), results.data());
+            return results;
+        }
+
+        ExpressionImplementationPtr
+        BSplineExpression::homogeneousDerivative(int parameterIndex) const {
+            // The derivative of a spline of degree p with knots u and control points P is a
+            // spline of degree p - 1 with the first and last knots removed and control points
+            // p * (P[i + 1] - P[i]) / (u[i + p + 1] - u[i + 1]) (taken as zero where the
+            // denominator is zero, since those control points have no influence)
+            int degree = _degrees[parameterIndex];
+            const std::vector<double>& knots = _knots[parameterIndex];
+            int numControlPoints = _numControlPoints[parameterIndex];
+            int numRows = 1;
+            for (int index = 0; index < parameterIndex; ++index) {
+                numRows *= _numControlPoints[index];
+            }
+            int length = _stride;
+            for (int index = parameterIndex + 1; index < numParameters(); ++index) {
+                length *= _numControlPoints[index];
+            }
+
+            std::vector<double> controlPoints(numRows * (numControlPoints - 1) * length);
+            for (int rowIndex = 0; rowIndex < numRows; ++rowIndex) {
+                const double* row = _controlPoints.data() + rowIndex * numControlPoints * length;
+                double* derivativeRow = controlPoints.data() + (
+                    rowIndex * (numControlPoints - 1) * length
+                );
+                for (int index = 0; index < numControlPoints - 1; ++index) {
+                    double knotDifference = knots[index + degree + 1] - knots[index + 1];
+                    double factor = knotDifference > 0.0 ? degree / knotDifference : 0.0;
+                    const double* current = row + index * length;
+                    const double* next = current + length;
+                    double* result = derivativeRow + index * length;
+                    for (int offset = 0; offset < length; ++offset) {
+                        result[offset] = factor * (next[offset] - current[offset]);
+                    }
+                }
+            }
+
+            std::vector<int> degrees = _degrees;
+            degrees[parameterIndex] = degree - 1;
+            std::vector<std::vector<double>> derivativeKnots = _knots;
+            derivativeKnots[parameterIndex].assign(knots.begin() + 1, knots.end() - 1);
+            return std::make_shared<BSplineExpression>(
+                _stride,
+                false,
+                degrees,
+                derivativeKnots,
+                controlPoints
+            );
+        }
+
+        ExpressionImplementationPtr
+        BSplineExpression::derivativeImpl(int parameterIndex) const {
+            if (_degrees[parameterIndex] == 0) {
+                return std::make_shared<ConstantExpression>(
+                    ColumnMatrixXd::zero(numDimensions()),
+                    numParameters()
+                );
+            }
+            ExpressionImplementationPtr derivativePtr = homogeneousDerivative(parameterIndex);
+            if (!isRational()) {
+                return derivativePtr;
+            }
+            // For a rational spline A / w, the derivative is (A' - (A / w) * w') / w
+            ExpressionImplementationPtr homogeneousPtr = std::make_shared<BSplineExpression>(
+                _stride,
+                false,
+                _degrees,
+                _knots,
+                _controlPoints
+            );
+            ExpressionImplementationPtr weightPtr = homogeneousPtr->component(_numDimensions);
+            ExpressionImplementationPtr weightDerivativePtr =
+                derivativePtr->component(_numDimensions);
+            return (
+                derivativePtr->components(0, _numDimensions) - self() * weightDerivativePtr
+            ) / weightPtr;
+        }
+
+        bool
+        BSplineExpression::isDuplicateOfImpl(const ExpressionImplementationPtr& other) const {
+            const BSplineExpression* otherSpline = other->cast<BSplineExpression>();
+            return (
+                this->isRational() == otherSpline->isRational() &&
+                this->degrees() == otherSpline->degrees() &&
+                this->knots() == otherSpline->knots() &&
+                this->controlPoints() == otherSpline->controlPoints()
+            );
+        }
+
+        std::size_t
+        BSplineExpression::structuralHashImpl() const {
+            std::size_t result = isRational() ? 1 : 0;
+            for (int index = 0; index < numParameters(); ++index) {
+                result = combineHashes(result, std::size_t(_degrees[index]));
+                result = combineHashes(result, std::size_t(_numControlPoints[index]));
+                for (double knot : _knots[index]) {
+                    result = combineHashes(result, hashValue(knot));
+                }
+            }
+            for (double controlPoint : _controlPoints) {
+                result = combineHashes(result, hashValue(controlPoint));
+            }
+            return result;
+        }
+
+        ExpressionImplementationPtr
+        BSplineExpression::deduplicatedImpl(DeduplicationCache& deduplicationCache) const {
+            return self();
+        }
+
+        ExpressionImplementationPtr
+        BSplineExpression::scalingImpl(double scale) const {
+            // Splines are affine invariant, so scaling, translation and transformation can be
+            // applied directly to the control points (to the weighted coordinates only, for
+            // rational splines)
+            std::vector<double> controlPoints = _controlPoints;
+            for (std::size_t start = 0; start < controlPoints.size(); start += _stride) {
+                for (int index = 0; index < _numDimensions; ++index) {
+                    controlPoints[start + index] *= scale;
+                }
+            }
+            return std::make_shared<BSplineExpression>(
+                _numDimensions,
+                _isRational,
+                _degrees,
+                _knots,
+                controlPoints
+            );
+        }
+
+        ExpressionImplementationPtr
+        BSplineExpression::translationImpl(const ColumnMatrixXd& columnMatrix) const {
+            std::vector<double> controlPoints = _controlPoints;
+            for (std::size_t start = 0; start < controlPoints.size(); start += _stride) {
+                double weight = _isRational ? controlPoints[start + _numDimensions] : 1.0;
+                for (int index = 0; index < _numDimensions; ++index) {
+                    controlPoints[start + index] += weight * columnMatrix(index);
+                }
+            }
+            return std::make_shared<BSplineExpression>(
+                _numDimensions,
+                _isRational,
+                _degrees,
+                _knots,
+                controlPoints
+            );
+        }
+
+        ExpressionImplementationPtr
+        BSplineExpression::transformationImpl(const MatrixXd& matrix) const {
+            int numTransformedDimensions = matrix.numRows();
+            int transformedStride = numTransformedDimensions + (_isRational ? 1 : 0);
+            int numPoints = int(_controlPoints.size()) / _stride;
+            std::vector<double> controlPoints(numPoints * transformedStride);
+            for (int pointIndex = 0; pointIndex < numPoints; ++pointIndex) {
+                const double* point = _controlPoints.data() + pointIndex * _stride;
+                double* result = controlPoints.data() + pointIndex * transformedStride;
+                for (int rowIndex = 0; rowIndex < numTransformedDimensions; ++rowIndex) {
+                    double sum = 0.0;
+                    for (int index = 0; index < _numDimensions; ++index) {
+                        sum += matrix(rowIndex, index) * point[index];
+                    }
+                    result[rowIndex] = sum;
+                }
+                if (_isRational) {
+                    result[numTransformedDimensions] = point[_numDimensions];
+                }
+            }
+            return std::make_shared<BSplineExpression>(
+                numTransformedDimensions,
+                _isRational,
+                _degrees,
+                _knots,
+                controlPoints
+            );
+        }
+
+        void
+        BSplineExpression::debugImpl(std::ostream& stream, int indent) const {
+            stream << "BSplineExpression: degrees =";
+            for (int degree : _degrees) {
+                stream << " " << degree;
+            }
+            stream << ", control points =";
+            for (int numControlPoints : _numControlPoints) {
+                stream << " " << numControlPoints;
+            }
+            if (isRational()) {
+                stream << ", rational";
+            }
+            stream << std::endl;
+        }
+
+        void
+        BSplineExpression::gather(const int* spans, double* net) const {
+            int firstStart = spans[0] - _degrees[0];
+            if (numParameters() == 1) {
+                const double* begin = _controlPoints.data() + firstStart * _stride;
+                std::copy(begin, begin + _localSize, net);
+                return;
+            }
+            int secondStart = spans[1] - _degrees[1];
+            int rowSize = (_degrees[1] + 1) * _stride;
+            for (int index = 0; index <= _degrees[0]; ++index) {
+                const double* begin = _controlPoints.data() + (
+                    ((firstStart + index) * _numControlPoints[1] + secondStart) * _stride
+                );
+                std::copy(begin, begin + rowSize, net + index * rowSize);
+            }
+        }
+
+        BSplineExpression::BSplineExpression(
+            int numDimensions,
+            bool isRational,
+            const std::vector<int>& degrees,
+            const std::vector<std::vector<double>>& knots,
+            const std::vector<double>& controlPoints
+        ) : _numDimensions(numDimensions),
+            _isRational(isRational),
+            _degrees(degrees),
+            _knots(knots),
+            _numControlPoints(degrees.size()),
+            _controlPoints(controlPoints),
+            _stride(numDimensions + (isRational ? 1 : 0)),
+            _localSize(numDimensions + (isRational ? 1 : 0)) {
+
+            int numParameters = int(degrees.size());
+            if (numDimensions < 1 || numParameters < 1 || numParameters > MAX_NUM_PARAMETERS) {
+                throw Error(new PlaceholderError());
+            }
+            if (int(knots.size()) != numParameters) {
+                throw Error(new PlaceholderError());
+            }
+            std::size_t totalNumControlPoints = 1;
+            for (int parameterIndex = 0; parameterIndex < numParameters; ++parameterIndex) {
+                int degree = degrees[parameterIndex];
+                const std::vector<double>& parameterKnots = knots[parameterIndex];
+                int numControlPoints = int(parameterKnots.size()) - degree - 1;
+                if (degree < 0 || numControlPoints < degree + 1) {
+                    throw Error(new PlaceholderError());
+                }
+                for (std::size_t index = 0; index < parameterKnots.size(); ++index) {
+                    if (!(std::abs(parameterKnots[index]) < std::numeric_limits<double>::max())) {
+                        throw Error(new PlaceholderError());
+                    }
+                    if (index > 0 && parameterKnots[index] < parameterKnots[index - 1]) {
+                        throw Error(new PlaceholderError());
+                    }
+                }
+                // Spans at either end of the domain must be non-empty, so that span() never
+                // returns an empty span
+                bool hasValidEnds = (
+                    parameterKnots[degree] < parameterKnots[degree + 1] &&
+                    parameterKnots[numControlPoints - 1] < parameterKnots[numControlPoints]
+                );
+                if (!hasValidEnds) {
+                    throw Error(new PlaceholderError());
+                }
+                _numControlPoints[parameterIndex] = numControlPoints;
+                _localSize *= degree + 1;
+                totalNumControlPoints *= numControlPoints;
+            }
+            if (controlPoints.size() != totalNumControlPoints * _stride) {
+                throw Error(new PlaceholderError());
+            }
+            if (isRational) {
+                for (std::size_t start = 0; start < controlPoints.size(); start += _stride) {
+                    if (!(controlPoints[start + numDimensions] > 0.0)) {
+                        throw Error(new PlaceholderError());
+                    }
+                }
+            }
+        }
+
+        Interval
+        BSplineExpression::domain(int parameterIndex) const {
+            const std::vector<double>& knots = _knots[parameterIndex];
+            return Interval(
+                knots[_degrees[parameterIndex]],
+                knots[_numControlPoints[parameterIndex]]
+            );
+        }
+
+        int
+        BSplineExpression::span(int parameterIndex, double parameterValue) const {
+            // Search only the interior knots, so that values outside the domain give the first
+            // or last span
+            const std::vector<double>& knots = _knots[parameterIndex];
+            auto begin = knots.begin() + _degrees[parameterIndex] + 1;
+            auto end = knots.begin() + _numControlPoints[parameterIndex];
+            return int(std::upper_bound(begin, end, parameterValue) - knots.begin()) - 1;
+        }
+
+        void
+        BSplineExpression::evaluate(const double* parameterValues, double* results) const {
+            int spans[MAX_NUM_PARAMETERS];
+            for (int index = 0; index < numParameters(); ++index) {
+                spans[index] = span(index, parameterValues[index]);
+            }
+            double localBuffer[LOCAL_BUFFER_SIZE];
+            std::vector<double> heapBuffer;
+            double* net = localBuffer;
+            if (_localSize > LOCAL_BUFFER_SIZE) {
+                heapBuffer.resize(_localSize);
+                net = heapBuffer.data();
+            }
+            gather(spans, net);
+
+            // Reduce along each parameter in turn, treating each row of the net as a single
+            // (long) control point
+            double* block = net;
+            int length = _localSize;
+            for (int index = 0; index < numParameters(); ++index) {
+                int degree = _degrees[index];
+                double parameterValue = parameterValues[index];
+                length /= degree + 1;
+                deBoor(
+                    block,
+                    length,
+                    degree,
+                    _knots[index].data(),
+                    spans[index],
+                    [parameterValue] (int level) {
+                        return parameterValue;
+                    }
+                );
+                block += degree * length;
+            }
+            if (isRational()) {
+                double weight = block[_numDimensions];
+                for (int index = 0; index < _numDimensions; ++index) {
+                    results[index] = block[index] / weight;
+                }
+            } else {
+                std::copy(block, block + _numDimensions, results);
+            }
+        }
+
+        void
+        BSplineExpression::evaluate(const Interval* parameterBounds, Interval* results) const {
+            bool isSinglePoint = true;
+            for (int index = 0; index < numParameters(); ++index) {
+                Interval bounds = parameterBounds[index];
+                if (bounds.isEmpty()) {
+                    std::fill(results, results + _numDimensions, Interval::EMPTY());
+                    return;
+                }
+                if (!isBounded(bounds)) {
+                    std::fill(results, results + _numDimensions, Interval::WHOLE());
+                    return;
+                }
+                if (bounds.width() > 0.0) {
+                    isSinglePoint = false;
+                }
+            }
+            if (isSinglePoint) {
+                double parameterValues[MAX_NUM_PARAMETERS];
+                double values[LOCAL_BUFFER_SIZE];
+                std::vector<double> heapValues;
+                double* resultValues = values;
+                if (_numDimensions > LOCAL_BUFFER_SIZE) {
+                    heapValues.resize(_numDimensions);
+                    resultValues = heapValues.data();
+                }
+                for (int index = 0; index < numParameters(); ++index) {
+                    parameterValues[index] = parameterBounds[index].lowerBound();
+                }
+                evaluate(parameterValues, resultValues);
+                for (int index = 0; index < _numDimensions; ++index) {
+                    results[index] = Interval(resultValues[index]);
+                }
+                return;
+            }
+
+            int lowerSpans[MAX_NUM_PARAMETERS];
+            int upperSpans[MAX_NUM_PARAMETERS];
+            int numSpans = 1;
+            for (int index = 0; index < numParameters(); ++index) {
+                lowerSpans[index] = span(index, parameterBounds[index].lowerBound());
+                upperSpans[index] = span(index, parameterBounds[index].upperBound());
+                numSpans *= upperSpans[index] - lowerSpans[index] + 1;
+            }
+            bool restrictAll = numSpans <= MAX_NUM_RESTRICTED_SPANS;
+
+            std::vector<double> net(_localSize);
+            std::vector<double> original;
+            std::vector<double> work;
+            std::vector<double> minValues(_numDimensions, std::numeric_limits<double>::max());
+            std::vector<double> maxValues(_numDimensions, -std::numeric_limits<double>::max());
+            int spans[MAX_NUM_PARAMETERS];
+            std::copy(lowerSpans, lowerSpans + numParameters(), spans);
+            while (true) {
+                // Bounds of each parameter within the current spans (extending past the end of
+                // the first or last span where extrapolating)
+                double lowerValues[MAX_NUM_PARAMETERS];
+                double upperValues[MAX_NUM_PARAMETERS];
+                bool isEmptySpan = false;
+                bool needsRestriction = restrictAll;
+                for (int index = 0; index < numParameters(); ++index) {
+                    const std::vector<double>& knots = _knots[index];
+                    int spanIndex = spans[index];
+                    if (!(knots[spanIndex] < knots[spanIndex + 1])) {
+                        isEmptySpan = true;
+                    }
+                    lowerValues[index] = knots[spanIndex];
+                    upperValues[index] = knots[spanIndex + 1];
+                    if (spanIndex == lowerSpans[index]) {
+                        lowerValues[index] = parameterBounds[index].lowerBound();
+                    }
+                    if (spanIndex == upperSpans[index]) {
+                        upperValues[index] = parameterBounds[index].upperBound();
+                    }
+                    bool isOutsideSpan = (
+                        lowerValues[index] < knots[spanIndex] ||
+                        upperValues[index] > knots[spanIndex + 1]
+                    );
+                    if (isOutsideSpan) {
+                        // Control points only bound the spline within their span
+                        needsRestriction = true;
+                    }
+                }
+
+                if (!isEmptySpan) {
+                    gather(spans, net.data());
+                    if (needsRestriction) {
+                        int numRows = 1;
+                        int length = _localSize;
+                        for (int index = 0; index < numParameters(); ++index) {
+                            int degree = _degrees[index];
+                            length /= degree + 1;
+                            restrict(
+                                net.data(),
+                                numRows,
+                                length,
+                                degree,
+                                _knots[index].data(),
+                                spans[index],
+                                lowerValues[index],
+                                upperValues[index],
+                                original,
+                                work
+                            );
+                            numRows *= degree + 1;
+                        }
+                    }
+                    for (int start = 0; start < _localSize; start += _stride) {
+                        const double* point = net.data() + start;
+                        double weight = 1.0;
+                        if (isRational()) {
+                            weight = point[_numDimensions];
+                            if (!(weight > 0.0)) {
+                                // Possible when extrapolating; rational control points then
+                                // no longer bound the spline
+                                std::fill(results, results + _numDimensions, Interval::WHOLE());
+                                return;
+                            }
+                        }
+                        for (int index = 0; index < _numDimensions; ++index) {
+                            double value = point[index] / weight;
+                            minValues[index] = std::min(minValues[index], value);
+                            maxValues[index] = std::max(maxValues[index], value);
+                        }
+                    }
+                }
+
+                // Advance to the next combination of spans, with the last parameter varying
+                // fastest
+                int index = numParameters() - 1;
+                while (index >= 0 && spans[index] == upperSpans[index]) {
+                    spans[index] = lowerSpans[index];
+                    --index;
+                }
+                if (index < 0) {
+                    break;
+                }
+                ++spans[index];
+            }
+            for (int index = 0; index < _numDimensions; ++index) {
+                results[index] = Interval(minValues[index], maxValues[index]);
+            }
+        }
+    }
+}
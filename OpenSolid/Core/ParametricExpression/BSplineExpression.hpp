@@ -0,0 +1,199 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#pragma once
+
+#include <OpenSolid/config.hpp>
+
+#include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.definitions.hpp>
+
+#include <vector>
+
+namespace opensolid
+{
+    namespace detail
+    {
+        // Tensor product B-spline (curve or surface, rational or not) evaluated directly using
+        // de Boor's algorithm, instead of being built up from elementary expressions. Control
+        // points are stored with the index along the last parameter varying fastest, each as
+        // numDimensions consecutive coordinates followed (for rational splines) by its weight;
+        // coordinates of rational control points are stored already multiplied by the weight.
+        class BSplineExpression :
+            public ExpressionImplementation
+        {
+        private:
+            int _numDimensions;
+            bool _isRational;
+            std::vector<int> _degrees;
+            std::vector<std::vector<double>> _knots;
+            std::vector<int> _numControlPoints;
+            std::vector<double> _controlPoints;
+
+            // Number of values stored per control point (including any weight)
+            int _stride;
+
+            // Number of values in the control points influencing a single span
+            int _localSize;
+
+            OPENSOLID_CORE_EXPORT
+            int
+            numDimensionsImpl() const override;
+
+            OPENSOLID_CORE_EXPORT
+            int
+            numParametersImpl() const override;
+
+            OPENSOLID_CORE_EXPORT
+            std::vector<int>
+            compileImpl(
+                const std::vector<int>& parameterRegisters,
+                Compiler& compiler
+            ) const override;
+
+            OPENSOLID_CORE_EXPORT
+            std::vector<Interval>
+            boundsImpl(Contractor& contractor) const override;
+
+            OPENSOLID_CORE_EXPORT
+            ExpressionImplementationPtr
+            derivativeImpl(int parameterIndex) const override;
+
+            OPENSOLID_CORE_EXPORT
+            bool
+            isDuplicateOfImpl(const ExpressionImplementationPtr& other) const override;
+
+            OPENSOLID_CORE_EXPORT
+            std::size_t
+            structuralHashImpl() const override;
+
+            OPENSOLID_CORE_EXPORT
+            ExpressionImplementationPtr
+            deduplicatedImpl(DeduplicationCache& deduplicationCache) const override;
+
+            OPENSOLID_CORE_EXPORT
+            ExpressionImplementationPtr
+            scalingImpl(double scale) const override;
+
+            OPENSOLID_CORE_EXPORT
+            ExpressionImplementationPtr
+            translationImpl(const ColumnMatrixXd& columnMatrix) const override;
+
+            OPENSOLID_CORE_EXPORT
+            ExpressionImplementationPtr
+            transformationImpl(const MatrixXd& matrix) const override;
+
+            OPENSOLID_CORE_EXPORT
+            void
+            debugImpl(std::ostream& stream, int indent) const override;
+
+            // Non-rational spline giving the derivative of the homogeneous form of this spline
+            // (the weighted coordinates followed by the weight) with respect to one parameter
+            ExpressionImplementationPtr
+            homogeneousDerivative(int parameterIndex) const;
+
+            // Copy the control points influencing the given spans into a contiguous local net
+            void
+            gather(const int* spans, double* net) const;
+        public:
+            static const int MAX_NUM_PARAMETERS = 2;
+
+            // Throws if the degrees, knots and control points are not consistent, if any
+            // knot vector is decreasing or has repeated end knots beyond the degree plus one,
+            // or if any weight is not positive
+            OPENSOLID_CORE_EXPORT
+            BSplineExpression(
+                int numDimensions,
+                bool isRational,
+                const std::vector<int>& degrees,
+                const std::vector<std::vector<double>>& knots,
+                const std::vector<double>& controlPoints
+            );
+
+            bool
+            isRational() const;
+
+            const std::vector<int>&
+            degrees() const;
+
+            const std::vector<std::vector<double>>&
+            knots() const;
+
+            const std::vector<double>&
+            controlPoints() const;
+
+            // Range of values of the given parameter over which the spline is defined; outside
+            // of this range the first or last polynomial piece is extrapolated
+            OPENSOLID_CORE_EXPORT
+            Interval
+            domain(int parameterIndex) const;
+
+            // Index of the (non-empty) knot span containing the given parameter value, found
+            // by binary search
+            OPENSOLID_CORE_EXPORT
+            int
+            span(int parameterIndex, double parameterValue) const;
+
+            OPENSOLID_CORE_EXPORT
+            void
+            evaluate(const double* parameterValues, double* results) const;
+
+            // Bounds on the spline over the given parameter bounds, computed from the hull of
+            // the control points of each span restricted to the parameter bounds (or from the
+            // hull of the original control points of each span, if the bounds cover many spans)
+            OPENSOLID_CORE_EXPORT
+            void
+            evaluate(const Interval* parameterBounds, Interval* results) const;
+        };
+    }
+}
+
+namespace opensolid
+{
+    namespace detail
+    {
+        inline
+        bool
+        BSplineExpression::isRational() const {
+            return _isRational;
+        }
+
+        inline
+        const std::vector<int>&
+        BSplineExpression::degrees() const {
+            return _degrees;
+        }
+
+        inline
+        const std::vector<std::vector<double>>&
+        BSplineExpression::knots() const {
+            return _knots;
+        }
+
+        inline
+        const std::vector<double>&
+        BSplineExpression::controlPoints() const {
+            return _controlPoints;
+        }
+    }
+}
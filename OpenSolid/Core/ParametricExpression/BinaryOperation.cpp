@@ -51,6 +51,15 @@ namespace opensolid
             );
         }
 
+        std::size_t
+        BinaryOperation::structuralHashImpl() const {
+            // Combine operand hashes symmetrically, since commutative operations consider
+            // expressions with swapped operands to be duplicates
+            std::size_t firstHash = combineHashes(0, firstOperand()->structuralHash());
+            std::size_t secondHash = combineHashes(0, secondOperand()->structuralHash());
+            return firstHash + secondHash;
+        }
+
         bool
         BinaryOperation::duplicateOperands(
             const ExpressionImplementationPtr& other,
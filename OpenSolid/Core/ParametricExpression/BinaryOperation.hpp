@@ -47,6 +47,10 @@ namespace opensolid
             ExpressionImplementationPtr
             deduplicatedImpl(DeduplicationCache& deduplicationCache) const override;
 
+            OPENSOLID_CORE_EXPORT
+            std::size_t
+            structuralHashImpl() const override;
+
             OPENSOLID_CORE_EXPORT
             ExpressionImplementationPtr
             composedImpl(const ExpressionImplementationPtr& innerExpression) const override;
@@ -0,0 +1,327 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#include <OpenSolid/Core/ParametricExpression/Bytecode/BatchKernels.hpp>
+
+// Explicit SSE2/AVX2 kernels are only built with compilers supporting per-function target
+// attributes and runtime CPU feature detection; other builds use the portable kernels only
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #define OPENSOLID_X86_BATCH_KERNELS
+    #include <immintrin.h>
+#endif
+
+namespace opensolid
+{
+    namespace detail
+    {
+        namespace
+        {
+            void
+            negateScalar(const double* operand, double* result, int count) {
+                for (int i = 0; i < count; ++i) {
+                    result[i] = -operand[i];
+                }
+            }
+
+            void
+            squareScalar(const double* operand, double* result, int count) {
+                for (int i = 0; i < count; ++i) {
+                    result[i] = operand[i] * operand[i];
+                }
+            }
+
+            void
+            sqrtScalar(const double* operand, double* result, int count) {
+                for (int i = 0; i < count; ++i) {
+                    result[i] = opensolid::sqrt(operand[i]);
+                }
+            }
+
+            void
+            addScalar(const double* first, const double* second, double* result, int count) {
+                for (int i = 0; i < count; ++i) {
+                    result[i] = first[i] + second[i];
+                }
+            }
+
+            void
+            subtractScalar(const double* first, const double* second, double* result, int count) {
+                for (int i = 0; i < count; ++i) {
+                    result[i] = first[i] - second[i];
+                }
+            }
+
+            void
+            multiplyScalar(const double* first, const double* second, double* result, int count) {
+                for (int i = 0; i < count; ++i) {
+                    result[i] = first[i] * second[i];
+                }
+            }
+
+            void
+            divideScalar(const double* first, const double* second, double* result, int count) {
+                for (int i = 0; i < count; ++i) {
+                    result[i] = first[i] / second[i];
+                }
+            }
+
+            #ifdef OPENSOLID_X86_BATCH_KERNELS
+
+            __attribute__((target("sse2")))
+            void
+            negateSse2(const double* operand, double* result, int count) {
+                // Flip the sign bit (as scalar negation does) instead of subtracting from zero,
+                // which would give +0.0 instead of -0.0 for a zero operand
+                __m128d signMask = _mm_set1_pd(-0.0);
+                int i = 0;
+                for (; i + 2 <= count; i += 2) {
+                    _mm_storeu_pd(result + i, _mm_xor_pd(_mm_loadu_pd(operand + i), signMask));
+                }
+                negateScalar(operand + i, result + i, count - i);
+            }
+
+            __attribute__((target("sse2")))
+            void
+            squareSse2(const double* operand, double* result, int count) {
+                int i = 0;
+                for (; i + 2 <= count; i += 2) {
+                    __m128d value = _mm_loadu_pd(operand + i);
+                    _mm_storeu_pd(result + i, _mm_mul_pd(value, value));
+                }
+                squareScalar(operand + i, result + i, count - i);
+            }
+
+            __attribute__((target("sse2")))
+            void
+            sqrtSse2(const double* operand, double* result, int count) {
+                int i = 0;
+                for (; i + 2 <= count; i += 2) {
+                    _mm_storeu_pd(result + i, _mm_sqrt_pd(_mm_loadu_pd(operand + i)));
+                }
+                sqrtScalar(operand + i, result + i, count - i);
+            }
+
+            __attribute__((target("sse2")))
+            void
+            addSse2(const double* first, const double* second, double* result, int count) {
+                int i = 0;
+                for (; i + 2 <= count; i += 2) {
+                    __m128d sum = _mm_add_pd(_mm_loadu_pd(first + i), _mm_loadu_pd(second + i));
+                    _mm_storeu_pd(result + i, sum);
+                }
+                addScalar(first + i, second + i, result + i, count - i);
+            }
+
+            __attribute__((target("sse2")))
+            void
+            subtractSse2(const double* first, const double* second, double* result, int count) {
+                int i = 0;
+                for (; i + 2 <= count; i += 2) {
+                    __m128d difference = _mm_sub_pd(
+                        _mm_loadu_pd(first + i),
+                        _mm_loadu_pd(second + i)
+                    );
+                    _mm_storeu_pd(result + i, difference);
+                }
+                subtractScalar(first + i, second + i, result + i, count - i);
+            }
+
+            __attribute__((target("sse2")))
+            void
+            multiplySse2(const double* first, const double* second, double* result, int count) {
+                int i = 0;
+                for (; i + 2 <= count; i += 2) {
+                    __m128d product = _mm_mul_pd(
+                        _mm_loadu_pd(first + i),
+                        _mm_loadu_pd(second + i)
+                    );
+                    _mm_storeu_pd(result + i, product);
+                }
+                multiplyScalar(first + i, second + i, result + i, count - i);
+            }
+
+            __attribute__((target("sse2")))
+            void
+            divideSse2(const double* first, const double* second, double* result, int count) {
+                int i = 0;
+                for (; i + 2 <= count; i += 2) {
+                    __m128d quotient = _mm_div_pd(
+                        _mm_loadu_pd(first + i),
+                        _mm_loadu_pd(second + i)
+                    );
+                    _mm_storeu_pd(result + i, quotient);
+                }
+                divideScalar(first + i, second + i, result + i, count - i);
+            }
+
+            __attribute__((target("avx2")))
+            void
+            negateAvx2(const double* operand, double* result, int count) {
+                __m256d signMask = _mm256_set1_pd(-0.0);
+                int i = 0;
+                for (; i + 4 <= count; i += 4) {
+                    __m256d negated = _mm256_xor_pd(_mm256_loadu_pd(operand + i), signMask);
+                    _mm256_storeu_pd(result + i, negated);
+                }
+                negateScalar(operand + i, result + i, count - i);
+            }
+
+            __attribute__((target("avx2")))
+            void
+            squareAvx2(const double* operand, double* result, int count) {
+                int i = 0;
+                for (; i + 4 <= count; i += 4) {
+                    __m256d value = _mm256_loadu_pd(operand + i);
+                    _mm256_storeu_pd(result + i, _mm256_mul_pd(value, value));
+                }
+                squareScalar(operand + i, result + i, count - i);
+            }
+
+            __attribute__((target("avx2")))
+            void
+            sqrtAvx2(const double* operand, double* result, int count) {
+                int i = 0;
+                for (; i + 4 <= count; i += 4) {
+                    _mm256_storeu_pd(result + i, _mm256_sqrt_pd(_mm256_loadu_pd(operand + i)));
+                }
+                sqrtScalar(operand + i, result + i, count - i);
+            }
+
+            __attribute__((target("avx2")))
+            void
+            addAvx2(const double* first, const double* second, double* result, int count) {
+                int i = 0;
+                for (; i + 4 <= count; i += 4) {
+                    __m256d sum = _mm256_add_pd(
+                        _mm256_loadu_pd(first + i),
+                        _mm256_loadu_pd(second + i)
+                    );
+                    _mm256_storeu_pd(result + i, sum);
+                }
+                addScalar(first + i, second + i, result + i, count - i);
+            }
+
+            __attribute__((target("avx2")))
+            void
+            subtractAvx2(const double* first, const double* second, double* result, int count) {
+                int i = 0;
+                for (; i + 4 <= count; i += 4) {
+                    __m256d difference = _mm256_sub_pd(
+                        _mm256_loadu_pd(first + i),
+                        _mm256_loadu_pd(second + i)
+                    );
+                    _mm256_storeu_pd(result + i, difference);
+                }
+                subtractScalar(first + i, second + i, result + i, count - i);
+            }
+
+            __attribute__((target("avx2")))
+            void
+            multiplyAvx2(const double* first, const double* second, double* result, int count) {
+                int i = 0;
+                for (; i + 4 <= count; i += 4) {
+                    __m256d product = _mm256_mul_pd(
+                        _mm256_loadu_pd(first + i),
+                        _mm256_loadu_pd(second + i)
+                    );
+                    _mm256_storeu_pd(result + i, product);
+                }
+                multiplyScalar(first + i, second + i, result + i, count - i);
+            }
+
+            __attribute__((target("avx2")))
+            void
+            divideAvx2(const double* first, const double* second, double* result, int count) {
+                int i = 0;
+                for (; i + 4 <= count; i += 4) {
+                    __m256d quotient = _mm256_div_pd(
+                        _mm256_loadu_pd(first + i),
+                        _mm256_loadu_pd(second + i)
+                    );
+                    _mm256_storeu_pd(result + i, quotient);
+                }
+                divideScalar(first + i, second + i, result + i, count - i);
+            }
+
+            #endif
+
+            BatchKernels
+            selectKernels() {
+                #ifdef OPENSOLID_X86_BATCH_KERNELS
+                __builtin_cpu_init();
+                if (__builtin_cpu_supports("avx2")) {
+                    BatchKernels avx2Kernels = {
+                        "AVX2",
+                        negateAvx2,
+                        squareAvx2,
+                        sqrtAvx2,
+                        addAvx2,
+                        subtractAvx2,
+                        multiplyAvx2,
+                        divideAvx2
+                    };
+                    return avx2Kernels;
+                }
+                if (__builtin_cpu_supports("sse2")) {
+                    BatchKernels sse2Kernels = {
+                        "SSE2",
+                        negateSse2,
+                        squareSse2,
+                        sqrtSse2,
+                        addSse2,
+                        subtractSse2,
+                        multiplySse2,
+                        divideSse2
+                    };
+                    return sse2Kernels;
+                }
+                #endif
+                return BatchKernels::scalar();
+            }
+        }
+
+        const int BatchKernels::BLOCK_SIZE;
+
+        const BatchKernels&
+        BatchKernels::scalar() {
+            static const BatchKernels scalarKernels = {
+                "Scalar",
+                negateScalar,
+                squareScalar,
+                sqrtScalar,
+                addScalar,
+                subtractScalar,
+                multiplyScalar,
+                divideScalar
+            };
+            return scalarKernels;
+        }
+
+        const BatchKernels&
+        BatchKernels::best() {
+            static const BatchKernels bestKernels = selectKernels();
+            return bestKernels;
+        }
+    }
+}
@@ -0,0 +1,76 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#pragma once
+
+#include <OpenSolid/config.hpp>
+
+#include <OpenSolid/Core/ParametricExpression/Bytecode/BatchKernels.declarations.hpp>
+
+namespace opensolid
+{
+    namespace detail
+    {
+        // Elementwise kernels used by the bytecode evaluator when evaluating a block of parameter
+        // columns at once. Each kernel operates on 'count' contiguous values; input and output
+        // arrays never overlap. Several instruction-set-specific implementations exist, and the
+        // best one supported by the current CPU is selected at runtime. Only instructions whose
+        // vectorized results are bit-identical to scalar evaluation have kernels; transcendental
+        // functions (sin, cos, exp, log, pow etc.) are evaluated per column using the standard
+        // library.
+        struct BatchKernels
+        {
+            // Number of columns evaluated together by the blocked evaluator
+            static const int BLOCK_SIZE = 16;
+
+            typedef void (*UnaryKernel)(const double* operand, double* result, int count);
+
+            typedef void (*BinaryKernel)(
+                const double* firstOperand,
+                const double* secondOperand,
+                double* result,
+                int count
+            );
+
+            const char* name;
+            UnaryKernel negate;
+            UnaryKernel square;
+            UnaryKernel sqrt;
+            BinaryKernel add;
+            BinaryKernel subtract;
+            BinaryKernel multiply;
+            BinaryKernel divide;
+
+            // Portable implementation, always available
+            OPENSOLID_CORE_EXPORT
+            static const BatchKernels&
+            scalar();
+
+            // Fastest implementation supported by the current CPU
+            OPENSOLID_CORE_EXPORT
+            static const BatchKernels&
+            best();
+        };
+    }
+}
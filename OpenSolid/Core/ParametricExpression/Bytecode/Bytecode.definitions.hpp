@@ -28,105 +28,71 @@
 
 #include <OpenSolid/Core/ParametricExpression/Bytecode/Bytecode.declarations.hpp>
 
+#include <memory>
+#include <vector>
+
 namespace opensolid
 {
     namespace detail
     {
+        class BSplineExpression;
+
         class Bytecode
         {
         public:
+            // Instructions operate on individual scalar registers. Each instruction is stored
+            // as its opcode followed by its operands and finally the index of the register to
+            // store the result in.
             enum Instruction
             {
-                DBL_ADD_DBL,
-                VEC2_ADD_VEC2,
-                VEC3_ADD_VEC3,
-                INT_ADD_INT,
-                BOX2_ADD_BOX2,
-                BOX3_ADD_BOX3,
-                INT_ADD_DBL,
-                BOX2_ADD_VEC2,
-                BOX3_ADD_VEC3,
-
-                DBL_SUB_DBL,
-                VEC2_SUB_VEC2,
-                VEC3_SUB_VEC3,
-                INT_SUB_INT,
-                BOX2_SUB_BOX2,
-                BOX3_SUB_BOX3,
-                INT_SUB_DBL,
-                BOX2_SUB_VEC2,
-                BOX3_SUB_VEC3,
-
-                DBL_MUL_DBL,
-                VEC2_MUL_DBL,
-                VEC3_MUL_DBL,
-                INT_MUL_INT,
-                BOX2_MUL_INT,
-                BOX3_MUL_INT,
-                INT_MUL_DBL,
-                BOX2_MUL_DBL,
-                BOX3_MUL_DBL,
+                // [NEGATE, operand, result]
+                NEGATE,
 
-                DBL_DIV_DBL,
-                VEC2_DIV_DBL,
-                VEC3_DIV_DBL,
-                INT_DIV_INT,
-                BOX2_DIV_INT,
-                BOX3_DIV_INT,
-                INT_DIV_DBL,
-                BOX2_DIV_DBL,
-                BOX3_DIV_DBL,
+                // [ADD, firstOperand, secondOperand, result]
+                ADD,
+                SUBTRACT,
+                MULTIPLY,
+                DIVIDE,
 
-                VEC2_NORMALIZE,
-                VEC3_NORMALIZE,
-                BOX2_NORMALIZE,
-                BOX3_NORMALIZE
+                // [SQUARE, operand, result]
+                SQUARE,
+                SQRT,
+                SIN,
+                COS,
+                TAN,
+                ASIN,
+                ACOS,
+                EXP,
+                LOG,
 
-                DBL_EQ_DBL,
-                VEC2_EQ_VEC2,
-                VEC3_EQ_VEC3,
-                INT_EQ_INT,
-                BOX2_EQ_BOX2,
-                BOX3_EQ_BOX3,
-                INT_EQ_DBL,
-                BOX2_EQ_VEC2,
-                BOX3_EQ_VEC3,
+                // [POW, base, exponent, result]
+                POW,
 
-                INT_EQ_DBL_SUB_INT,
-                BOX2_EQ_VEC2_SUB_BOX2,
-                BOX3_EQ_VEC3_SUB_BOX3,
+                // [CONSTANT_POW, base, literal index, result]
+                CONSTANT_POW,
 
-                INT_EQ_DBL_MUL_INT,
-                BOX2_EQ_VEC2_MUL_INT,
-                BOX3_EQ_VEC3_MUL_INT,
+                // [INTEGER_POW, base, integer exponent, result]
+                INTEGER_POW,
 
-                INT_EQ_DBL_DIV_INT,
-                BOX2_EQ_VEC2_DIV_INT,
-                BOX3_EQ_VEC3_DIV_INT,
+                // [CHECK_NONZERO, operand] - throws if operand is zero
+                CHECK_NONZERO,
 
-                DBL_EQ_VEC2_DOT_VEC2,
-                DBL_EQ_VEC3_DOT_VEC3,
-                INT_EQ_BOX2_DOT_BOX2,
-                INT_EQ_BOX3_DOT_BOX3,
-                INT_EQ_VEC2_DOT_BOX2,
-                INT_EQ_VEC3_DOT_BOX3,
-                INT_EQ_BOX2_DOT_VEC2,
-                INT_EQ_BOX3_DOT_VEC3,
-
-                VEC3_EQ_VEC3_CROSS_VEC3,
-                BOX3_EQ_BOX3_CROSS_BOX3,
-                BOX3_EQ_VEC3_CROSS_BOX3,
-                BOX3_EQ_BOX3_CROSS_VEC3,
+                // [BSPLINE, spline call index, first result] - evaluates a B-spline, storing
+                // its values in consecutive registers starting at the first result
+                BSPLINE
+            };
 
-                DBL_EQ_VEC2_SQUARED_NORM,
-                DBL_EQ_VEC3_SQUARED_NORM,
-                INT_EQ_BOX2_SQUARED_NORM,
-                INT_EQ_BOX3_SQUARED_NORM,
-                DBL_EQ_VEC2_NORM,
-                DBL_EQ_VEC3_NORM,
-                INT_EQ_BOX2_NORM,
-                INT_EQ_BOX3_NORM
+            // B-spline evaluated by a BSPLINE instruction, along with the registers holding
+            // its parameter values
+            struct SplineCall
+            {
+                std::shared_ptr<const BSplineExpression> splinePtr;
+                std::vector<int> parameterRegisters;
             };
-        };   
+
+            OPENSOLID_CORE_EXPORT
+            static int
+            numOperands(Instruction instruction);
+        };
     }
 }
@@ -27,10 +27,3 @@
 #include <OpenSolid/config.hpp>
 
 #include <OpenSolid/Core/ParametricExpression/Bytecode/Bytecode.definitions.hpp>
-
-namespace opensolid
-{
-    namespace detail
-    {
-    }
-}
@@ -0,0 +1,242 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#include <OpenSolid/Core/ParametricExpression/Bytecode/Compiler.hpp>
+
+#include <OpenSolid/Core/ParametricExpression/BSplineExpression.hpp>
+#include <OpenSolid/Core/ParametricExpression/DeduplicationCache.hpp>
+#include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
+#include <OpenSolid/Core/ParametricExpression/Simplifier.hpp>
+
+#include <cstring>
+
+namespace opensolid
+{
+    namespace detail
+    {
+        int
+        Compiler::allocateRegister() {
+            return _numRegisters++;
+        }
+
+        Compiler::Compiler(int numParameters) :
+            _numRegisters(numParameters) {
+        }
+
+        std::vector<int>
+        Compiler::evaluate(
+            const ExpressionImplementationPtr& expressionPtr,
+            const std::vector<int>& parameterRegisters
+        ) {
+            EvaluationKey key(expressionPtr.get(), parameterRegisters);
+            auto iterator = _evaluationCache.find(key);
+            if (iterator != _evaluationCache.end()) {
+                return iterator->second;
+            }
+            std::vector<int> resultRegisters = expressionPtr->compile(parameterRegisters, *this);
+            assert(int(resultRegisters.size()) == expressionPtr->numDimensions());
+            _evaluationCache.insert(std::make_pair(key, resultRegisters));
+            return resultRegisters;
+        }
+
+        int
+        Compiler::constant(double value) {
+            std::uint64_t key;
+            std::memcpy(&key, &value, sizeof(double));
+            auto iterator = _constantCache.find(key);
+            if (iterator != _constantCache.end()) {
+                return iterator->second;
+            }
+            int resultRegister = allocateRegister();
+            _constantRegisters.push_back(resultRegister);
+            _constantValues.push_back(value);
+            _constantCache.insert(std::make_pair(key, resultRegister));
+            return resultRegister;
+        }
+
+        int
+        Compiler::compute(Bytecode::Instruction instruction, int operandRegister) {
+            assert(Bytecode::numOperands(instruction) == 2);
+            int resultRegister = allocateRegister();
+            _instructions.push_back(instruction);
+            _instructions.push_back(operandRegister);
+            _instructions.push_back(resultRegister);
+            return resultRegister;
+        }
+
+        int
+        Compiler::compute(
+            Bytecode::Instruction instruction,
+            int firstOperandRegister,
+            int secondOperandRegister
+        ) {
+            assert(Bytecode::numOperands(instruction) == 3);
+            int resultRegister = allocateRegister();
+            _instructions.push_back(instruction);
+            _instructions.push_back(firstOperandRegister);
+            _instructions.push_back(secondOperandRegister);
+            _instructions.push_back(resultRegister);
+            return resultRegister;
+        }
+
+        int
+        Compiler::computeConstantPower(int baseRegister, double exponent) {
+            int resultRegister = allocateRegister();
+            _instructions.push_back(Bytecode::CONSTANT_POW);
+            _instructions.push_back(baseRegister);
+            _instructions.push_back(int(_literals.size()));
+            _instructions.push_back(resultRegister);
+            _literals.push_back(exponent);
+            return resultRegister;
+        }
+
+        int
+        Compiler::computeIntegerPower(int baseRegister, int exponent) {
+            int resultRegister = allocateRegister();
+            _instructions.push_back(Bytecode::INTEGER_POW);
+            _instructions.push_back(baseRegister);
+            _instructions.push_back(exponent);
+            _instructions.push_back(resultRegister);
+            return resultRegister;
+        }
+
+        void
+        Compiler::checkNonZero(int operandRegister) {
+            _instructions.push_back(Bytecode::CHECK_NONZERO);
+            _instructions.push_back(operandRegister);
+        }
+
+        std::vector<int>
+        Compiler::computeSpline(
+            const std::shared_ptr<const BSplineExpression>& splinePtr,
+            const std::vector<int>& parameterRegisters
+        ) {
+            assert(int(parameterRegisters.size()) == splinePtr->numParameters());
+            Bytecode::SplineCall splineCall;
+            splineCall.splinePtr = splinePtr;
+            splineCall.parameterRegisters = parameterRegisters;
+
+            int numDimensions = splinePtr->numDimensions();
+            std::vector<int> resultRegisters(numDimensions);
+            for (int index = 0; index < numDimensions; ++index) {
+                resultRegisters[index] = allocateRegister();
+            }
+            _instructions.push_back(Bytecode::BSPLINE);
+            _instructions.push_back(int(_splineCalls.size()));
+            _instructions.push_back(resultRegisters.front());
+            _splineCalls.push_back(splineCall);
+            return resultRegisters;
+        }
+
+        Evaluator
+        Compiler::compile(const std::vector<ExpressionImplementationPtr>& expressions) {
+            assert(!expressions.empty());
+            int numParameters = expressions.front()->numParameters();
+            std::vector<int> parameterRegisters(numParameters);
+            for (int parameterIndex = 0; parameterIndex < numParameters; ++parameterIndex) {
+                parameterRegisters[parameterIndex] = parameterIndex;
+            }
+
+            Compiler compiler(numParameters);
+            std::vector<int> resultRegisters;
+            for (const ExpressionImplementationPtr& expressionPtr : expressions) {
+                assert(expressionPtr->numParameters() == numParameters);
+                std::vector<int> expressionRegisters =
+                    compiler.evaluate(expressionPtr, parameterRegisters);
+                resultRegisters.insert(
+                    resultRegisters.end(),
+                    expressionRegisters.begin(),
+                    expressionRegisters.end()
+                );
+            }
+
+            return Evaluator(
+                std::move(compiler._instructions),
+                std::move(compiler._literals),
+                std::move(compiler._splineCalls),
+                std::move(compiler._constantRegisters),
+                std::move(compiler._constantValues),
+                std::move(resultRegisters),
+                numParameters,
+                compiler._numRegisters
+            );
+        }
+
+        Evaluator
+        Compiler::compile(const ExpressionImplementationPtr& expressionPtr) {
+            Simplifier simplifier;
+            DeduplicationCache deduplicationCache;
+            ExpressionImplementationPtr simplifiedPtr = simplifier.simplified(expressionPtr);
+            return compile(
+                std::vector<ExpressionImplementationPtr>(
+                    1,
+                    simplifiedPtr->deduplicated(deduplicationCache)
+                )
+            );
+        }
+
+        namespace
+        {
+            // Simplify all partial derivatives and deduplicate them against each other (and
+            // against anything already in the cache, such as the original expression) so that
+            // common subexpressions, typically values of the original expression's operands, are
+            // only computed once
+            void
+            appendDerivatives(
+                const ExpressionImplementationPtr& expressionPtr,
+                Simplifier& simplifier,
+                DeduplicationCache& deduplicationCache,
+                std::vector<ExpressionImplementationPtr>& expressions
+            ) {
+                int numParameters = expressionPtr->numParameters();
+                for (int parameterIndex = 0; parameterIndex < numParameters; ++parameterIndex) {
+                    ExpressionImplementationPtr derivativePtr =
+                        simplifier.simplified(expressionPtr->derivative(parameterIndex));
+                    expressions.push_back(derivativePtr->deduplicated(deduplicationCache));
+                }
+            }
+        }
+
+        Evaluator
+        Compiler::compileJacobian(const ExpressionImplementationPtr& expressionPtr) {
+            Simplifier simplifier;
+            DeduplicationCache deduplicationCache;
+            std::vector<ExpressionImplementationPtr> expressions;
+            ExpressionImplementationPtr simplifiedPtr = simplifier.simplified(expressionPtr);
+            appendDerivatives(simplifiedPtr, simplifier, deduplicationCache, expressions);
+            return compile(expressions);
+        }
+
+        Evaluator
+        Compiler::compileWithJacobian(const ExpressionImplementationPtr& expressionPtr) {
+            Simplifier simplifier;
+            DeduplicationCache deduplicationCache;
+            std::vector<ExpressionImplementationPtr> expressions;
+            ExpressionImplementationPtr simplifiedPtr = simplifier.simplified(expressionPtr);
+            expressions.push_back(simplifiedPtr->deduplicated(deduplicationCache));
+            appendDerivatives(simplifiedPtr, simplifier, deduplicationCache, expressions);
+            return compile(expressions);
+        }
+    }
+}
@@ -28,9 +28,14 @@
 
 #include <OpenSolid/Core/ParametricExpression/Bytecode/Compiler.declarations.hpp>
 
+#include <OpenSolid/Core/ParametricExpression/Bytecode/Bytecode.definitions.hpp>
 #include <OpenSolid/Core/ParametricExpression/Bytecode/Evaluator.declarations.hpp>
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.declarations.hpp>
+#include <OpenSolid/Core/ParametricExpression/Simplifier.declarations.hpp>
 
+#include <cstdint>
+#include <map>
+#include <memory>
 #include <vector>
 
 namespace opensolid
@@ -40,11 +45,100 @@ namespace opensolid
         class Compiler
         {
         private:
-            std::vector<double> _constants;
+            typedef std::pair<const ExpressionImplementation*, std::vector<int>> EvaluationKey;
+
+            std::vector<int> _instructions;
+            std::vector<double> _literals;
+            std::vector<Bytecode::SplineCall> _splineCalls;
+            std::vector<int> _constantRegisters;
+            std::vector<double> _constantValues;
+            int _numRegisters;
+
+            // Keyed by bit pattern, since NaN keys would break the ordering of a map keyed by value
+            // (and negative zero would be merged with positive zero)
+            std::map<std::uint64_t, int> _constantCache;
+            std::map<EvaluationKey, std::vector<int>> _evaluationCache;
+
+            OPENSOLID_CORE_EXPORT
+            int
+            allocateRegister();
+
+            // Compile several expressions with the same parameters into a single evaluator
+            // whose results are the concatenated results of each expression
+            OPENSOLID_CORE_EXPORT
+            static Evaluator
+            compile(const std::vector<ExpressionImplementationPtr>& expressions);
+
+            friend class Simplifier;
         public:
             OPENSOLID_CORE_EXPORT
-            Evaluator
+            Compiler(int numParameters);
+
+            OPENSOLID_CORE_EXPORT
+            std::vector<int>
+            evaluate(
+                const ExpressionImplementationPtr& expressionPtr,
+                const std::vector<int>& parameterRegisters
+            );
+
+            OPENSOLID_CORE_EXPORT
+            int
+            constant(double value);
+
+            OPENSOLID_CORE_EXPORT
+            int
+            compute(Bytecode::Instruction instruction, int operandRegister);
+
+            OPENSOLID_CORE_EXPORT
+            int
+            compute(
+                Bytecode::Instruction instruction,
+                int firstOperandRegister,
+                int secondOperandRegister
+            );
+
+            OPENSOLID_CORE_EXPORT
+            int
+            computeConstantPower(int baseRegister, double exponent);
+
+            OPENSOLID_CORE_EXPORT
+            int
+            computeIntegerPower(int baseRegister, int exponent);
+
+            OPENSOLID_CORE_EXPORT
+            void
+            checkNonZero(int operandRegister);
+
+            // Evaluate a B-spline at the values in the given registers, returning the
+            // (consecutive) registers holding its values
+            OPENSOLID_CORE_EXPORT
+            std::vector<int>
+            computeSpline(
+                const std::shared_ptr<const BSplineExpression>& splinePtr,
+                const std::vector<int>& parameterRegisters
+            );
+
+            // Compile an evaluator for the given expression; the expression is simplified and
+            // deduplicated first (as are the derivatives used by compileJacobian() and
+            // compileWithJacobian())
+            OPENSOLID_CORE_EXPORT
+            static Evaluator
             compile(const ExpressionImplementationPtr& expressionPtr);
+
+            // Compile an evaluator for the Jacobian of the given expression, with results stored
+            // in column-major order (all partial derivatives with respect to the first parameter,
+            // then all partial derivatives with respect to the second parameter, etc.)
+            OPENSOLID_CORE_EXPORT
+            static Evaluator
+            compileJacobian(const ExpressionImplementationPtr& expressionPtr);
+
+            // Compile an evaluator for both the value and the Jacobian of the given expression,
+            // with the value stored first followed by the Jacobian in the same layout as
+            // compileJacobian(). Intermediate values shared by the value and its derivatives are
+            // only computed once.
+            OPENSOLID_CORE_EXPORT
+            static Evaluator
+            compileWithJacobian(const ExpressionImplementationPtr& expressionPtr);
         };
     }
 }
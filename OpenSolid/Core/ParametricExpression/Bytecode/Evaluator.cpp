@@ -0,0 +1,730 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#include <OpenSolid/Core/ParametricExpression/Bytecode/Evaluator.hpp>
+
+#include <OpenSolid/Core/AffineForm.hpp>
+#include <OpenSolid/Core/Error.hpp>
+#include <OpenSolid/Core/NativeCode.hpp>
+#include <OpenSolid/Core/ParametricExpression/BSplineExpression.hpp>
+#include <OpenSolid/Core/ParametricExpression/Bytecode/BatchKernels.hpp>
+#include <OpenSolid/Core/ParametricExpression/Bytecode/Bytecode.hpp>
+#include <OpenSolid/Core/ParametricExpression/Bytecode/Operations.hpp>
+#include <OpenSolid/Core/ParametricExpression/EvaluationWorkspace.hpp>
+#include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace opensolid
+{
+    namespace detail
+    {
+        namespace
+        {
+            // FNV-1a hash, used instead of std::hash so that fingerprints are the same in any
+            // build of this library
+            class FingerprintHasher
+            {
+            private:
+                std::uint64_t _hash;
+            public:
+                FingerprintHasher() :
+                    _hash(14695981039346656037ULL) {
+                }
+
+                void
+                add(std::uint64_t value) {
+                    for (int byteIndex = 0; byteIndex < 8; ++byteIndex) {
+                        _hash ^= (value >> (8 * byteIndex)) & 0xff;
+                        _hash *= 1099511628211ULL;
+                    }
+                }
+
+                void
+                add(double value) {
+                    std::uint64_t bits;
+                    std::memcpy(&bits, &value, sizeof(bits));
+                    add(bits);
+                }
+
+                template <class TValue>
+                void
+                add(const std::vector<TValue>& values) {
+                    add(std::uint64_t(values.size()));
+                    for (TValue value : values) {
+                        add(value);
+                    }
+                }
+
+                void
+                add(int value) {
+                    add(std::uint64_t(std::int64_t(value)));
+                }
+
+                std::uint64_t
+                hash() const {
+                    return _hash;
+                }
+            };
+
+            // Evaluate the B-spline of a BSPLINE instruction at the values of its parameter
+            // registers
+            template <class TScalar>
+            inline
+            void
+            evaluateSpline(
+                const Bytecode::SplineCall& splineCall,
+                TScalar* registers,
+                int resultRegister
+            ) {
+                TScalar parameterValues[BSplineExpression::MAX_NUM_PARAMETERS];
+                for (std::size_t index = 0; index < splineCall.parameterRegisters.size(); ++index) {
+                    parameterValues[index] = registers[splineCall.parameterRegisters[index]];
+                }
+                splineCall.splinePtr->evaluate(parameterValues, registers + resultRegister);
+            }
+
+            // Spline bounds are not computed in affine arithmetic, so affine forms are bounded
+            // using plain interval evaluation (losing any correlation information)
+            void
+            evaluateSpline(
+                const Bytecode::SplineCall& splineCall,
+                AffineForm* registers,
+                int resultRegister
+            ) {
+                Interval parameterBounds[BSplineExpression::MAX_NUM_PARAMETERS];
+                for (std::size_t index = 0; index < splineCall.parameterRegisters.size(); ++index) {
+                    int parameterRegister = splineCall.parameterRegisters[index];
+                    parameterBounds[index] = registers[parameterRegister].bounds();
+                }
+                int numDimensions = splineCall.splinePtr->numDimensions();
+                std::vector<Interval> results(numDimensions);
+                splineCall.splinePtr->evaluate(parameterBounds, results.data());
+                for (int index = 0; index < numDimensions; ++index) {
+                    registers[resultRegister + index] = AffineForm(results[index]);
+                }
+            }
+
+            template <class TFunction>
+            inline
+            void
+            mapBlock(const double* operand, double* result, int count, TFunction function) {
+                for (int i = 0; i < count; ++i) {
+                    result[i] = function(operand[i]);
+                }
+            }
+        }
+
+        template <class TScalar>
+        void
+        Evaluator::execute(
+            const MatrixView<const TScalar, -1, -1, -1>& parameterView,
+            MatrixView<TScalar, -1, -1, -1>& resultView,
+            EvaluationWorkspace<TScalar>& workspace
+        ) const {
+            assert(parameterView.numRows() == _numParameters);
+            assert(resultView.numRows() == int(_resultRegisters.size()));
+            assert(resultView.numColumns() == parameterView.numColumns());
+
+            TScalar* registers = workspace.memory(_numRegisters);
+            for (std::size_t i = 0; i < _constantRegisters.size(); ++i) {
+                registers[_constantRegisters[i]] = TScalar(_constantValues[i]);
+            }
+
+            const int* begin = _instructions.data();
+            const int* end = begin + _instructions.size();
+            int numResults = int(_resultRegisters.size());
+            for (int columnIndex = 0; columnIndex < resultView.numColumns(); ++columnIndex) {
+                for (int parameterIndex = 0; parameterIndex < _numParameters; ++parameterIndex) {
+                    registers[parameterIndex] = parameterView(parameterIndex, columnIndex);
+                }
+
+                const int* instruction = begin;
+                while (instruction != end) {
+                    switch (instruction[0]) {
+                    case Bytecode::NEGATE:
+                        registers[instruction[2]] = -registers[instruction[1]];
+                        instruction += 3;
+                        break;
+                    case Bytecode::ADD:
+                        registers[instruction[3]] =
+                            registers[instruction[1]] + registers[instruction[2]];
+                        instruction += 4;
+                        break;
+                    case Bytecode::SUBTRACT:
+                        registers[instruction[3]] =
+                            registers[instruction[1]] - registers[instruction[2]];
+                        instruction += 4;
+                        break;
+                    case Bytecode::MULTIPLY:
+                        registers[instruction[3]] =
+                            registers[instruction[1]] * registers[instruction[2]];
+                        instruction += 4;
+                        break;
+                    case Bytecode::DIVIDE:
+                        registers[instruction[3]] =
+                            registers[instruction[1]] / registers[instruction[2]];
+                        instruction += 4;
+                        break;
+                    case Bytecode::SQUARE:
+                        registers[instruction[2]] = square(registers[instruction[1]]);
+                        instruction += 3;
+                        break;
+                    case Bytecode::SQRT:
+                        registers[instruction[2]] = squareRoot(registers[instruction[1]]);
+                        instruction += 3;
+                        break;
+                    case Bytecode::SIN:
+                        registers[instruction[2]] = opensolid::sin(registers[instruction[1]]);
+                        instruction += 3;
+                        break;
+                    case Bytecode::COS:
+                        registers[instruction[2]] = opensolid::cos(registers[instruction[1]]);
+                        instruction += 3;
+                        break;
+                    case Bytecode::TAN:
+                        registers[instruction[2]] = opensolid::tan(registers[instruction[1]]);
+                        instruction += 3;
+                        break;
+                    case Bytecode::ASIN:
+                        registers[instruction[2]] = arcsine(registers[instruction[1]]);
+                        instruction += 3;
+                        break;
+                    case Bytecode::ACOS:
+                        registers[instruction[2]] = arccosine(registers[instruction[1]]);
+                        instruction += 3;
+                        break;
+                    case Bytecode::EXP:
+                        registers[instruction[2]] = opensolid::exp(registers[instruction[1]]);
+                        instruction += 3;
+                        break;
+                    case Bytecode::LOG:
+                        registers[instruction[2]] = opensolid::log(registers[instruction[1]]);
+                        instruction += 3;
+                        break;
+                    case Bytecode::POW:
+                        registers[instruction[3]] = opensolid::pow(
+                            registers[instruction[1]],
+                            registers[instruction[2]]
+                        );
+                        instruction += 4;
+                        break;
+                    case Bytecode::CONSTANT_POW:
+                        registers[instruction[3]] = opensolid::pow(
+                            registers[instruction[1]],
+                            _literals[instruction[2]]
+                        );
+                        instruction += 4;
+                        break;
+                    case Bytecode::INTEGER_POW:
+                        registers[instruction[3]] = opensolid::pow(
+                            registers[instruction[1]],
+                            instruction[2]
+                        );
+                        instruction += 4;
+                        break;
+                    case Bytecode::CHECK_NONZERO:
+                        checkNonZero(registers[instruction[1]]);
+                        instruction += 2;
+                        break;
+                    case Bytecode::BSPLINE:
+                        evaluateSpline(_splineCalls[instruction[1]], registers, instruction[2]);
+                        instruction += 3;
+                        break;
+                    default:
+                        assert(false);
+                        return;
+                    }
+                }
+
+                for (int resultIndex = 0; resultIndex < numResults; ++resultIndex) {
+                    resultView(resultIndex, columnIndex) = registers[_resultRegisters[resultIndex]];
+                }
+            }
+        }
+
+        template <class TScalar, class TResult, class TFunction>
+        void
+        Evaluator::executeNative(
+            const MatrixView<const TScalar, -1, -1, -1>& parameterView,
+            MatrixView<TResult, -1, -1, -1>& resultView,
+            TFunction function
+        ) const {
+            assert(parameterView.numRows() == _numParameters);
+            assert(resultView.numRows() == int(_resultRegisters.size()));
+            assert(resultView.numColumns() == parameterView.numColumns());
+
+            // Each column of a matrix view is contiguous, so can be passed directly (results
+            // of a different type than the native function computes go through a temporary
+            // buffer instead)
+            int numResults = resultView.numRows();
+            bool convertResults = !std::is_same<TScalar, TResult>::value;
+            std::vector<TScalar> buffer(convertResults ? numResults : 0);
+            const char* parameterBytes = reinterpret_cast<const char*>(parameterView.data());
+            char* resultBytes = reinterpret_cast<char*>(resultView.data());
+            for (int columnIndex = 0; columnIndex < resultView.numColumns(); ++columnIndex) {
+                const TScalar* parameters = reinterpret_cast<const TScalar*>(parameterBytes);
+                if (convertResults) {
+                    function(parameters, buffer.data());
+                    TResult* results = reinterpret_cast<TResult*>(resultBytes);
+                    for (int resultIndex = 0; resultIndex < numResults; ++resultIndex) {
+                        results[resultIndex] = TResult(buffer[resultIndex]);
+                    }
+                } else {
+                    function(parameters, reinterpret_cast<TScalar*>(resultBytes));
+                }
+                parameterBytes += parameterView.columnStrideInBytes();
+                resultBytes += resultView.columnStrideInBytes();
+            }
+        }
+
+        template <class TResult>
+        void
+        Evaluator::executeBlocked(
+            const MatrixView<const double, -1, -1, -1>& parameterView,
+            MatrixView<TResult, -1, -1, -1>& resultView,
+            EvaluationWorkspace<double>& workspace
+        ) const {
+            assert(parameterView.numRows() == _numParameters);
+            assert(resultView.numRows() == int(_resultRegisters.size()));
+            assert(resultView.numColumns() == parameterView.numColumns());
+
+            // Each register holds the values for a block of consecutive columns, so every
+            // instruction is dispatched once per block instead of once per column and the
+            // arithmetic itself runs through (vectorized) batch kernels
+            const int blockSize = BatchKernels::BLOCK_SIZE;
+            const BatchKernels& kernels = BatchKernels::best();
+            double* registers = workspace.memory(_numRegisters * blockSize);
+            for (std::size_t i = 0; i < _constantRegisters.size(); ++i) {
+                double* block = registers + _constantRegisters[i] * blockSize;
+                std::fill(block, block + blockSize, _constantValues[i]);
+            }
+            auto block = [registers, blockSize] (int registerIndex) {
+                return registers + registerIndex * blockSize;
+            };
+
+            std::vector<double> splineValues;
+            const int* begin = _instructions.data();
+            const int* end = begin + _instructions.size();
+            int numColumns = resultView.numColumns();
+            int numResults = int(_resultRegisters.size());
+            for (int startColumn = 0; startColumn < numColumns; startColumn += blockSize) {
+                int count = min(blockSize, numColumns - startColumn);
+                for (int parameterIndex = 0; parameterIndex < _numParameters; ++parameterIndex) {
+                    double* parameterBlock = block(parameterIndex);
+                    for (int i = 0; i < count; ++i) {
+                        parameterBlock[i] = parameterView(parameterIndex, startColumn + i);
+                    }
+                }
+
+                const int* instruction = begin;
+                while (instruction != end) {
+                    switch (instruction[0]) {
+                    case Bytecode::NEGATE:
+                        kernels.negate(block(instruction[1]), block(instruction[2]), count);
+                        instruction += 3;
+                        break;
+                    case Bytecode::ADD:
+                        kernels.add(
+                            block(instruction[1]),
+                            block(instruction[2]),
+                            block(instruction[3]),
+                            count
+                        );
+                        instruction += 4;
+                        break;
+                    case Bytecode::SUBTRACT:
+                        kernels.subtract(
+                            block(instruction[1]),
+                            block(instruction[2]),
+                            block(instruction[3]),
+                            count
+                        );
+                        instruction += 4;
+                        break;
+                    case Bytecode::MULTIPLY:
+                        kernels.multiply(
+                            block(instruction[1]),
+                            block(instruction[2]),
+                            block(instruction[3]),
+                            count
+                        );
+                        instruction += 4;
+                        break;
+                    case Bytecode::DIVIDE:
+                        kernels.divide(
+                            block(instruction[1]),
+                            block(instruction[2]),
+                            block(instruction[3]),
+                            count
+                        );
+                        instruction += 4;
+                        break;
+                    case Bytecode::SQUARE:
+                        kernels.square(block(instruction[1]), block(instruction[2]), count);
+                        instruction += 3;
+                        break;
+                    case Bytecode::SQRT: {
+                        const double* operand = block(instruction[1]);
+                        double* result = block(instruction[2]);
+                        kernels.sqrt(operand, result, count);
+                        // Handle (slightly) negative values the same way as single-column
+                        // evaluation
+                        for (int i = 0; i < count; ++i) {
+                            if (operand[i] < 0.0) {
+                                result[i] = squareRoot(operand[i]);
+                            }
+                        }
+                        instruction += 3;
+                        break;
+                    }
+                    case Bytecode::SIN:
+                        mapBlock(
+                            block(instruction[1]),
+                            block(instruction[2]),
+                            count,
+                            [] (double value) {
+                                return opensolid::sin(value);
+                            }
+                        );
+                        instruction += 3;
+                        break;
+                    case Bytecode::COS:
+                        mapBlock(
+                            block(instruction[1]),
+                            block(instruction[2]),
+                            count,
+                            [] (double value) {
+                                return opensolid::cos(value);
+                            }
+                        );
+                        instruction += 3;
+                        break;
+                    case Bytecode::TAN:
+                        mapBlock(
+                            block(instruction[1]),
+                            block(instruction[2]),
+                            count,
+                            [] (double value) {
+                                return opensolid::tan(value);
+                            }
+                        );
+                        instruction += 3;
+                        break;
+                    case Bytecode::ASIN:
+                        mapBlock(
+                            block(instruction[1]),
+                            block(instruction[2]),
+                            count,
+                            [] (double value) {
+                                return arcsine(value);
+                            }
+                        );
+                        instruction += 3;
+                        break;
+                    case Bytecode::ACOS:
+                        mapBlock(
+                            block(instruction[1]),
+                            block(instruction[2]),
+                            count,
+                            [] (double value) {
+                                return arccosine(value);
+                            }
+                        );
+                        instruction += 3;
+                        break;
+                    case Bytecode::EXP:
+                        mapBlock(
+                            block(instruction[1]),
+                            block(instruction[2]),
+                            count,
+                            [] (double value) {
+                                return opensolid::exp(value);
+                            }
+                        );
+                        instruction += 3;
+                        break;
+                    case Bytecode::LOG:
+                        mapBlock(
+                            block(instruction[1]),
+                            block(instruction[2]),
+                            count,
+                            [] (double value) {
+                                return opensolid::log(value);
+                            }
+                        );
+                        instruction += 3;
+                        break;
+                    case Bytecode::POW: {
+                        const double* base = block(instruction[1]);
+                        const double* exponent = block(instruction[2]);
+                        double* result = block(instruction[3]);
+                        for (int i = 0; i < count; ++i) {
+                            result[i] = opensolid::pow(base[i], exponent[i]);
+                        }
+                        instruction += 4;
+                        break;
+                    }
+                    case Bytecode::CONSTANT_POW: {
+                        double exponent = _literals[instruction[2]];
+                        mapBlock(
+                            block(instruction[1]),
+                            block(instruction[3]),
+                            count,
+                            [exponent] (double value) {
+                                return opensolid::pow(value, exponent);
+                            }
+                        );
+                        instruction += 4;
+                        break;
+                    }
+                    case Bytecode::INTEGER_POW: {
+                        int exponent = instruction[2];
+                        mapBlock(
+                            block(instruction[1]),
+                            block(instruction[3]),
+                            count,
+                            [exponent] (double value) {
+                                return opensolid::pow(value, exponent);
+                            }
+                        );
+                        instruction += 4;
+                        break;
+                    }
+                    case Bytecode::CHECK_NONZERO: {
+                        const double* operand = block(instruction[1]);
+                        for (int i = 0; i < count; ++i) {
+                            if (operand[i] == Zero()) {
+                                throw Error(new PlaceholderError());
+                            }
+                        }
+                        instruction += 2;
+                        break;
+                    }
+                    case Bytecode::BSPLINE: {
+                        // Splines are evaluated one column at a time
+                        const Bytecode::SplineCall& splineCall = _splineCalls[instruction[1]];
+                        const BSplineExpression& spline = *splineCall.splinePtr;
+                        int numSplineParameters = spline.numParameters();
+                        int numSplineDimensions = spline.numDimensions();
+                        double parameterValues[BSplineExpression::MAX_NUM_PARAMETERS];
+                        splineValues.resize(numSplineDimensions);
+                        for (int i = 0; i < count; ++i) {
+                            for (int index = 0; index < numSplineParameters; ++index) {
+                                int parameterRegister = splineCall.parameterRegisters[index];
+                                parameterValues[index] = block(parameterRegister)[i];
+                            }
+                            spline.evaluate(parameterValues, splineValues.data());
+                            for (int index = 0; index < numSplineDimensions; ++index) {
+                                block(instruction[2] + index)[i] = splineValues[index];
+                            }
+                        }
+                        instruction += 3;
+                        break;
+                    }
+                    default:
+                        assert(false);
+                        return;
+                    }
+                }
+
+                for (int resultIndex = 0; resultIndex < numResults; ++resultIndex) {
+                    const double* resultBlock = block(_resultRegisters[resultIndex]);
+                    for (int i = 0; i < count; ++i) {
+                        resultView(resultIndex, startColumn + i) = TResult(resultBlock[i]);
+                    }
+                }
+            }
+        }
+
+        Evaluator::Evaluator(
+            std::vector<int> instructions,
+            std::vector<double> literals,
+            std::vector<Bytecode::SplineCall> splineCalls,
+            std::vector<int> constantRegisters,
+            std::vector<double> constantValues,
+            std::vector<int> resultRegisters,
+            int numParameters,
+            int numRegisters
+        ) : _instructions(std::move(instructions)),
+            _literals(std::move(literals)),
+            _splineCalls(std::move(splineCalls)),
+            _constantRegisters(std::move(constantRegisters)),
+            _constantValues(std::move(constantValues)),
+            _resultRegisters(std::move(resultRegisters)),
+            _numParameters(numParameters),
+            _numRegisters(numRegisters),
+            _doubleFunction(nullptr),
+            _intervalFunction(nullptr) {
+
+            FingerprintHasher hasher;
+            hasher.add(_instructions);
+            hasher.add(_literals);
+            for (const Bytecode::SplineCall& splineCall : _splineCalls) {
+                const BSplineExpression& spline = *splineCall.splinePtr;
+                hasher.add(splineCall.parameterRegisters);
+                hasher.add(spline.numDimensions());
+                hasher.add(int(spline.isRational()));
+                hasher.add(spline.degrees());
+                for (const std::vector<double>& knots : spline.knots()) {
+                    hasher.add(knots);
+                }
+                hasher.add(spline.controlPoints());
+            }
+            hasher.add(_constantRegisters);
+            hasher.add(_constantValues);
+            hasher.add(_resultRegisters);
+            hasher.add(_numParameters);
+            hasher.add(_numRegisters);
+            _fingerprint = hasher.hash();
+
+            NativeCode::find(*this, _doubleFunction, _intervalFunction);
+        }
+
+        void
+        Evaluator::evaluate(
+            const MatrixView<const double, -1, -1, -1>& parameterView,
+            MatrixView<double, -1, -1, -1>& resultView
+        ) const {
+            evaluate(parameterView, resultView, EvaluationWorkspace<double>::threadLocal());
+        }
+
+        void
+        Evaluator::evaluate(
+            const MatrixView<const Interval, -1, -1, -1>& parameterView,
+            MatrixView<Interval, -1, -1, -1>& resultView
+        ) const {
+            evaluate(parameterView, resultView, EvaluationWorkspace<Interval>::threadLocal());
+        }
+
+        void
+        Evaluator::evaluate(
+            const MatrixView<const double, -1, -1, -1>& parameterView,
+            MatrixView<float, -1, -1, -1>& resultView
+        ) const {
+            evaluate(parameterView, resultView, EvaluationWorkspace<double>::threadLocal());
+        }
+
+        void
+        Evaluator::evaluate(
+            const MatrixView<const double, -1, -1, -1>& parameterView,
+            MatrixView<float, -1, -1, -1>& resultView,
+            EvaluationWorkspace<double>& workspace
+        ) const {
+            // The blocked evaluator handles single columns too, and converts results to float
+            // as it copies them out of its registers
+            if (_doubleFunction) {
+                executeNative(parameterView, resultView, _doubleFunction);
+            } else {
+                executeBlocked(parameterView, resultView, workspace);
+            }
+        }
+
+        void
+        Evaluator::evaluate(
+            const MatrixView<const double, -1, -1, -1>& parameterView,
+            MatrixView<double, -1, -1, -1>& resultView,
+            EvaluationWorkspace<double>& workspace
+        ) const {
+            if (_doubleFunction) {
+                executeNative(parameterView, resultView, _doubleFunction);
+            } else if (parameterView.numColumns() > 1) {
+                executeBlocked(parameterView, resultView, workspace);
+            } else {
+                execute(parameterView, resultView, workspace);
+            }
+        }
+
+        void
+        Evaluator::evaluate(
+            const MatrixView<const Interval, -1, -1, -1>& parameterView,
+            MatrixView<Interval, -1, -1, -1>& resultView,
+            EvaluationWorkspace<Interval>& workspace
+        ) const {
+            if (_intervalFunction) {
+                executeNative(parameterView, resultView, _intervalFunction);
+            } else {
+                execute(parameterView, resultView, workspace);
+            }
+        }
+
+        void
+        Evaluator::evaluateAffine(
+            const MatrixView<const Interval, -1, -1, -1>& parameterView,
+            MatrixView<Interval, -1, -1, -1>& resultView
+        ) const {
+            evaluate(parameterView, resultView);
+            if (_numParameters > AffineForm::NUM_SYMBOLS) {
+                return;
+            }
+
+            int numResults = int(_resultRegisters.size());
+            std::vector<AffineForm> affineParameters(_numParameters);
+            std::vector<AffineForm> affineResults(numResults);
+            MatrixView<const AffineForm, -1, -1, -1> affineParameterView(
+                affineParameters.data(),
+                _numParameters,
+                1,
+                _numParameters * sizeof(AffineForm)
+            );
+            MatrixView<AffineForm, -1, -1, -1> affineResultView(
+                affineResults.data(),
+                numResults,
+                1,
+                numResults * sizeof(AffineForm)
+            );
+            EvaluationWorkspace<AffineForm>& workspace =
+                EvaluationWorkspace<AffineForm>::threadLocal();
+            for (int columnIndex = 0; columnIndex < parameterView.numColumns(); ++columnIndex) {
+                for (int parameterIndex = 0; parameterIndex < _numParameters; ++parameterIndex) {
+                    affineParameters[parameterIndex] = AffineForm(
+                        parameterView(parameterIndex, columnIndex),
+                        parameterIndex
+                    );
+                }
+                try {
+                    execute(affineParameterView, affineResultView, workspace);
+                } catch (const Error&) {
+                    // Affine bounds can be tight enough to fail a nonzero check that the
+                    // natural bounds passed; just keep the natural bounds in that case
+                    continue;
+                }
+                for (int resultIndex = 0; resultIndex < numResults; ++resultIndex) {
+                    // An empty intersection can only be due to rounding error (or to a fallback
+                    // to interval arithmetic inside AffineForm producing an empty result), in
+                    // which case the natural bounds are kept
+                    Interval intersection = resultView(resultIndex, columnIndex).intersection(
+                        affineResults[resultIndex].bounds()
+                    );
+                    if (!intersection.isEmpty()) {
+                        resultView(resultIndex, columnIndex) = intersection;
+                    }
+                }
+            }
+        }
+    }
+}
@@ -28,6 +28,16 @@
 
 #include <OpenSolid/Core/ParametricExpression/Bytecode/Evaluator.declarations.hpp>
 
+#include <OpenSolid/Core/AffineForm.declarations.hpp>
+#include <OpenSolid/Core/ParametricExpression/Bytecode/Bytecode.definitions.hpp>
+#include <OpenSolid/Core/Interval.declarations.hpp>
+#include <OpenSolid/Core/MatrixView.declarations.hpp>
+#include <OpenSolid/Core/NativeCode.definitions.hpp>
+#include <OpenSolid/Core/ParametricExpression/EvaluationWorkspace.declarations.hpp>
+
+#include <cstdint>
+#include <vector>
+
 namespace opensolid
 {
     namespace detail
@@ -35,8 +45,145 @@ namespace opensolid
         class Evaluator
         {
         private:
+            std::vector<int> _instructions;
+            std::vector<double> _literals;
+            std::vector<Bytecode::SplineCall> _splineCalls;
+            std::vector<int> _constantRegisters;
+            std::vector<double> _constantValues;
+            std::vector<int> _resultRegisters;
+            int _numParameters;
+            int _numRegisters;
+            std::uint64_t _fingerprint;
+
+            // Registered native implementations of this evaluator, if any (see NativeCode)
+            NativeCode::DoubleFunction _doubleFunction;
+            NativeCode::IntervalFunction _intervalFunction;
+
+            template <class TScalar>
+            void
+            execute(
+                const MatrixView<const TScalar, -1, -1, -1>& parameterView,
+                MatrixView<TScalar, -1, -1, -1>& resultView,
+                EvaluationWorkspace<TScalar>& workspace
+            ) const;
+
+            template <class TScalar, class TResult, class TFunction>
+            void
+            executeNative(
+                const MatrixView<const TScalar, -1, -1, -1>& parameterView,
+                MatrixView<TResult, -1, -1, -1>& resultView,
+                TFunction function
+            ) const;
+
+            template <class TResult>
+            void
+            executeBlocked(
+                const MatrixView<const double, -1, -1, -1>& parameterView,
+                MatrixView<TResult, -1, -1, -1>& resultView,
+                EvaluationWorkspace<double>& workspace
+            ) const;
         public:
-            
+            OPENSOLID_CORE_EXPORT
+            Evaluator(
+                std::vector<int> instructions,
+                std::vector<double> literals,
+                std::vector<Bytecode::SplineCall> splineCalls,
+                std::vector<int> constantRegisters,
+                std::vector<double> constantValues,
+                std::vector<int> resultRegisters,
+                int numParameters,
+                int numRegisters
+            );
+
+            const std::vector<int>&
+            instructions() const;
+
+            const std::vector<double>&
+            literals() const;
+
+            const std::vector<Bytecode::SplineCall>&
+            splineCalls() const;
+
+            const std::vector<int>&
+            constantRegisters() const;
+
+            const std::vector<double>&
+            constantValues() const;
+
+            const std::vector<int>&
+            resultRegisters() const;
+
+            int
+            numParameters() const;
+
+            int
+            numRegisters() const;
+
+            // Hash of the complete bytecode (instructions, constants and result registers), used
+            // to match evaluators with generated native code
+            std::uint64_t
+            fingerprint() const;
+
+            bool
+            isNative() const;
+
+            OPENSOLID_CORE_EXPORT
+            void
+            evaluate(
+                const MatrixView<const double, -1, -1, -1>& parameterView,
+                MatrixView<double, -1, -1, -1>& resultView
+            ) const;
+
+            OPENSOLID_CORE_EXPORT
+            void
+            evaluate(
+                const MatrixView<const Interval, -1, -1, -1>& parameterView,
+                MatrixView<Interval, -1, -1, -1>& resultView
+            ) const;
+
+            // Evaluate in double precision but store results in single precision, converting
+            // each value as it is written
+            OPENSOLID_CORE_EXPORT
+            void
+            evaluate(
+                const MatrixView<const double, -1, -1, -1>& parameterView,
+                MatrixView<float, -1, -1, -1>& resultView
+            ) const;
+
+            OPENSOLID_CORE_EXPORT
+            void
+            evaluate(
+                const MatrixView<const double, -1, -1, -1>& parameterView,
+                MatrixView<double, -1, -1, -1>& resultView,
+                EvaluationWorkspace<double>& workspace
+            ) const;
+
+            OPENSOLID_CORE_EXPORT
+            void
+            evaluate(
+                const MatrixView<const double, -1, -1, -1>& parameterView,
+                MatrixView<float, -1, -1, -1>& resultView,
+                EvaluationWorkspace<double>& workspace
+            ) const;
+
+            OPENSOLID_CORE_EXPORT
+            void
+            evaluate(
+                const MatrixView<const Interval, -1, -1, -1>& parameterView,
+                MatrixView<Interval, -1, -1, -1>& resultView,
+                EvaluationWorkspace<Interval>& workspace
+            ) const;
+
+            // Evaluate bounds using affine arithmetic, with one noise symbol per parameter,
+            // and intersect them with the plain interval bounds (so results are never looser).
+            // Falls back to plain interval evaluation if there are more parameters than
+            // available noise symbols.
+            OPENSOLID_CORE_EXPORT
+            void
+            evaluateAffine(
+                const MatrixView<const Interval, -1, -1, -1>& parameterView,
+                MatrixView<Interval, -1, -1, -1>& resultView
+            ) const;
         };
     }
 }
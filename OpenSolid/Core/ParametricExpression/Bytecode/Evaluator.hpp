@@ -26,31 +26,73 @@
 
 #include <OpenSolid/config.hpp>
 
-#include <OpenSolid/Core/ParametricExpression/Bytecode/RValue.declarations.hpp>
+#include <OpenSolid/Core/ParametricExpression/Bytecode/Evaluator.definitions.hpp>
 
-#include <OpenSolid/Core/ParametricExpression/Bytecode/Compiler.declarations.hpp>
-#include <OpenSolid/Core/ParametricExpression/Bytecode/LValue.declarations.hpp>
-#include <OpenSolid/Core/ParametricExpression/Bytecode/Expr.declarations.hpp>
+#include <OpenSolid/Core/Interval.hpp>
+#include <OpenSolid/Core/MatrixView.hpp>
 
 namespace opensolid
 {
     namespace detail
     {
-        class RValue
-        {
-        private:
-            Compiler* _compiler;
-
-            friend class Compiler;
-
-            explicit
-            RValue(Compiler* compiler);
-        public:
-            void
-            operator=(const LValue& lvalue);
-
-            void
-            operator=(const LValue& lvalue);
-        };
+        inline
+        const std::vector<int>&
+        Evaluator::instructions() const {
+            return _instructions;
+        }
+
+        inline
+        const std::vector<double>&
+        Evaluator::literals() const {
+            return _literals;
+        }
+
+        inline
+        const std::vector<Bytecode::SplineCall>&
+        Evaluator::splineCalls() const {
+            return _splineCalls;
+        }
+
+        inline
+        const std::vector<int>&
+        Evaluator::constantRegisters() const {
+            return _constantRegisters;
+        }
+
+        inline
+        const std::vector<double>&
+        Evaluator::constantValues() const {
+            return _constantValues;
+        }
+
+        inline
+        const std::vector<int>&
+        Evaluator::resultRegisters() const {
+            return _resultRegisters;
+        }
+
+        inline
+        int
+        Evaluator::numParameters() const {
+            return _numParameters;
+        }
+
+        inline
+        int
+        Evaluator::numRegisters() const {
+            return _numRegisters;
+        }
+
+        inline
+        std::uint64_t
+        Evaluator::fingerprint() const {
+            return _fingerprint;
+        }
+
+        inline
+        bool
+        Evaluator::isNative() const {
+            return _doubleFunction != nullptr;
+        }
     }
 }
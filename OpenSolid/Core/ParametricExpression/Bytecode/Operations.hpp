@@ -0,0 +1,145 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#pragma once
+
+#include <OpenSolid/config.hpp>
+
+#include <OpenSolid/Core/AffineForm.hpp>
+#include <OpenSolid/Core/Error.hpp>
+#include <OpenSolid/Core/Interval.hpp>
+#include <OpenSolid/Core/Zero.hpp>
+
+#include <cmath>
+
+// Scalar operations with the same semantics as the corresponding bytecode instructions, shared
+// by the bytecode evaluator and by generated native code (see NativeCode)
+namespace opensolid
+{
+    namespace detail
+    {
+        inline
+        double
+        square(double value) {
+            return value * value;
+        }
+
+        inline
+        Interval
+        square(Interval value) {
+            return value.squared();
+        }
+
+        inline
+        AffineForm
+        square(const AffineForm& value) {
+            return value.squared();
+        }
+
+        inline
+        double
+        squareRoot(double value) {
+            if (value >= 0.0) {
+                return opensolid::sqrt(value);
+            } else if (value == Zero()) {
+                return 0.0;
+            } else {
+                throw Error(new PlaceholderError());
+            }
+        }
+
+        inline
+        Interval
+        squareRoot(Interval value) {
+            return opensolid::sqrt(value);
+        }
+
+        inline
+        AffineForm
+        squareRoot(const AffineForm& value) {
+            return opensolid::sqrt(value);
+        }
+
+        inline
+        double
+        arcsine(double value) {
+            if (-1.0 <= value && value <= 1.0) {
+                return opensolid::asin(value);
+            } else if (value + 1 == Zero()) {
+                return -M_PI / 2.0;
+            } else if (value - 1 == Zero()) {
+                return M_PI / 2.0;
+            } else {
+                throw Error(new PlaceholderError());
+            }
+        }
+
+        inline
+        Interval
+        arcsine(Interval value) {
+            return opensolid::asin(value.intersection(Interval(-1, 1)));
+        }
+
+        inline
+        AffineForm
+        arcsine(const AffineForm& value) {
+            return opensolid::asin(value);
+        }
+
+        inline
+        double
+        arccosine(double value) {
+            if (-1.0 <= value && value <= 1.0) {
+                return opensolid::acos(value);
+            } else if (value + 1 == Zero()) {
+                return M_PI;
+            } else if (value - 1 == Zero()) {
+                return 0.0;
+            } else {
+                throw Error(new PlaceholderError());
+            }
+        }
+
+        inline
+        Interval
+        arccosine(Interval value) {
+            return opensolid::acos(value.intersection(Interval(-1, 1)));
+        }
+
+        inline
+        AffineForm
+        arccosine(const AffineForm& value) {
+            return opensolid::acos(value);
+        }
+
+        template <class TScalar>
+        inline
+        void
+        checkNonZero(TScalar value) {
+            if (value == Zero()) {
+                throw Error(new PlaceholderError());
+            }
+        }
+    }
+}
@@ -24,27 +24,361 @@
 
 #include <OpenSolid/config.hpp>
 
-#include <OpenSolid/Core/ParametricExpression/ExpressionCompiler.hpp>
 #include <OpenSolid/Core/ParametricExpression/CompiledExpression.hpp>
 
+#include <OpenSolid/Core/Error.hpp>
+#include <OpenSolid/Core/ParametricExpression/Bytecode/Compiler.hpp>
+#include <OpenSolid/Core/ParametricExpression/DeduplicationCache.hpp>
+#include <OpenSolid/Core/ThreadPool.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 namespace opensolid
 {
     namespace detail
     {
-        CompiledExpression::CompiledExpression(ExpressionImplementationPtr implementationPtr) :
-            _implementationPtr(std::move(implementationPtr)),
-            _doubleEvaluationSequence(
-                ExpressionCompiler<double>::compile(_implementationPtr)
-            ),
-            _intervalEvaluationSequence(
-                ExpressionCompiler<Interval>::compile(_implementationPtr)
-            ),
-            _doubleJacobianEvaluationSequence(
-                ExpressionCompiler<double>::compileJacobian(_implementationPtr)
-            ),
-            _intervalJacobianEvaluationSequence(
-                ExpressionCompiler<Interval>::compileJacobian(_implementationPtr)
+        namespace
+        {
+            // Values within this many machine epsilons (relative to the magnitude of an
+            // expression) of zero are treated as zero, so that rounding error near a multiple
+            // zero does not produce many spurious zeros
+            const double RELATIVE_ZERO_PRECISION = 64 * std::numeric_limits<double>::epsilon();
+        }
+
+        const Evaluator&
+        CompiledExpression::evaluator() const {
+            std::call_once(
+                _evaluatorFlag,
+                [this] () {
+                    _evaluatorPtr.reset(new Evaluator(Compiler::compile(_implementationPtr)));
+                }
+            );
+            return *_evaluatorPtr;
+        }
+
+        const Evaluator&
+        CompiledExpression::jacobianEvaluator() const {
+            std::call_once(
+                _jacobianEvaluatorFlag,
+                [this] () {
+                    _jacobianEvaluatorPtr.reset(
+                        new Evaluator(Compiler::compileJacobian(_implementationPtr))
+                    );
+                }
+            );
+            return *_jacobianEvaluatorPtr;
+        }
+
+        const Evaluator&
+        CompiledExpression::valueAndJacobianEvaluator() const {
+            std::call_once(
+                _valueAndJacobianEvaluatorFlag,
+                [this] () {
+                    _valueAndJacobianEvaluatorPtr.reset(
+                        new Evaluator(Compiler::compileWithJacobian(_implementationPtr))
+                    );
+                }
+            );
+            return *_valueAndJacobianEvaluatorPtr;
+        }
+
+        namespace
+        {
+            template <class TScalar, class TResult>
+            void
+            evaluateInParallel(
+                const Evaluator& evaluator,
+                const MatrixView<const TScalar, -1, -1, -1>& parameterView,
+                MatrixView<TResult, -1, -1, -1>& resultView
             ) {
+                // Each chunk writes directly into its own block of the result; the evaluator
+                // itself is immutable and each thread uses its own thread-local workspace
+                ThreadPool::global().parallelFor(
+                    parameterView.numColumns(),
+                    [&evaluator, &parameterView, &resultView] (int begin, int end) {
+                        int numColumns = end - begin;
+                        MatrixView<const TScalar, -1, -1, -1> parameterBlock = parameterView.block(
+                            0,
+                            begin,
+                            parameterView.numRows(),
+                            numColumns
+                        );
+                        MatrixView<TResult, -1, -1, -1> resultBlock = resultView.block(
+                            0,
+                            begin,
+                            resultView.numRows(),
+                            numColumns
+                        );
+                        evaluator.evaluate(parameterBlock, resultBlock);
+                    }
+                );
+            }
+        }
+
+        void
+        CompiledExpression::evaluateBatch(
+            const ConstMatrixViewXd& parameterView,
+            MatrixViewXd& resultView
+        ) const {
+            evaluateInParallel(evaluator(), parameterView, resultView);
+        }
+
+        void
+        CompiledExpression::evaluateBatch(
+            const ConstIntervalMatrixViewXd& parameterView,
+            IntervalMatrixViewXd& resultView
+        ) const {
+            evaluateInParallel(evaluator(), parameterView, resultView);
+        }
+
+        void
+        CompiledExpression::evaluateBatch(
+            const ConstMatrixViewXd& parameterView,
+            MatrixViewXf& resultView
+        ) const {
+            evaluateInParallel(evaluator(), parameterView, resultView);
+        }
+
+        void
+        CompiledExpression::evaluateMeanValue(
+            const ConstIntervalMatrixViewXd& parameterView,
+            IntervalMatrixViewXd& resultView
+        ) const {
+            evaluate(parameterView, resultView);
+            int numParameters = parameterView.numRows();
+            int numDimensions = resultView.numRows();
+            int numColumns = parameterView.numColumns();
+            if (numParameters == 0 || numColumns == 0) {
+                return;
+            }
+
+            // Evaluate at the (degenerate interval) center of each parameter domain, and bound
+            // the Jacobian over the whole domain
+            std::vector<Interval> centers(numParameters * numColumns);
+            for (int columnIndex = 0; columnIndex < numColumns; ++columnIndex) {
+                for (int parameterIndex = 0; parameterIndex < numParameters; ++parameterIndex) {
+                    Interval parameterBounds = parameterView(parameterIndex, columnIndex);
+                    int index = columnIndex * numParameters + parameterIndex;
+                    centers[index] = parameterBounds.median();
+                }
+            }
+            std::vector<Interval> centerValues(numDimensions * numColumns);
+            std::vector<Interval> jacobians(numDimensions * numParameters * numColumns);
+            ConstIntervalMatrixViewXd centerView(
+                centers.data(),
+                numParameters,
+                numColumns,
+                numParameters * sizeof(Interval)
+            );
+            IntervalMatrixViewXd centerValueView(
+                centerValues.data(),
+                numDimensions,
+                numColumns,
+                numDimensions * sizeof(Interval)
+            );
+            IntervalMatrixViewXd jacobianView(
+                jacobians.data(),
+                numDimensions * numParameters,
+                numColumns,
+                numDimensions * numParameters * sizeof(Interval)
+            );
+            evaluate(centerView, centerValueView);
+            evaluateJacobian(parameterView, jacobianView);
+
+            for (int columnIndex = 0; columnIndex < numColumns; ++columnIndex) {
+                for (int dimensionIndex = 0; dimensionIndex < numDimensions; ++dimensionIndex) {
+                    Interval centered = centerValueView(dimensionIndex, columnIndex);
+                    for (int parameterIndex = 0; parameterIndex < numParameters; ++parameterIndex) {
+                        Interval parameterBounds = parameterView(parameterIndex, columnIndex);
+                        Interval jacobianBounds = jacobianView(
+                            parameterIndex * numDimensions + dimensionIndex,
+                            columnIndex
+                        );
+                        centered += jacobianBounds * (parameterBounds - parameterBounds.median());
+                    }
+                    // Both enclosures are valid, so their intersection is too (and is at least
+                    // as tight as either); it can only be empty due to rounding error
+                    Interval intersection =
+                        resultView(dimensionIndex, columnIndex).intersection(centered);
+                    if (!intersection.isEmpty()) {
+                        resultView(dimensionIndex, columnIndex) = intersection;
+                    }
+                }
+            }
+        }
+
+        void
+        CompiledExpression::evaluate(
+            const ConstIntervalMatrixViewXd& parameterView,
+            IntervalMatrixViewXd& resultView,
+            BoundsMode boundsMode
+        ) const {
+            switch (boundsMode) {
+            case NATURAL_BOUNDS:
+                evaluate(parameterView, resultView);
+                break;
+            case AFFINE_BOUNDS:
+                evaluator().evaluateAffine(parameterView, resultView);
+                break;
+            case MEAN_VALUE_BOUNDS:
+                evaluateMeanValue(parameterView, resultView);
+                break;
+            default:
+                assert(false);
+                break;
+            }
+        }
+
+        void
+        CompiledExpression::evaluateJacobianBatch(
+            const ConstMatrixViewXd& parameterView,
+            MatrixViewXd& resultView
+        ) const {
+            evaluateInParallel(jacobianEvaluator(), parameterView, resultView);
+        }
+
+        void
+        CompiledExpression::evaluateJacobianBatch(
+            const ConstIntervalMatrixViewXd& parameterView,
+            IntervalMatrixViewXd& resultView
+        ) const {
+            evaluateInParallel(jacobianEvaluator(), parameterView, resultView);
+        }
+
+        void
+        CompiledExpression::evaluateWithJacobianBatch(
+            const ConstMatrixViewXd& parameterView,
+            MatrixViewXd& resultView
+        ) const {
+            evaluateInParallel(valueAndJacobianEvaluator(), parameterView, resultView);
+        }
+
+        void
+        CompiledExpression::evaluateWithJacobianBatch(
+            const ConstIntervalMatrixViewXd& parameterView,
+            IntervalMatrixViewXd& resultView
+        ) const {
+            evaluateInParallel(valueAndJacobianEvaluator(), parameterView, resultView);
+        }
+
+        CompiledExpression::CompiledExpression(ExpressionImplementationPtr implementationPtr) :
+            _implementationPtr(std::move(implementationPtr)) {
+        }
+
+        CompiledExpressionPtr
+        CompiledExpression::derivative(int parameterIndex) const {
+            if (parameterIndex < 0 || parameterIndex >= _implementationPtr->numParameters()) {
+                throw Error(new PlaceholderError());
+            }
+            {
+                std::lock_guard<std::mutex> lock(_derivativesMutex);
+                if (_derivatives.empty()) {
+                    _derivatives.resize(_implementationPtr->numParameters());
+                }
+                CompiledExpressionPtr cachedPtr = _derivatives[parameterIndex].lock();
+                if (cachedPtr) {
+                    return cachedPtr;
+                }
+            }
+
+            DeduplicationCache deduplicationCache;
+            CompiledExpressionPtr derivativePtr = std::make_shared<CompiledExpression>(
+                _implementationPtr->derivative(parameterIndex)->deduplicated(deduplicationCache)
+            );
+
+            std::lock_guard<std::mutex> lock(_derivativesMutex);
+            CompiledExpressionPtr cachedPtr = _derivatives[parameterIndex].lock();
+            if (cachedPtr) {
+                return cachedPtr;
+            }
+            _derivatives[parameterIndex] = derivativePtr;
+            return derivativePtr;
+        }
+
+        std::vector<double>
+        CompiledExpression::zeroPrecisions(
+            const MatrixView<const Interval, -1, -1, -1>& domainView
+        ) const {
+            int numDimensions = _implementationPtr->numDimensions();
+            int numParameters = _implementationPtr->numParameters();
+            std::vector<double> magnitudes(numDimensions, 0.0);
+
+            // Use the bounds of the expression over the domain where they are finite
+            std::vector<Interval> bounds(numDimensions);
+            IntervalMatrixViewXd boundsView(
+                bounds.data(),
+                numDimensions,
+                1,
+                numDimensions * sizeof(Interval)
+            );
+            bool hasBounds = true;
+            try {
+                evaluate(domainView, boundsView);
+            } catch (const Error&) {
+                hasBounds = false;
+            }
+            std::vector<bool> isBounded(numDimensions, false);
+            for (int index = 0; hasBounds && index < numDimensions; ++index) {
+                double magnitude = max(-bounds[index].lowerBound(), bounds[index].upperBound());
+                if (magnitude < std::numeric_limits<double>::infinity()) {
+                    magnitudes[index] = magnitude;
+                    isBounded[index] = true;
+                }
+            }
+
+            // Otherwise (for instance near poles) fall back to values at the center of the
+            // domain and at the center of each of its faces
+            if (std::find(isBounded.begin(), isBounded.end(), false) != isBounded.end()) {
+                int numSamples = 2 * numParameters + 1;
+                std::vector<double> samples(numParameters * numSamples);
+                for (int sampleIndex = 0; sampleIndex < numSamples; ++sampleIndex) {
+                    for (int parameterIndex = 0; parameterIndex < numParameters; ++parameterIndex) {
+                        Interval domain = domainView(parameterIndex, 0);
+                        double value = domain.median();
+                        if (sampleIndex == 2 * parameterIndex + 1) {
+                            value = domain.lowerBound();
+                        } else if (sampleIndex == 2 * parameterIndex + 2) {
+                            value = domain.upperBound();
+                        }
+                        samples[sampleIndex * numParameters + parameterIndex] = value;
+                    }
+                }
+                std::vector<double> values(numDimensions);
+                for (int sampleIndex = 0; sampleIndex < numSamples; ++sampleIndex) {
+                    ConstMatrixViewXd sampleView(
+                        samples.data() + sampleIndex * numParameters,
+                        numParameters,
+                        1,
+                        numParameters * sizeof(double)
+                    );
+                    MatrixViewXd valuesView(
+                        values.data(),
+                        numDimensions,
+                        1,
+                        numDimensions * sizeof(double)
+                    );
+                    try {
+                        evaluate(sampleView, valuesView);
+                    } catch (const Error&) {
+                        continue;
+                    }
+                    for (int index = 0; index < numDimensions; ++index) {
+                        double magnitude = std::abs(values[index]);
+                        bool isFinite = magnitude < std::numeric_limits<double>::infinity();
+                        if (!isBounded[index] && isFinite) {
+                            magnitudes[index] = max(magnitudes[index], magnitude);
+                        }
+                    }
+                }
+            }
+
+            std::vector<double> results(numDimensions);
+            for (int index = 0; index < numDimensions; ++index) {
+                results[index] = RELATIVE_ZERO_PRECISION * magnitudes[index];
+            }
+            return results;
         }
     }
 }
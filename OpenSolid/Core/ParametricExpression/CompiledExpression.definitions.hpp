@@ -28,11 +28,16 @@
 
 #include <OpenSolid/Core/ParametricExpression/CompiledExpression.declarations.hpp>
 
+#include <OpenSolid/Core/BoundsMode.definitions.hpp>
 #include <OpenSolid/Core/Interval.definitions.hpp>
 #include <OpenSolid/Core/MatrixView.declarations.hpp>
-#include <OpenSolid/Core/ParametricExpression/EvaluationSequence.definitions.hpp>
+#include <OpenSolid/Core/ParametricExpression/Bytecode/Evaluator.definitions.hpp>
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.declarations.hpp>
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 namespace opensolid
 {
     namespace detail
@@ -41,10 +46,92 @@ namespace opensolid
         {
         private:
             ExpressionImplementationPtr _implementationPtr;
-            EvaluationSequence<double> _doubleEvaluationSequence;
-            EvaluationSequence<Interval> _intervalEvaluationSequence;
-            EvaluationSequence<double> _doubleJacobianEvaluationSequence;
-            EvaluationSequence<Interval> _intervalJacobianEvaluationSequence;
+
+            // Each evaluation mode is compiled on first use, since most expressions are only
+            // ever evaluated in one or two of them (or not at all, if they are just
+            // intermediate results used to build other expressions)
+            mutable std::unique_ptr<const Evaluator> _evaluatorPtr;
+            mutable std::unique_ptr<const Evaluator> _jacobianEvaluatorPtr;
+            mutable std::unique_ptr<const Evaluator> _valueAndJacobianEvaluatorPtr;
+
+            mutable std::once_flag _evaluatorFlag;
+            mutable std::once_flag _jacobianEvaluatorFlag;
+            mutable std::once_flag _valueAndJacobianEvaluatorFlag;
+
+            // Compiled derivatives, held weakly (as for ExpressionImplementation derivatives) so
+            // that repeatedly taking the derivative of the same expression reuses the same
+            // compiled evaluators as long as a previous derivative is still in use
+            mutable std::vector<std::weak_ptr<const CompiledExpression>> _derivatives;
+            mutable std::mutex _derivativesMutex;
+
+            OPENSOLID_CORE_EXPORT
+            const Evaluator&
+            evaluator() const;
+
+            OPENSOLID_CORE_EXPORT
+            const Evaluator&
+            jacobianEvaluator() const;
+
+            OPENSOLID_CORE_EXPORT
+            const Evaluator&
+            valueAndJacobianEvaluator() const;
+
+            // Evaluate many columns at once, split into chunks across the global thread pool
+            OPENSOLID_CORE_EXPORT
+            void
+            evaluateBatch(
+                const MatrixView<const double, -1, -1, -1>& parameterView,
+                MatrixView<double, -1, -1, -1>& resultView
+            ) const;
+
+            OPENSOLID_CORE_EXPORT
+            void
+            evaluateBatch(
+                const MatrixView<const Interval, -1, -1, -1>& parameterView,
+                MatrixView<Interval, -1, -1, -1>& resultView
+            ) const;
+
+            OPENSOLID_CORE_EXPORT
+            void
+            evaluateBatch(
+                const MatrixView<const double, -1, -1, -1>& parameterView,
+                MatrixView<float, -1, -1, -1>& resultView
+            ) const;
+
+            OPENSOLID_CORE_EXPORT
+            void
+            evaluateMeanValue(
+                const MatrixView<const Interval, -1, -1, -1>& parameterView,
+                MatrixView<Interval, -1, -1, -1>& resultView
+            ) const;
+
+            OPENSOLID_CORE_EXPORT
+            void
+            evaluateJacobianBatch(
+                const MatrixView<const double, -1, -1, -1>& parameterView,
+                MatrixView<double, -1, -1, -1>& resultView
+            ) const;
+
+            OPENSOLID_CORE_EXPORT
+            void
+            evaluateJacobianBatch(
+                const MatrixView<const Interval, -1, -1, -1>& parameterView,
+                MatrixView<Interval, -1, -1, -1>& resultView
+            ) const;
+
+            OPENSOLID_CORE_EXPORT
+            void
+            evaluateWithJacobianBatch(
+                const MatrixView<const double, -1, -1, -1>& parameterView,
+                MatrixView<double, -1, -1, -1>& resultView
+            ) const;
+
+            OPENSOLID_CORE_EXPORT
+            void
+            evaluateWithJacobianBatch(
+                const MatrixView<const Interval, -1, -1, -1>& parameterView,
+                MatrixView<Interval, -1, -1, -1>& resultView
+            ) const;
         public:
             OPENSOLID_CORE_EXPORT
             CompiledExpression(ExpressionImplementationPtr implementationPtr);
@@ -52,6 +139,10 @@ namespace opensolid
             const ExpressionImplementationPtr&
             implementation() const;
 
+            OPENSOLID_CORE_EXPORT
+            CompiledExpressionPtr
+            derivative(int parameterIndex) const;
+
             void
             evaluate(
                 const MatrixView<const double, -1, -1, -1>& parameterView,
@@ -64,6 +155,24 @@ namespace opensolid
                 MatrixView<Interval, -1, -1, -1>& resultView
             ) const;
 
+            OPENSOLID_CORE_EXPORT
+            void
+            evaluate(
+                const MatrixView<const Interval, -1, -1, -1>& parameterView,
+                MatrixView<Interval, -1, -1, -1>& resultView,
+                BoundsMode boundsMode
+            ) const;
+
+            // Values are computed in double precision and converted to single precision as they
+            // are stored
+            void
+            evaluate(
+                const MatrixView<const double, -1, -1, -1>& parameterView,
+                MatrixView<float, -1, -1, -1>& resultView
+            ) const;
+
+            // Jacobians are stored one per result column, each flattened in column-major order
+            // (so the result view has numDimensions * numParameters rows)
             void
             evaluateJacobian(
                 const MatrixView<const double, -1, -1, -1>& parameterView,
@@ -75,6 +184,30 @@ namespace opensolid
                 const MatrixView<const Interval, -1, -1, -1>& parameterView,
                 MatrixView<Interval, -1, -1, -1>& resultView
             ) const;
+
+            // Values and Jacobians computed together in a single pass; each result column holds
+            // the value followed by the flattened Jacobian (so the result view has
+            // numDimensions * (numParameters + 1) rows)
+            void
+            evaluateWithJacobian(
+                const MatrixView<const double, -1, -1, -1>& parameterView,
+                MatrixView<double, -1, -1, -1>& resultView
+            ) const;
+
+            void
+            evaluateWithJacobian(
+                const MatrixView<const Interval, -1, -1, -1>& parameterView,
+                MatrixView<Interval, -1, -1, -1>& resultView
+            ) const;
+
+            // Precision to within which each component of the expression should be treated as
+            // zero over the given domain (a single column of parameter bounds), for use by
+            // zero finding and equation solving. Precisions are relative to the magnitude of
+            // each component over the domain, so that scaling an expression does not change
+            // which of its values are considered zero.
+            OPENSOLID_CORE_EXPORT
+            std::vector<double>
+            zeroPrecisions(const MatrixView<const Interval, -1, -1, -1>& domainView) const;
         };
     }
 }
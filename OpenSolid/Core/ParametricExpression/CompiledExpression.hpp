@@ -30,7 +30,7 @@
 
 #include <OpenSolid/Core/Interval.hpp>
 #include <OpenSolid/Core/MatrixView.hpp>
-#include <OpenSolid/Core/ParametricExpression/EvaluationSequence.hpp>
+#include <OpenSolid/Core/ParametricExpression/Bytecode/Evaluator.hpp>
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
 
 namespace opensolid
@@ -49,37 +49,89 @@ namespace opensolid
             const ConstMatrixViewXd& parameterView,
             MatrixViewXd& resultView
         ) const {
-            _doubleEvaluationSequence.execute(parameterView, resultView);
+            if (parameterView.numColumns() > 1) {
+                evaluateBatch(parameterView, resultView);
+            } else {
+                evaluator().evaluate(parameterView, resultView);
+            }
         }
 
-        
         inline
         void
         CompiledExpression::evaluate(
             const ConstIntervalMatrixViewXd& parameterView,
             IntervalMatrixViewXd& resultView
         ) const {
-            _intervalEvaluationSequence.execute(parameterView, resultView);
+            if (parameterView.numColumns() > 1) {
+                evaluateBatch(parameterView, resultView);
+            } else {
+                evaluator().evaluate(parameterView, resultView);
+            }
+        }
+
+        inline
+        void
+        CompiledExpression::evaluate(
+            const ConstMatrixViewXd& parameterView,
+            MatrixViewXf& resultView
+        ) const {
+            if (parameterView.numColumns() > 1) {
+                evaluateBatch(parameterView, resultView);
+            } else {
+                evaluator().evaluate(parameterView, resultView);
+            }
         }
 
-        
         inline
         void
         CompiledExpression::evaluateJacobian(
             const ConstMatrixViewXd& parameterView,
             MatrixViewXd& resultView
         ) const {
-            _doubleJacobianEvaluationSequence.execute(parameterView, resultView);
+            if (parameterView.numColumns() > 1) {
+                evaluateJacobianBatch(parameterView, resultView);
+            } else {
+                jacobianEvaluator().evaluate(parameterView, resultView);
+            }
         }
 
-        
         inline
         void
         CompiledExpression::evaluateJacobian(
             const ConstIntervalMatrixViewXd& parameterView,
             IntervalMatrixViewXd& resultView
         ) const {
-            _intervalJacobianEvaluationSequence.execute(parameterView, resultView);
+            if (parameterView.numColumns() > 1) {
+                evaluateJacobianBatch(parameterView, resultView);
+            } else {
+                jacobianEvaluator().evaluate(parameterView, resultView);
+            }
+        }
+
+        inline
+        void
+        CompiledExpression::evaluateWithJacobian(
+            const ConstMatrixViewXd& parameterView,
+            MatrixViewXd& resultView
+        ) const {
+            if (parameterView.numColumns() > 1) {
+                evaluateWithJacobianBatch(parameterView, resultView);
+            } else {
+                valueAndJacobianEvaluator().evaluate(parameterView, resultView);
+            }
+        }
+
+        inline
+        void
+        CompiledExpression::evaluateWithJacobian(
+            const ConstIntervalMatrixViewXd& parameterView,
+            IntervalMatrixViewXd& resultView
+        ) const {
+            if (parameterView.numColumns() > 1) {
+                evaluateWithJacobianBatch(parameterView, resultView);
+            } else {
+                valueAndJacobianEvaluator().evaluate(parameterView, resultView);
+            }
         }
     }
 }
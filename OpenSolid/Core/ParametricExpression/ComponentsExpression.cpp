@@ -24,6 +24,7 @@
 
 #include <OpenSolid/Core/ParametricExpression/ComponentsExpression.hpp>
 
+#include <OpenSolid/Core/ParametricExpression/Contractor.hpp>
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
 
 namespace opensolid
@@ -35,104 +36,35 @@ namespace opensolid
             return numComponents();
         }
         
-        void
-        ComponentsExpression::evaluateImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
+        std::vector<int>
+        ComponentsExpression::compileImpl(
+            const std::vector<int>& parameterRegisters,
+            Compiler& compiler
         ) const {
-            int startIndex = this->startIndex();
-            int numComponents = this->numComponents();
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(operand(), parameterID),
-                resultID,
-                [startIndex, numComponents] (
-                    const ConstMatrixViewXd operandValues,
-                    MatrixViewXd results
-                ) {
-                    results = operandValues.block(
-                        startIndex,
-                        0,
-                        numComponents,
-                        operandValues.numColumns()
-                    );
-                }
-            );
-        }
-        
-        void
-        ComponentsExpression::evaluateImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
-        ) const {
-            int startIndex = this->startIndex();
-            int numComponents = this->numComponents();
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(operand(), parameterID),
-                resultID,
-                [startIndex, numComponents] (
-                    ConstIntervalMatrixViewXd operandValues,
-                    IntervalMatrixViewXd results
-                ) {
-                    results = operandValues.block(
-                        startIndex,
-                        0,
-                        numComponents,
-                        operandValues.numColumns()
-                    );
-                }
+            std::vector<int> operandRegisters = compiler.evaluate(operand(), parameterRegisters);
+            return std::vector<int>(
+                operandRegisters.begin() + startIndex(),
+                operandRegisters.begin() + startIndex() + numComponents()
             );
         }
 
-        void
-        ComponentsExpression::evaluateJacobianImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            int startIndex = this->startIndex();
-            int numComponents = this->numComponents();
-            expressionCompiler.compute(
-                expressionCompiler.evaluateJacobian(operand(), parameterID),
-                resultID,
-                [startIndex, numComponents] (
-                    ConstMatrixViewXd operandJacobian,
-                    MatrixViewXd results
-                ) {
-                    results = operandJacobian.block(
-                        startIndex,
-                        0,
-                        numComponents,
-                        operandJacobian.numColumns()
-                    );
-                }
+        std::vector<Interval>
+        ComponentsExpression::boundsImpl(Contractor& contractor) const {
+            const std::vector<Interval>& operandBounds = contractor.bounds(operand());
+            return std::vector<Interval>(
+                operandBounds.begin() + startIndex(),
+                operandBounds.begin() + startIndex() + numComponents()
             );
         }
-        
+
         void
-        ComponentsExpression::evaluateJacobianImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        ComponentsExpression::contractImpl(
+            const std::vector<Interval>& bounds,
+            Contractor& contractor
         ) const {
-            int startIndex = this->startIndex();
-            int numComponents = this->numComponents();
-            expressionCompiler.compute(
-                expressionCompiler.evaluateJacobian(operand(), parameterID),
-                resultID,
-                [startIndex, numComponents] (
-                    ConstIntervalMatrixViewXd operandJacobian,
-                    IntervalMatrixViewXd results
-                ) {
-                    results = operandJacobian.block(
-                        startIndex,
-                        0,
-                        numComponents,
-                        operandJacobian.numColumns()
-                    );
-                }
-            );
+            for (int index = 0; index < numComponents(); ++index) {
+                contractor.narrow(operand(), startIndex() + index, bounds[index]);
+            }
         }
 
         ExpressionImplementationPtr
@@ -148,6 +80,13 @@ namespace opensolid
                 this->numComponents() == other->cast<ComponentsExpression>()->numComponents()
             );
         }
+
+        std::size_t
+        ComponentsExpression::structuralHashImpl() const {
+            std::size_t result = operand()->structuralHash();
+            result = combineHashes(result, std::size_t(startIndex()));
+            return combineHashes(result, std::size_t(numComponents()));
+        }
         
         ExpressionImplementationPtr
         ComponentsExpression::componentsImpl(int startIndex, int numComponents) const {
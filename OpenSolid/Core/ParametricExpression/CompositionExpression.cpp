@@ -24,6 +24,7 @@
 
 #include <OpenSolid/Core/ParametricExpression/CompositionExpression.hpp>
 
+#include <OpenSolid/Core/ParametricExpression/Contractor.hpp>
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
 
 namespace opensolid
@@ -40,76 +41,39 @@ namespace opensolid
             return innerExpression()->numParameters();
         }
 
-        void
-        CompositionExpression::evaluateImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
+        std::vector<int>
+        CompositionExpression::compileImpl(
+            const std::vector<int>& parameterRegisters,
+            Compiler& compiler
         ) const {
-            expressionCompiler.evaluate(
+            return compiler.evaluate(
                 outerExpression(),
-                expressionCompiler.evaluate(innerExpression(), parameterID),
-                resultID
+                compiler.evaluate(innerExpression(), parameterRegisters)
             );
         }
 
-        void
-        CompositionExpression::evaluateImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
-        ) const {
-            expressionCompiler.evaluate(
-                outerExpression(),
-                expressionCompiler.evaluate(innerExpression(), parameterID),
-                resultID
-            );
+        std::vector<Interval>
+        CompositionExpression::boundsImpl(Contractor& contractor) const {
+            Contractor innerContractor(contractor.bounds(innerExpression()));
+            return innerContractor.bounds(outerExpression());
         }
 
         void
-        CompositionExpression::evaluateJacobianImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            expressionCompiler.compute(
-                expressionCompiler.evaluateJacobian(innerExpression(), parameterID),
-                expressionCompiler.evaluateJacobian(
-                    outerExpression(),
-                    expressionCompiler.evaluate(innerExpression(), parameterID)
-                ),
-                resultID,
-                [] (
-                    ConstMatrixViewXd innerJacobian,
-                    ConstMatrixViewXd outerJacobian,
-                    MatrixViewXd results
-                ) {
-                    results.setProduct(outerJacobian, innerJacobian);
-                }
-            );
-        }
-        
-        void
-        CompositionExpression::evaluateJacobianImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        CompositionExpression::contractImpl(
+            const std::vector<Interval>& bounds,
+            Contractor& contractor
         ) const {
-            expressionCompiler.compute(
-                expressionCompiler.evaluateJacobian(innerExpression(), parameterID),
-                expressionCompiler.evaluateJacobian(
-                    outerExpression(),
-                    expressionCompiler.evaluate(innerExpression(), parameterID)
-                ),
-                resultID,
-                [] (
-                    ConstIntervalMatrixViewXd innerJacobian,
-                    ConstIntervalMatrixViewXd outerJacobian,
-                    IntervalMatrixViewXd results
-                ) {
-                    results.setProduct(outerJacobian, innerJacobian);
-                }
-            );
+            // Treat the bounds of the inner expression as the parameter bounds of the outer one
+            Contractor innerContractor(contractor.bounds(innerExpression()));
+            innerContractor.revise(outerExpression(), bounds);
+            if (innerContractor.isEmpty()) {
+                contractor.narrow(innerExpression(), 0, Interval::EMPTY());
+                return;
+            }
+            const std::vector<Interval>& innerBounds = innerContractor.parameterBounds();
+            for (int index = 0; index < innerExpression()->numDimensions(); ++index) {
+                contractor.narrow(innerExpression(), index, innerBounds[index]);
+            }
         }
 
         ExpressionImplementationPtr
@@ -147,6 +111,14 @@ namespace opensolid
             );
         }
 
+        std::size_t
+        CompositionExpression::structuralHashImpl() const {
+            return combineHashes(
+                outerExpression()->structuralHash(),
+                innerExpression()->structuralHash()
+            );
+        }
+
         ExpressionImplementationPtr
         CompositionExpression::deduplicatedImpl(DeduplicationCache& deduplicationCache) const {
             ExpressionImplementationPtr deduplicatedOuterExpression = (
@@ -24,6 +24,7 @@
 
 #include <OpenSolid/Core/ParametricExpression/ConcatenationExpression.hpp>
 
+#include <OpenSolid/Core/ParametricExpression/Contractor.hpp>
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
 
 namespace opensolid
@@ -35,112 +36,42 @@ namespace opensolid
             return firstOperand()->numDimensions() + secondOperand()->numDimensions();
         }
         
-        void
-        ConcatenationExpression::evaluateImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            int firstDimensions = firstOperand()->numDimensions();
-            int secondDimensions = secondOperand()->numDimensions();
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(firstOperand(), parameterID),
-                expressionCompiler.evaluate(secondOperand(), parameterID),
-                resultID,
-                [firstDimensions, secondDimensions] (
-                    ConstMatrixViewXd firstValues,
-                    ConstMatrixViewXd secondValues,
-                    MatrixViewXd results
-                ) {
-                    int numColumns = results.numColumns();
-                    results.block(0, 0, firstDimensions, numColumns) = firstValues;
-                    results.block(firstDimensions, 0, secondDimensions, numColumns) = secondValues;
-                }
-            );
-        }
-        
-        void
-        ConcatenationExpression::evaluateImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        std::vector<int>
+        ConcatenationExpression::compileImpl(
+            const std::vector<int>& parameterRegisters,
+            Compiler& compiler
         ) const {
-            int firstDimensions = firstOperand()->numDimensions();
-            int secondDimensions = secondOperand()->numDimensions();
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(firstOperand(), parameterID),
-                expressionCompiler.evaluate(secondOperand(), parameterID),
-                resultID,
-                [firstDimensions, secondDimensions] (
-                    ConstIntervalMatrixViewXd firstValues,
-                    ConstIntervalMatrixViewXd secondValues,
-                    IntervalMatrixViewXd results
-                ) {
-                    int numColumns = results.numColumns();
-                    results.block(0, 0, firstDimensions, numColumns) = firstValues;
-                    results.block(firstDimensions, 0, secondDimensions, numColumns) = secondValues;
-                }
-            );
+            std::vector<int> results = compiler.evaluate(firstOperand(), parameterRegisters);
+            std::vector<int> secondRegisters =
+                compiler.evaluate(secondOperand(), parameterRegisters);
+            results.insert(results.end(), secondRegisters.begin(), secondRegisters.end());
+            return results;
         }
 
-        void
-        ConcatenationExpression::evaluateJacobianImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            int numParameters = this->numParameters();
-            int firstDimensions = firstOperand()->numDimensions();
-            int secondDimensions = secondOperand()->numDimensions();
-            expressionCompiler.compute(
-                expressionCompiler.evaluateJacobian(firstOperand(), parameterID),
-                expressionCompiler.evaluateJacobian(secondOperand(), parameterID),
-                resultID,
-                [numParameters, firstDimensions, secondDimensions] (
-                    ConstMatrixViewXd firstJacobian,
-                    ConstMatrixViewXd secondJacobian,
-                    MatrixViewXd results
-                ) {
-                    results.block(0, 0, firstDimensions, numParameters) = firstJacobian;
-                    results.block(
-                        firstDimensions,
-                        0,
-                        secondDimensions,
-                        numParameters
-                    ) = secondJacobian;
-                }
-            );
+        std::vector<Interval>
+        ConcatenationExpression::boundsImpl(Contractor& contractor) const {
+            const std::vector<Interval>& firstBounds = contractor.bounds(firstOperand());
+            const std::vector<Interval>& secondBounds = contractor.bounds(secondOperand());
+            std::vector<Interval> results(firstBounds);
+            results.insert(results.end(), secondBounds.begin(), secondBounds.end());
+            return results;
         }
-        
+
         void
-        ConcatenationExpression::evaluateJacobianImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        ConcatenationExpression::contractImpl(
+            const std::vector<Interval>& bounds,
+            Contractor& contractor
         ) const {
-            int numParameters = this->numParameters();
-            int firstDimensions = firstOperand()->numDimensions();
-            int secondDimensions = secondOperand()->numDimensions();
-            expressionCompiler.compute(
-                expressionCompiler.evaluateJacobian(firstOperand(), parameterID),
-                expressionCompiler.evaluateJacobian(secondOperand(), parameterID),
-                resultID,
-                [numParameters, firstDimensions, secondDimensions] (
-                    ConstIntervalMatrixViewXd firstJacobian,
-                    ConstIntervalMatrixViewXd secondJacobian,
-                    IntervalMatrixViewXd results
-                ) {
-                    results.block(0, 0, firstDimensions, numParameters) = firstJacobian;
-                    results.block(
-                        firstDimensions,
-                        0,
-                        secondDimensions,
-                        numParameters
-                    ) = secondJacobian;
+            int numFirstDimensions = firstOperand()->numDimensions();
+            for (int index = 0; index < numDimensions(); ++index) {
+                if (index < numFirstDimensions) {
+                    contractor.narrow(firstOperand(), index, bounds[index]);
+                } else {
+                    contractor.narrow(secondOperand(), index - numFirstDimensions, bounds[index]);
                 }
-            );
+            }
         }
-        
+
         ExpressionImplementationPtr
         ConcatenationExpression::derivativeImpl(int parameterIndex) const {
             return firstOperand()->derivative(parameterIndex)->concatenated(
@@ -41,35 +41,21 @@ namespace opensolid
             numDimensionsImpl() const override;
             
             OPENSOLID_CORE_EXPORT
-            void
-            evaluateImpl(
-                const MatrixID<const double>& parameterID,
-                const MatrixID<double>& resultID,
-                ExpressionCompiler<double>& expressionCompiler
-            ) const override;
-            
-            OPENSOLID_CORE_EXPORT
-            void
-            evaluateImpl(
-                const MatrixID<const Interval>& parameterID,
-                const MatrixID<Interval>& resultID,
-                ExpressionCompiler<Interval>& expressionCompiler
+            std::vector<int>
+            compileImpl(
+                const std::vector<int>& parameterRegisters,
+                Compiler& compiler
             ) const override;
 
             OPENSOLID_CORE_EXPORT
-            void
-            evaluateJacobianImpl(
-                const MatrixID<const double>& parameterID,
-                const MatrixID<double>& resultID,
-                ExpressionCompiler<double>& expressionCompiler
-            ) const override;
-            
+            std::vector<Interval>
+            boundsImpl(Contractor& contractor) const override;
+
             OPENSOLID_CORE_EXPORT
             void
-            evaluateJacobianImpl(
-                const MatrixID<const Interval>& parameterID,
-                const MatrixID<Interval>& resultID,
-                ExpressionCompiler<Interval>& expressionCompiler
+            contractImpl(
+                const std::vector<Interval>& bounds,
+                Contractor& contractor
             ) const override;
             
             OPENSOLID_CORE_EXPORT
@@ -25,6 +25,7 @@
 #include <OpenSolid/Core/ParametricExpression/ConstantExpression.hpp>
 
 #include <OpenSolid/Core/Error.hpp>
+#include <OpenSolid/Core/ParametricExpression/Contractor.hpp>
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
 
 namespace opensolid
@@ -41,72 +42,27 @@ namespace opensolid
             return _numParameters;
         }
         
-        void
-        ConstantExpression::evaluateImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            expressionCompiler.compute(
-                resultID,
-                [this] (MatrixViewXd results) {
-                    results = ConstMatrixViewXd(
-                        columnMatrix().data(),
-                        numDimensions(),
-                        results.numColumns(),
-                        0
-                    );
-                }
-            );
-        }
-        
-        void
-        ConstantExpression::evaluateImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        std::vector<int>
+        ConstantExpression::compileImpl(
+            const std::vector<int>& parameterRegisters,
+            Compiler& compiler
         ) const {
-            expressionCompiler.compute(
-                resultID,
-                [this] (IntervalMatrixViewXd results) {
-                    results = ConstIntervalMatrixViewXd(
-                        intervalColumnMatrix().data(),
-                        numDimensions(),
-                        results.numColumns(),
-                        0
-                    );
-                }
-            );
+            std::vector<int> results(numDimensions());
+            for (int index = 0; index < numDimensions(); ++index) {
+                results[index] = compiler.constant(columnMatrix()(index));
+            }
+            return results;
         }
 
-        void
-        ConstantExpression::evaluateJacobianImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            expressionCompiler.compute(
-                resultID,
-                [] (MatrixViewXd results) {
-                    results.setZero();
-                }
-            );
-        }
-        
-        void
-        ConstantExpression::evaluateJacobianImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
-        ) const {
-            expressionCompiler.compute(
-                resultID,
-                [] (IntervalMatrixViewXd results) {
-                    results.setZero();
-                }
-            );
+        std::vector<Interval>
+        ConstantExpression::boundsImpl(Contractor& contractor) const {
+            std::vector<Interval> results(numDimensions());
+            for (int index = 0; index < numDimensions(); ++index) {
+                results[index] = intervalColumnMatrix()(index);
+            }
+            return results;
         }
-        
+
         ExpressionImplementationPtr
         ConstantExpression::derivativeImpl(int) const {
             return std::make_shared<ConstantExpression>(
@@ -117,7 +73,16 @@ namespace opensolid
         
         bool
         ConstantExpression::isDuplicateOfImpl(const ExpressionImplementationPtr& other) const {
-            return (columnMatrix() - other->cast<ConstantExpression>()->columnMatrix()).isZero();
+            return columnMatrix() == other->cast<ConstantExpression>()->columnMatrix();
+        }
+
+        std::size_t
+        ConstantExpression::structuralHashImpl() const {
+            std::size_t result = 0;
+            for (int index = 0; index < columnMatrix().numComponents(); ++index) {
+                result = combineHashes(result, hashValue(columnMatrix().component(index)));
+            }
+            return result;
         }
 
         ExpressionImplementationPtr
@@ -0,0 +1,381 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#include <OpenSolid/Core/ParametricExpression/Contractor.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace opensolid
+{
+    namespace
+    {
+        // Maximum number of forward/backward passes performed by Contractor::contracted()
+        const int MAX_NUM_PASSES = 16;
+
+        // Passes stop once no parameter interval shrinks by more than this fraction
+        const double MIN_RELATIVE_IMPROVEMENT = 0.1;
+
+        bool
+        isBounded(Interval interval) {
+            return (
+                std::abs(interval.lowerBound()) < std::numeric_limits<double>::infinity() &&
+                std::abs(interval.upperBound()) < std::numeric_limits<double>::infinity()
+            );
+        }
+    }
+
+    namespace detail
+    {
+        Contractor::Contractor(const std::vector<Interval>& parameterBounds) :
+            _parameterBounds(parameterBounds),
+            _isEmpty(false) {
+
+            for (Interval bounds : parameterBounds) {
+                if (bounds.isEmpty()) {
+                    _isEmpty = true;
+                }
+            }
+        }
+
+        const std::vector<Interval>&
+        Contractor::bounds(const ExpressionImplementationPtr& expressionPtr) {
+            auto iterator = _boundsCache.find(expressionPtr.get());
+            if (iterator != _boundsCache.end()) {
+                return iterator->second;
+            }
+            std::vector<Interval> results = expressionPtr->bounds(*this);
+            assert(int(results.size()) == expressionPtr->numDimensions());
+            _expressions.push_back(expressionPtr);
+            return _boundsCache.insert(std::make_pair(expressionPtr.get(), results)).first->second;
+        }
+
+        void
+        Contractor::narrow(
+            const ExpressionImplementationPtr& expressionPtr,
+            int index,
+            Interval bounds
+        ) {
+            auto iterator = _boundsCache.find(expressionPtr.get());
+            assert(iterator != _boundsCache.end());
+            Interval& expressionBounds = iterator->second[index];
+            expressionBounds = expressionBounds.intersection(widened(bounds));
+            if (expressionBounds.isEmpty()) {
+                _isEmpty = true;
+            }
+        }
+
+        void
+        Contractor::narrowParameter(int index, Interval bounds) {
+            _parameterBounds[index] = _parameterBounds[index].intersection(widened(bounds));
+            if (_parameterBounds[index].isEmpty()) {
+                _isEmpty = true;
+            }
+        }
+
+        void
+        Contractor::narrowSquaredNorm(
+            const ExpressionImplementationPtr& operand,
+            Interval squaredNormBounds
+        ) {
+            // Each squared component must equal the squared norm minus the sum of the squares
+            // of all other components
+            const std::vector<Interval>& operandBounds = bounds(operand);
+            int numComponents = int(operandBounds.size());
+            std::vector<Interval> squares(numComponents);
+            for (int index = 0; index < numComponents; ++index) {
+                squares[index] = operandBounds[index].squared();
+            }
+            for (int index = 0; index < numComponents; ++index) {
+                Interval remainder = squaredNormBounds;
+                for (int other = 0; other < numComponents; ++other) {
+                    if (other != index) {
+                        remainder -= squares[other];
+                    }
+                }
+                narrow(operand, index, squarePreimage(remainder, operandBounds[index]));
+                if (_isEmpty) {
+                    return;
+                }
+                squares[index] = operandBounds[index].squared();
+            }
+        }
+
+        void
+        Contractor::revise(
+            const ExpressionImplementationPtr& expressionPtr,
+            const std::vector<Interval>& valueBounds
+        ) {
+            if (_isEmpty) {
+                return;
+            }
+            _boundsCache.clear();
+            _expressions.clear();
+            bounds(expressionPtr);
+            for (std::size_t index = 0; index < valueBounds.size(); ++index) {
+                narrow(expressionPtr, int(index), valueBounds[index]);
+            }
+            // Operands always come before the expressions that use them, so iterating in reverse
+            // ensures that the bounds of each expression have been narrowed by every expression
+            // using it before they are used to narrow its own operands
+            for (int index = int(_expressions.size()) - 1; index >= 0; --index) {
+                if (_isEmpty) {
+                    return;
+                }
+                const ExpressionImplementationPtr& currentPtr = _expressions[index];
+                currentPtr->contract(_boundsCache[currentPtr.get()], *this);
+            }
+        }
+
+        Interval
+        Contractor::widened(Interval interval) {
+            double epsilon = 4 * std::numeric_limits<double>::epsilon();
+            return Interval(
+                interval.lowerBound() - epsilon * (1.0 + std::abs(interval.lowerBound())),
+                interval.upperBound() + epsilon * (1.0 + std::abs(interval.upperBound()))
+            );
+        }
+
+        Interval
+        Contractor::quotientBounds(Interval dividendBounds, Interval divisorBounds) {
+            if (dividendBounds.isEmpty() || divisorBounds.isEmpty()) {
+                return Interval::EMPTY();
+            }
+            double divisorLower = divisorBounds.lowerBound();
+            double divisorUpper = divisorBounds.upperBound();
+            if (divisorLower > 0.0 || divisorUpper < 0.0) {
+                return dividendBounds / divisorBounds;
+            }
+            if (dividendBounds.lowerBound() <= 0.0 && dividendBounds.upperBound() >= 0.0) {
+                // A zero divisor gives a zero product for any x
+                return Interval::WHOLE();
+            }
+            // The product is strictly positive or strictly negative, so only nonzero divisors
+            // count; each side of zero gives a branch unbounded in one direction, starting from
+            // the product value nearest zero divided by the outermost divisor value
+            double infinity = std::numeric_limits<double>::infinity();
+            bool isPositive = dividendBounds.lowerBound() > 0.0;
+            double nearest = dividendBounds.upperBound();
+            if (isPositive) {
+                nearest = dividendBounds.lowerBound();
+            }
+            Interval result = Interval::EMPTY();
+            if (divisorUpper > 0.0) {
+                double bound = nearest / divisorUpper;
+                if (isPositive) {
+                    result = result.hull(Interval(bound, infinity));
+                } else {
+                    result = result.hull(Interval(-infinity, bound));
+                }
+            }
+            if (divisorLower < 0.0) {
+                double bound = nearest / divisorLower;
+                if (isPositive) {
+                    result = result.hull(Interval(-infinity, bound));
+                } else {
+                    result = result.hull(Interval(bound, infinity));
+                }
+            }
+            return result;
+        }
+
+        Interval
+        Contractor::productBounds(Interval firstBounds, Interval secondBounds) {
+            if (firstBounds.isEmpty() || secondBounds.isEmpty()) {
+                return Interval::EMPTY();
+            }
+            double products[4] = {
+                firstBounds.lowerBound() * secondBounds.lowerBound(),
+                firstBounds.lowerBound() * secondBounds.upperBound(),
+                firstBounds.upperBound() * secondBounds.lowerBound(),
+                firstBounds.upperBound() * secondBounds.upperBound()
+            };
+            double lower = std::numeric_limits<double>::infinity();
+            double upper = -std::numeric_limits<double>::infinity();
+            for (double product : products) {
+                // Zero times infinity
+                if (std::isnan(product)) {
+                    product = 0.0;
+                }
+                lower = std::min(lower, product);
+                upper = std::max(upper, product);
+            }
+            return Interval(lower, upper);
+        }
+
+        Interval
+        Contractor::squarePreimage(Interval squaredBounds, Interval argumentBounds) {
+            Interval nonNegative = squaredBounds.intersection(
+                Interval(0.0, std::numeric_limits<double>::infinity())
+            );
+            if (nonNegative.isEmpty()) {
+                return Interval::EMPTY();
+            }
+            Interval root = widened(sqrt(nonNegative));
+            Interval positive = argumentBounds.intersection(root);
+            Interval negative = argumentBounds.intersection(-root);
+            return positive.hull(negative);
+        }
+
+        Interval
+        Contractor::sinePreimage(Interval valueBounds, Interval argumentBounds) {
+            Interval clamped = valueBounds.intersection(Interval(-1.0, 1.0));
+            if (clamped.isEmpty()) {
+                return Interval::EMPTY();
+            }
+            // Only narrow arguments spanning a modest number of periods
+            if (!isBounded(argumentBounds) || argumentBounds.width() > 64 * M_PI) {
+                return argumentBounds;
+            }
+            double lowerAngle = std::asin(clamped.lowerBound());
+            double upperAngle = std::asin(clamped.upperBound());
+            int minPeriod = int(std::floor(argumentBounds.lowerBound() / (2 * M_PI))) - 1;
+            int maxPeriod = int(std::ceil(argumentBounds.upperBound() / (2 * M_PI))) + 1;
+
+            // Within each period, the sine is increasing over [-pi/2, pi/2] and decreasing over
+            // [pi/2, 3pi/2]
+            Interval result = Interval::EMPTY();
+            for (int period = minPeriod; period <= maxPeriod; ++period) {
+                double offset = 2 * M_PI * period;
+                Interval increasing = widened(
+                    Interval(offset + lowerAngle, offset + upperAngle)
+                );
+                Interval decreasing = widened(
+                    Interval(offset + M_PI - upperAngle, offset + M_PI - lowerAngle)
+                );
+                result = result.hull(argumentBounds.intersection(increasing));
+                result = result.hull(argumentBounds.intersection(decreasing));
+            }
+            return result;
+        }
+
+        Interval
+        Contractor::tangentPreimage(Interval valueBounds, Interval argumentBounds) {
+            if (valueBounds.isEmpty()) {
+                return Interval::EMPTY();
+            }
+            if (!isBounded(argumentBounds) || argumentBounds.width() > 64 * M_PI) {
+                return argumentBounds;
+            }
+            double lowerAngle = std::atan(valueBounds.lowerBound());
+            double upperAngle = std::atan(valueBounds.upperBound());
+            int minPeriod = int(std::floor(argumentBounds.lowerBound() / M_PI)) - 1;
+            int maxPeriod = int(std::ceil(argumentBounds.upperBound() / M_PI)) + 1;
+
+            // The tangent is increasing within each period (-pi/2, pi/2)
+            Interval result = Interval::EMPTY();
+            for (int period = minPeriod; period <= maxPeriod; ++period) {
+                double offset = M_PI * period;
+                Interval branch = widened(Interval(offset + lowerAngle, offset + upperAngle));
+                result = result.hull(argumentBounds.intersection(branch));
+            }
+            return result;
+        }
+
+        std::vector<Interval>
+        Contractor::contracted(
+            const ExpressionImplementationPtr& expressionPtr,
+            const std::vector<Interval>& parameterBounds,
+            const std::vector<Interval>& valueBounds
+        ) {
+            Contractor contractor(parameterBounds);
+            for (int pass = 0; pass < MAX_NUM_PASSES; ++pass) {
+                std::vector<Interval> previousBounds = contractor.parameterBounds();
+                contractor.revise(expressionPtr, valueBounds);
+                if (contractor.isEmpty()) {
+                    return std::vector<Interval>(parameterBounds.size(), Interval::EMPTY());
+                }
+                bool isImproved = false;
+                for (std::size_t index = 0; index < previousBounds.size(); ++index) {
+                    double previousWidth = previousBounds[index].width();
+                    double width = contractor.parameterBounds()[index].width();
+                    if (width < (1.0 - MIN_RELATIVE_IMPROVEMENT) * previousWidth) {
+                        isImproved = true;
+                    }
+                }
+                if (!isImproved) {
+                    break;
+                }
+            }
+            return contractor.parameterBounds();
+        }
+
+        std::vector<Interval>
+        Contractor::preimage(
+            const ExpressionImplementationPtr& expressionPtr,
+            const std::vector<Interval>& valueBounds,
+            const std::vector<Interval>& domain,
+            double tolerance
+        ) {
+            std::vector<Interval> results;
+            int numParameters = int(domain.size());
+
+            // Depth-first, processing the lower half of each bisected box first
+            std::vector<std::vector<Interval>> stack(1, domain);
+            while (!stack.empty()) {
+                std::vector<Interval> box = contracted(expressionPtr, stack.back(), valueBounds);
+                stack.pop_back();
+                if (box.empty() || box.front().isEmpty()) {
+                    continue;
+                }
+
+                Contractor contractor(box);
+                const std::vector<Interval>& bounds = contractor.bounds(expressionPtr);
+                bool isInside = true;
+                for (std::size_t index = 0; index < valueBounds.size(); ++index) {
+                    if (!valueBounds[index].contains(bounds[index], 0.0)) {
+                        isInside = false;
+                    }
+                }
+
+                int splitIndex = -1;
+                double splitWidth = tolerance;
+                for (int index = 0; index < numParameters; ++index) {
+                    if (box[index].width() > splitWidth) {
+                        splitWidth = box[index].width();
+                        splitIndex = index;
+                    }
+                }
+                std::pair<Interval, Interval> halves;
+                if (splitIndex >= 0) {
+                    halves = box[splitIndex].bisected();
+                }
+                bool canBisect = splitIndex >= 0 && (
+                    halves.first.width() < splitWidth &&
+                    halves.second.width() < splitWidth
+                );
+                if (isInside || !canBisect) {
+                    results.insert(results.end(), box.begin(), box.end());
+                    continue;
+                }
+                stack.push_back(box);
+                stack.back()[splitIndex] = halves.second;
+                stack.push_back(box);
+                stack.back()[splitIndex] = halves.first;
+            }
+            return results;
+        }
+    }
+}
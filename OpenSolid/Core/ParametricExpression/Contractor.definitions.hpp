@@ -0,0 +1,169 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#pragma once
+
+#include <OpenSolid/config.hpp>
+
+#include <OpenSolid/Core/ParametricExpression/Contractor.declarations.hpp>
+
+#include <OpenSolid/Core/Interval.definitions.hpp>
+#include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.declarations.hpp>
+
+#include <map>
+#include <vector>
+
+namespace opensolid
+{
+    namespace detail
+    {
+        // Interval constraint propagation (HC4-revise) over an expression graph. A forward pass
+        // computes bounds for every subexpression from the bounds of its operands (see
+        // ExpressionImplementation::bounds()); the bounds of the root expression are then
+        // intersected with the desired value bounds, and a backward pass uses the inverse of
+        // each operation to narrow the bounds of its operands in turn (see
+        // ExpressionImplementation::contract()), ending with the parameter bounds. Parameter
+        // values removed by narrowing cannot give values within the desired bounds.
+        class Contractor
+        {
+        private:
+            std::vector<Interval> _parameterBounds;
+            std::map<const ExpressionImplementation*, std::vector<Interval>> _boundsCache;
+
+            // Every expression whose bounds have been computed, with operands always before
+            // the expressions that use them
+            std::vector<ExpressionImplementationPtr> _expressions;
+
+            bool _isEmpty;
+        public:
+            OPENSOLID_CORE_EXPORT
+            explicit
+            Contractor(const std::vector<Interval>& parameterBounds);
+
+            const std::vector<Interval>&
+            parameterBounds() const;
+
+            // Whether the constraints have been shown to be infeasible over the parameter bounds
+            bool
+            isEmpty() const;
+
+            // Bounds of the given expression over the current parameter bounds
+            OPENSOLID_CORE_EXPORT
+            const std::vector<Interval>&
+            bounds(const ExpressionImplementationPtr& expressionPtr);
+
+            // Intersect the bounds of one component of the given expression (whose bounds must
+            // already have been computed) with the given bounds, widened slightly to allow for
+            // rounding error
+            OPENSOLID_CORE_EXPORT
+            void
+            narrow(const ExpressionImplementationPtr& expressionPtr, int index, Interval bounds);
+
+            OPENSOLID_CORE_EXPORT
+            void
+            narrowParameter(int index, Interval bounds);
+
+            // Narrow the components of the given vector expression given bounds on its squared
+            // norm (shared by squared norm and norm expressions)
+            OPENSOLID_CORE_EXPORT
+            void
+            narrowSquaredNorm(
+                const ExpressionImplementationPtr& operand,
+                Interval squaredNormBounds
+            );
+
+            // Perform a single forward/backward pass, narrowing the parameter bounds to those
+            // for which the given expression may have a value within the given bounds
+            OPENSOLID_CORE_EXPORT
+            void
+            revise(
+                const ExpressionImplementationPtr& expressionPtr,
+                const std::vector<Interval>& valueBounds
+            );
+
+            // Widen the given interval slightly, to account for rounding error in the inverse
+            // functions used to narrow bounds
+            OPENSOLID_CORE_EXPORT
+            static Interval
+            widened(Interval interval);
+
+            // All values x such that x * y lies within 'dividendBounds' for some y within
+            // 'divisorBounds' (extended interval division). Unlike plain interval division this
+            // is correct when the divisor bounds contain or end at zero: the result is WHOLE if
+            // both bounds contain zero, the hull of the two unbounded branches on either side of
+            // zero otherwise, and EMPTY if the divisor can only be zero.
+            OPENSOLID_CORE_EXPORT
+            static Interval
+            quotientBounds(Interval dividendBounds, Interval divisorBounds);
+
+            // Bounds on x * y for x and y within the given bounds, treating zero times an
+            // infinite bound as zero (since the values themselves are finite)
+            OPENSOLID_CORE_EXPORT
+            static Interval
+            productBounds(Interval firstBounds, Interval secondBounds);
+
+            // Smallest interval containing all values within 'argumentBounds' whose square
+            // lies within 'squaredBounds'
+            OPENSOLID_CORE_EXPORT
+            static Interval
+            squarePreimage(Interval squaredBounds, Interval argumentBounds);
+
+            // Smallest interval containing all values within 'argumentBounds' whose sine lies
+            // within 'valueBounds'
+            OPENSOLID_CORE_EXPORT
+            static Interval
+            sinePreimage(Interval valueBounds, Interval argumentBounds);
+
+            // Smallest interval containing all values within 'argumentBounds' whose tangent
+            // lies within 'valueBounds'
+            OPENSOLID_CORE_EXPORT
+            static Interval
+            tangentPreimage(Interval valueBounds, Interval argumentBounds);
+
+            // Repeatedly revise the given parameter bounds until they stop shrinking
+            // significantly; returns empty intervals if the constraints are infeasible
+            OPENSOLID_CORE_EXPORT
+            static std::vector<Interval>
+            contracted(
+                const ExpressionImplementationPtr& expressionPtr,
+                const std::vector<Interval>& parameterBounds,
+                const std::vector<Interval>& valueBounds
+            );
+
+            // Find boxes covering all parameter values within the given domain for which the
+            // given expression has a value within the given bounds, by contracting and then
+            // bisecting boxes until either the expression is known to lie within the given
+            // bounds over an entire box or the box is no wider than the given tolerance. The
+            // bounds of each box are stored consecutively in the result.
+            OPENSOLID_CORE_EXPORT
+            static std::vector<Interval>
+            preimage(
+                const ExpressionImplementationPtr& expressionPtr,
+                const std::vector<Interval>& valueBounds,
+                const std::vector<Interval>& domain,
+                double tolerance
+            );
+        };
+    }
+}
@@ -26,26 +26,25 @@
 
 #include <OpenSolid/config.hpp>
 
-#include <OpenSolid/Core/ParametricExpression/Bytecode/LValue.declarations.hpp>
+#include <OpenSolid/Core/ParametricExpression/Contractor.definitions.hpp>
 
-#include <OpenSolid/Core/ParametricExpression/Bytecode/Compiler.declarations.hpp>
-#include <OpenSolid/Core/ParametricExpression/Bytecode/Expr.declarations.hpp>
+#include <OpenSolid/Core/Interval.hpp>
+#include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
 
 namespace opensolid
 {
     namespace detail
     {
-        class LValue
-        {
-        private:
-            Compiler* _compiler;
-
-            friend class Compiler;
-
-            explicit
-            LValue(Compiler* compiler);
-        public:
-
-        };
+        inline
+        const std::vector<Interval>&
+        Contractor::parameterBounds() const {
+            return _parameterBounds;
+        }
+
+        inline
+        bool
+        Contractor::isEmpty() const {
+            return _isEmpty;
+        }
     }
 }
@@ -24,6 +24,7 @@
 
 #include <OpenSolid/Core/ParametricExpression/CosineExpression.hpp>
 
+#include <OpenSolid/Core/ParametricExpression/Contractor.hpp>
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
 
 namespace opensolid
@@ -35,76 +36,30 @@ namespace opensolid
             return 1;
         }
         
-        void
-        CosineExpression::evaluateImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            expressionCompiler.evaluate(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                resultID,
-                [] (MatrixViewXd results) {
-                    results.setMap(
-                        results,
-                        [] (double value) {
-                            return opensolid::cos(value);
-                        }
-                    );
-                }
-            );
-        }
-        
-        void
-        CosineExpression::evaluateImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        std::vector<int>
+        CosineExpression::compileImpl(
+            const std::vector<int>& parameterRegisters,
+            Compiler& compiler
         ) const {
-            expressionCompiler.evaluate(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                resultID,
-                [] (IntervalMatrixViewXd results) {
-                    results.setMap(
-                        results,
-                        [] (Interval value) {
-                            return opensolid::cos(value);
-                        }
-                    );
-                }
-            );
+            int operandRegister = compiler.evaluate(operand(), parameterRegisters).front();
+            return std::vector<int>(1, compiler.compute(Bytecode::COS, operandRegister));
         }
 
-        void
-        CosineExpression::evaluateJacobianImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            expressionCompiler.evaluateJacobian(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(operand(), parameterID),
-                resultID,
-                [] (ConstMatrixViewXd operandValues, MatrixViewXd results) {
-                    results *= -opensolid::sin(operandValues.value());
-                }
-            );
+        std::vector<Interval>
+        CosineExpression::boundsImpl(Contractor& contractor) const {
+            const std::vector<Interval>& operandBounds = contractor.bounds(operand());
+            return std::vector<Interval>(1, opensolid::cos(operandBounds.front()));
         }
-        
+
         void
-        CosineExpression::evaluateJacobianImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        CosineExpression::contractImpl(
+            const std::vector<Interval>& bounds,
+            Contractor& contractor
         ) const {
-            expressionCompiler.evaluateJacobian(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(operand(), parameterID),
-                resultID,
-                [] (ConstIntervalMatrixViewXd operandValues, IntervalMatrixViewXd results) {
-                    results *= -opensolid::sin(operandValues.value());
-                }
-            );
+            // cos(x) = sin(x + pi / 2)
+            Interval shiftedBounds = contractor.bounds(operand()).front() + M_PI / 2;
+            Interval shiftedPreimage = Contractor::sinePreimage(bounds.front(), shiftedBounds);
+            contractor.narrow(operand(), 0, shiftedPreimage - M_PI / 2);
         }
 
         ExpressionImplementationPtr
@@ -24,6 +24,7 @@
 
 #include <OpenSolid/Core/ParametricExpression/CrossProductExpression.hpp>
 
+#include <OpenSolid/Core/ParametricExpression/Contractor.hpp>
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
 #include <OpenSolid/Core/Vector.hpp>
 
@@ -36,118 +37,49 @@ namespace opensolid
             return 3;
         }
         
-        void
-        CrossProductExpression::evaluateImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(firstOperand(), parameterID),
-                expressionCompiler.evaluate(secondOperand(), parameterID),
-                resultID,
-                [] (
-                    ConstMatrixViewXd firstValues,
-                    ConstMatrixViewXd secondValues,
-                    MatrixViewXd results
-                ) {
-                    for (int columnIndex = 0; columnIndex < results.numColumns(); ++columnIndex) {
-                        Vector3d firstVector(firstValues.column(columnIndex));
-                        Vector3d secondVector(secondValues.column(columnIndex));
-                        results.column(columnIndex) = firstVector.cross(secondVector).components();
-                    } 
-                }
-            );
-        }
-        
-        void
-        CrossProductExpression::evaluateImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        std::vector<int>
+        CrossProductExpression::compileImpl(
+            const std::vector<int>& parameterRegisters,
+            Compiler& compiler
         ) const {
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(firstOperand(), parameterID),
-                expressionCompiler.evaluate(secondOperand(), parameterID),
-                resultID,
-                [] (
-                    ConstIntervalMatrixViewXd firstValues,
-                    ConstIntervalMatrixViewXd secondValues,
-                    IntervalMatrixViewXd results
-                ) {
-                    for (int columnIndex = 0; columnIndex < results.numColumns(); ++columnIndex) {
-                        IntervalVector3d firstVector(firstValues.column(columnIndex));
-                        IntervalVector3d secondVector(secondValues.column(columnIndex));
-                        results.column(columnIndex) = firstVector.cross(secondVector).components();
-                    } 
-                }
-            );
+            std::vector<int> firstRegisters = compiler.evaluate(firstOperand(), parameterRegisters);
+            std::vector<int> secondRegisters =
+                compiler.evaluate(secondOperand(), parameterRegisters);
+            std::vector<int> results(3);
+            for (int index = 0; index < 3; ++index) {
+                int nextIndex = (index + 1) % 3;
+                int lastIndex = (index + 2) % 3;
+                results[index] = compiler.compute(
+                    Bytecode::SUBTRACT,
+                    compiler.compute(
+                        Bytecode::MULTIPLY,
+                        firstRegisters[nextIndex],
+                        secondRegisters[lastIndex]
+                    ),
+                    compiler.compute(
+                        Bytecode::MULTIPLY,
+                        firstRegisters[lastIndex],
+                        secondRegisters[nextIndex]
+                    )
+                );
+            }
+            return results;
         }
 
-        void
-        CrossProductExpression::evaluateJacobianImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            int numParameters = this->numParameters();
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(firstOperand(), parameterID),
-                expressionCompiler.evaluate(secondOperand(), parameterID),
-                expressionCompiler.evaluateJacobian(firstOperand(), parameterID),
-                expressionCompiler.evaluateJacobian(secondOperand(), parameterID),
-                resultID,
-                [numParameters] (
-                    ConstMatrixViewXd firstValues,
-                    ConstMatrixViewXd secondValues,
-                    ConstMatrixViewXd firstJacobian,
-                    ConstMatrixViewXd secondJacobian,
-                    MatrixViewXd results
-                ) {
-                    Vector3d firstVector(firstValues);
-                    Vector3d secondVector(secondValues);
-                    for (int columnIndex = 0; columnIndex < numParameters; ++columnIndex) {
-                        Vector3d firstPartial(firstJacobian.column(columnIndex));
-                        Vector3d secondPartial(secondJacobian.column(columnIndex));
-                        results.column(columnIndex) = (
-                            firstPartial.cross(secondVector) + firstVector.cross(secondPartial)
-                        ).components();
-                    }
-                }
-            );
-        }
-        
-        void
-        CrossProductExpression::evaluateJacobianImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
-        ) const {
-            int numParameters = this->numParameters();
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(firstOperand(), parameterID),
-                expressionCompiler.evaluate(secondOperand(), parameterID),
-                expressionCompiler.evaluateJacobian(firstOperand(), parameterID),
-                expressionCompiler.evaluateJacobian(secondOperand(), parameterID),
-                resultID,
-                [numParameters] (
-                    ConstIntervalMatrixViewXd firstValues,
-                    ConstIntervalMatrixViewXd secondValues,
-                    ConstIntervalMatrixViewXd firstJacobian,
-                    ConstIntervalMatrixViewXd secondJacobian,
-                    IntervalMatrixViewXd results
-                ) {
-                    IntervalVector3d firstVector(firstValues);
-                    IntervalVector3d secondVector(secondValues);
-                    for (int columnIndex = 0; columnIndex < numParameters; ++columnIndex) {
-                        IntervalVector3d firstPartial(firstJacobian.column(columnIndex));
-                        IntervalVector3d secondPartial(secondJacobian.column(columnIndex));
-                        results.column(columnIndex) = (
-                            firstPartial.cross(secondVector) + firstVector.cross(secondPartial)
-                        ).components();
-                    }
-                }
-            );
+        std::vector<Interval>
+        CrossProductExpression::boundsImpl(Contractor& contractor) const {
+            const std::vector<Interval>& firstBounds = contractor.bounds(firstOperand());
+            const std::vector<Interval>& secondBounds = contractor.bounds(secondOperand());
+            std::vector<Interval> results(3);
+            for (int index = 0; index < 3; ++index) {
+                int nextIndex = (index + 1) % 3;
+                int previousIndex = (index + 2) % 3;
+                results[index] = (
+                    firstBounds[nextIndex] * secondBounds[previousIndex] -
+                    firstBounds[previousIndex] * secondBounds[nextIndex]
+                );
+            }
+            return results;
         }
 
         ExpressionImplementationPtr
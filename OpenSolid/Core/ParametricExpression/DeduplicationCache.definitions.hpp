@@ -29,6 +29,10 @@
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.declarations.hpp>
 #include <OpenSolid/Core/ParametricExpression/DeduplicationCache.declarations.hpp>
 
+#include <cstddef>
+#include <unordered_map>
+#include <utility>
+
 namespace opensolid
 {
     namespace detail
@@ -36,13 +40,14 @@ namespace opensolid
         class DeduplicationCache
         {
         private:
-            std::vector<ExpressionImplementationPtr> _cache;
+            // Deduplicated expressions indexed by structural hash
+            typedef std::unordered_multimap<std::size_t, ExpressionImplementationPtr> Map;
+            typedef Map::value_type Entry;
 
-            std::vector<ExpressionImplementationPtr>::iterator
-            begin();
+            Map _cache;
 
-            std::vector<ExpressionImplementationPtr>::iterator
-            end();
+            std::pair<Map::iterator, Map::iterator>
+            equalRange(std::size_t structuralHash);
 
             void
             add(const ExpressionImplementationPtr& functionImplementation);
@@ -28,26 +28,24 @@
 
 #include <OpenSolid/Core/ParametricExpression/DeduplicationCache.definitions.hpp>
 
+#include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.definitions.hpp>
+
 namespace opensolid
 {
     namespace detail
     {
         inline
-        std::vector<ExpressionImplementationPtr>::iterator
-        DeduplicationCache::begin() {
-            return _cache.begin();
-        }
-
-        inline
-        std::vector<ExpressionImplementationPtr>::iterator
-        DeduplicationCache::end() {
-            return _cache.end();
+        std::pair<DeduplicationCache::Map::iterator, DeduplicationCache::Map::iterator>
+        DeduplicationCache::equalRange(std::size_t structuralHash) {
+            return _cache.equal_range(structuralHash);
         }
 
         inline
         void
         DeduplicationCache::add(const ExpressionImplementationPtr& functionImplementation) {
-            _cache.push_back(functionImplementation);
+            _cache.insert(
+                Entry(functionImplementation->structuralHash(), functionImplementation)
+            );
         }
     }
 }
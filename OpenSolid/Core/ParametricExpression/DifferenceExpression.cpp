@@ -24,6 +24,7 @@
 
 #include <OpenSolid/Core/ParametricExpression/DifferenceExpression.hpp>
 
+#include <OpenSolid/Core/ParametricExpression/Contractor.hpp>
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
 
 namespace opensolid
@@ -35,68 +36,47 @@ namespace opensolid
             return firstOperand()->numDimensions();
         }
         
-        void
-        DifferenceExpression::evaluateImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
+        std::vector<int>
+        DifferenceExpression::compileImpl(
+            const std::vector<int>& parameterRegisters,
+            Compiler& compiler
         ) const {
-            expressionCompiler.evaluate(firstOperand(), parameterID, resultID);
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(secondOperand(), parameterID),
-                resultID,
-                [] (ConstMatrixViewXd secondValues, MatrixViewXd results) {
-                    results -= secondValues;
-                }
-            );
-        }
-        
-        void
-        DifferenceExpression::evaluateImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
-        ) const {
-            expressionCompiler.evaluate(firstOperand(), parameterID, resultID);
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(secondOperand(), parameterID),
-                resultID,
-                [] (ConstIntervalMatrixViewXd secondValues, IntervalMatrixViewXd results) {
-                    results -= secondValues;
-                }
-            );
+            std::vector<int> firstRegisters = compiler.evaluate(firstOperand(), parameterRegisters);
+            std::vector<int> secondRegisters =
+                compiler.evaluate(secondOperand(), parameterRegisters);
+            std::vector<int> results(numDimensions());
+            for (int index = 0; index < numDimensions(); ++index) {
+                results[index] = compiler.compute(
+                    Bytecode::SUBTRACT,
+                    firstRegisters[index],
+                    secondRegisters[index]
+                );
+            }
+            return results;
         }
 
-        void
-        DifferenceExpression::evaluateJacobianImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            expressionCompiler.evaluateJacobian(firstOperand(), parameterID, resultID);
-            expressionCompiler.compute(
-                expressionCompiler.evaluateJacobian(secondOperand(), parameterID),
-                resultID,
-                [] (ConstMatrixViewXd secondJacobian, MatrixViewXd results) {
-                    results -= secondJacobian;
-                }
-            );
+        std::vector<Interval>
+        DifferenceExpression::boundsImpl(Contractor& contractor) const {
+            const std::vector<Interval>& firstBounds = contractor.bounds(firstOperand());
+            const std::vector<Interval>& secondBounds = contractor.bounds(secondOperand());
+            std::vector<Interval> results(numDimensions());
+            for (int index = 0; index < numDimensions(); ++index) {
+                results[index] = firstBounds[index] - secondBounds[index];
+            }
+            return results;
         }
-        
+
         void
-        DifferenceExpression::evaluateJacobianImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        DifferenceExpression::contractImpl(
+            const std::vector<Interval>& bounds,
+            Contractor& contractor
         ) const {
-            expressionCompiler.evaluateJacobian(firstOperand(), parameterID, resultID);
-            expressionCompiler.compute(
-                expressionCompiler.evaluateJacobian(secondOperand(), parameterID),
-                resultID,
-                [] (ConstIntervalMatrixViewXd secondJacobian, IntervalMatrixViewXd results) {
-                    results -= secondJacobian;
-                }
-            );
+            const std::vector<Interval>& firstBounds = contractor.bounds(firstOperand());
+            const std::vector<Interval>& secondBounds = contractor.bounds(secondOperand());
+            for (int index = 0; index < numDimensions(); ++index) {
+                contractor.narrow(firstOperand(), index, bounds[index] + secondBounds[index]);
+                contractor.narrow(secondOperand(), index, firstBounds[index] - bounds[index]);
+            }
         }
 
         ExpressionImplementationPtr
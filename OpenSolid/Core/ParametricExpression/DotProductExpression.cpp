@@ -24,6 +24,7 @@
 
 #include <OpenSolid/Core/ParametricExpression/DotProductExpression.hpp>
 
+#include <OpenSolid/Core/ParametricExpression/Contractor.hpp>
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
 
 namespace opensolid
@@ -35,124 +36,68 @@ namespace opensolid
             return 1;
         }
         
-        void
-        DotProductExpression::evaluateImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(firstOperand(), parameterID),
-                expressionCompiler.evaluate(secondOperand(), parameterID),
-                resultID,
-                [] (
-                    ConstMatrixViewXd firstValues,
-                    ConstMatrixViewXd secondValues,
-                    MatrixViewXd results
-                ) {
-                    for (int columnIndex = 0; columnIndex < results.numColumns(); ++columnIndex) {
-                        results(0, columnIndex) = firstValues.column(columnIndex).binaryFold(
-                            secondValues.column(columnIndex),
-                            0.0,
-                            [] (double result, double firstValue, double secondValue) {
-                                return result + firstValue * secondValue;
-                            }
-                        );
-                    }
-                }
-            );
-        }
-        
-        void
-        DotProductExpression::evaluateImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        std::vector<int>
+        DotProductExpression::compileImpl(
+            const std::vector<int>& parameterRegisters,
+            Compiler& compiler
         ) const {
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(firstOperand(), parameterID),
-                expressionCompiler.evaluate(secondOperand(), parameterID),
-                resultID,
-                [] (
-                    ConstIntervalMatrixViewXd firstValues,
-                    ConstIntervalMatrixViewXd secondValues,
-                    IntervalMatrixViewXd results
-                ) {
-                    for (int columnIndex = 0; columnIndex < results.numColumns(); ++columnIndex) {
-                        results(0, columnIndex) = firstValues.column(columnIndex).binaryFold(
-                            secondValues.column(columnIndex),
-                            Interval(0.0),
-                            [] (Interval result, Interval firstValue, Interval secondValue) {
-                                return result + firstValue * secondValue;
-                            }
-                        );
-                    }
-                }
+            std::vector<int> firstRegisters = compiler.evaluate(firstOperand(), parameterRegisters);
+            std::vector<int> secondRegisters =
+                compiler.evaluate(secondOperand(), parameterRegisters);
+            int resultRegister = compiler.compute(
+                Bytecode::MULTIPLY,
+                firstRegisters.front(),
+                secondRegisters.front()
             );
+            for (std::size_t index = 1; index < firstRegisters.size(); ++index) {
+                resultRegister = compiler.compute(
+                    Bytecode::ADD,
+                    resultRegister,
+                    compiler.compute(
+                        Bytecode::MULTIPLY,
+                        firstRegisters[index],
+                        secondRegisters[index]
+                    )
+                );
+            }
+            return std::vector<int>(1, resultRegister);
         }
 
-        void
-        DotProductExpression::evaluateJacobianImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            MatrixID<double> secondTransposeProductID = expressionCompiler.createTemporary(
-                1,
-                numParameters()
-            );
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(firstOperand(), parameterID),
-                expressionCompiler.evaluate(secondOperand(), parameterID),
-                expressionCompiler.evaluateJacobian(firstOperand(), parameterID),
-                expressionCompiler.evaluateJacobian(secondOperand(), parameterID),
-                secondTransposeProductID,
-                resultID,
-                [] (
-                    ConstMatrixViewXd firstValues,
-                    ConstMatrixViewXd secondValues,
-                    ConstMatrixViewXd firstJacobian,
-                    ConstMatrixViewXd secondJacobian,
-                    MatrixViewXd secondTransposeProduct,
-                    MatrixViewXd results
-                ) {
-                    results.setTransposeProduct(firstValues, secondJacobian);
-                    secondTransposeProduct.setTransposeProduct(secondValues, firstJacobian);
-                    results += secondTransposeProduct;
-                }
-            );
+        std::vector<Interval>
+        DotProductExpression::boundsImpl(Contractor& contractor) const {
+            const std::vector<Interval>& firstBounds = contractor.bounds(firstOperand());
+            const std::vector<Interval>& secondBounds = contractor.bounds(secondOperand());
+            Interval result(0.0);
+            for (std::size_t index = 0; index < firstBounds.size(); ++index) {
+                result += firstBounds[index] * secondBounds[index];
+            }
+            return std::vector<Interval>(1, result);
         }
-        
+
         void
-        DotProductExpression::evaluateJacobianImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        DotProductExpression::contractImpl(
+            const std::vector<Interval>& bounds,
+            Contractor& contractor
         ) const {
-            MatrixID<Interval> secondTransposeProductID = expressionCompiler.createTemporary(
-                1,
-                numParameters()
-            );
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(firstOperand(), parameterID),
-                expressionCompiler.evaluate(secondOperand(), parameterID),
-                expressionCompiler.evaluateJacobian(firstOperand(), parameterID),
-                expressionCompiler.evaluateJacobian(secondOperand(), parameterID),
-                secondTransposeProductID,
-                resultID,
-                [] (
-                    ConstIntervalMatrixViewXd firstValues,
-                    ConstIntervalMatrixViewXd secondValues,
-                    ConstIntervalMatrixViewXd firstJacobian,
-                    ConstIntervalMatrixViewXd secondJacobian,
-                    IntervalMatrixViewXd secondTransposeProduct,
-                    IntervalMatrixViewXd results
-                ) {
-                    results.setTransposeProduct(firstValues, secondJacobian);
-                    secondTransposeProduct.setTransposeProduct(secondValues, firstJacobian);
-                    results += secondTransposeProduct;
+            const std::vector<Interval>& firstBounds = contractor.bounds(firstOperand());
+            const std::vector<Interval>& secondBounds = contractor.bounds(secondOperand());
+            int numComponents = firstOperand()->numDimensions();
+            for (int index = 0; index < numComponents; ++index) {
+                // Each term must equal the dot product minus the sum of all other terms
+                Interval term = bounds.front();
+                for (int other = 0; other < numComponents; ++other) {
+                    if (other != index) {
+                        term -= Contractor::productBounds(firstBounds[other], secondBounds[other]);
+                    }
                 }
-            );
+                term = term.intersection(
+                    Contractor::productBounds(firstBounds[index], secondBounds[index])
+                );
+                Interval firstPreimage = Contractor::quotientBounds(term, secondBounds[index]);
+                contractor.narrow(firstOperand(), index, firstPreimage);
+                Interval secondPreimage = Contractor::quotientBounds(term, firstBounds[index]);
+                contractor.narrow(secondOperand(), index, secondPreimage);
+            }
         }
 
         ExpressionImplementationPtr
@@ -22,31 +22,68 @@
 *                                                                                   *
 ************************************************************************************/
 
-#pragma once
-
 #include <OpenSolid/config.hpp>
 
-#include <OpenSolid/Core/ParametricExpression/EvaluationOperation.declarations.hpp>
+#include <OpenSolid/Core/ParametricExpression/EvaluationWorkspace.hpp>
 
-#include <OpenSolid/Core/ParametricExpression/EvaluationContext.declarations.hpp>
+#include <OpenSolid/Core/AffineForm.hpp>
+#include <OpenSolid/Core/Interval.hpp>
 
-#include <functional>
+#include <algorithm>
+#include <limits>
 
 namespace opensolid
 {
     namespace detail
     {
-        template <class TScalar>
-        class EvaluationOperation
+        #ifdef OPENSOLID_NAN_FILL_SCRATCH
+        namespace
         {
-        private:
-            std::function<void(EvaluationContext<TScalar>&)> _operation;
-        public:
-            template <class TOperation>
-            EvaluationOperation(TOperation operation);
+            inline
+            void
+            fillUninitialized(double* begin, double* end) {
+                std::fill(begin, end, std::numeric_limits<double>::quiet_NaN());
+            }
 
+            inline
             void
-            execute(EvaluationContext<TScalar>& evaluationContext) const;
-        };
+            fillUninitialized(Interval* begin, Interval* end) {
+                std::fill(begin, end, Interval::EMPTY());
+            }
+
+            inline
+            void
+            fillUninitialized(AffineForm* begin, AffineForm* end) {
+                std::fill(begin, end, AffineForm(std::numeric_limits<double>::quiet_NaN()));
+            }
+        }
+        #endif
+
+        template <class TScalar>
+        EvaluationWorkspace<TScalar>::EvaluationWorkspace() {
+        }
+
+        template <class TScalar>
+        TScalar*
+        EvaluationWorkspace<TScalar>::memory(int size) {
+            if (int(_memory.size()) < size) {
+                _memory.resize(size);
+            }
+            #ifdef OPENSOLID_NAN_FILL_SCRATCH
+            fillUninitialized(_memory.data(), _memory.data() + size);
+            #endif
+            return _memory.data();
+        }
+
+        template <class TScalar>
+        EvaluationWorkspace<TScalar>&
+        EvaluationWorkspace<TScalar>::threadLocal() {
+            static thread_local EvaluationWorkspace<TScalar> workspace;
+            return workspace;
+        }
+
+        template class EvaluationWorkspace<double>;
+        template class EvaluationWorkspace<Interval>;
+        template class EvaluationWorkspace<AffineForm>;
     }
 }
@@ -29,6 +29,6 @@ namespace opensolid
     namespace detail
     {
         template <class TScalar>
-        class EvaluationOperation;
+        class EvaluationWorkspace;
     }
 }
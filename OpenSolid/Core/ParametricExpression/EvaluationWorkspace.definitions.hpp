@@ -26,54 +26,46 @@
 
 #include <OpenSolid/config.hpp>
 
-#include <OpenSolid/Core/ParametricExpression/EvaluationContext.declarations.hpp>
+#include <OpenSolid/Core/ParametricExpression/EvaluationWorkspace.declarations.hpp>
 
-#include <OpenSolid/Core/MatrixView.declarations.hpp>
-#include <OpenSolid/Core/ParametricExpression/MatrixID.declarations.hpp>
+#include <OpenSolid/Core/MatrixView.definitions.hpp>
 
 #include <vector>
-#include <cstdint>
 
 namespace opensolid
 {
     namespace detail
     {
+        // Scratch storage used while evaluating compiled expressions. Buffers are kept between
+        // evaluations and only grow, so repeated evaluation using the same workspace does not
+        // allocate once the largest expression evaluated has been seen. A workspace may only
+        // be used by one evaluation at a time.
         template <class TScalar>
-        class EvaluationContext
+        class EvaluationWorkspace
         {
         private:
-            MatrixView<const TScalar, -1, -1, -1> _parameterView;
-            std::vector<MatrixView<TScalar, -1, -1, -1>> _mutableViews;
             std::vector<TScalar> _memory;
-            TScalar* _stackEnd;
-            TScalar* _heapStart;
-            TScalar* _heapEnd;
+            std::vector<MatrixView<TScalar, -1, -1, -1>> _mutableViews;
         public:
-            EvaluationContext(
-                const MatrixView<const TScalar, -1, -1, -1>& parameterView,
-                MatrixView<TScalar, -1, -1, -1>& resultView,
-                int stackSize,
-                int heapSize,
-                int numTemporaryMatrices
-            );
-
-            int
-            numColumns() const;
-
-            void
-            stackAllocate(int viewIndex, int numRows, int numColumns);
-
-            void
-            stackDeallocate(int viewIndex);
+            OPENSOLID_CORE_EXPORT
+            EvaluationWorkspace();
 
-            void
-            heapAllocate(int viewIndex, int numRows, int numColumns);
+            // Scratch memory is never cleared between evaluations, since every instruction writes
+            // its result register before it is read. Builds configured with NAN_FILL_SCRATCH
+            // instead fill it with NaN each time it is requested, so that any read of an
+            // unwritten register shows up as NaN in evaluation results.
+            OPENSOLID_CORE_EXPORT
+            TScalar*
+            memory(int size);
 
-            MatrixView<TScalar, -1, -1, -1>
-            matrixView(const MatrixID<TScalar>& matrixID);
+            std::vector<MatrixView<TScalar, -1, -1, -1>>&
+            mutableViews(int numViews);
 
-            MatrixView<const TScalar, -1, -1, -1>
-            matrixView(const MatrixID<const TScalar>& matrixID) const;
+            // Default workspace for the calling thread, used by evaluation functions that are not
+            // given an explicit workspace
+            OPENSOLID_CORE_EXPORT
+            static EvaluationWorkspace<TScalar>&
+            threadLocal();
         };
     }
 }
@@ -26,26 +26,22 @@
 
 #include <OpenSolid/config.hpp>
 
-#include <OpenSolid/Core/ParametricExpression/EvaluationOperation.definitions.hpp>
+#include <OpenSolid/Core/ParametricExpression/EvaluationWorkspace.definitions.hpp>
 
-#include <OpenSolid/Core/ParametricExpression/EvaluationContext.hpp>
-
-#include <functional>
+#include <OpenSolid/Core/MatrixView.hpp>
 
 namespace opensolid
 {
     namespace detail
     {
-        template <class TScalar> template <class TOperation>
-        EvaluationOperation<TScalar>::EvaluationOperation(TOperation operation) :
-            _operation(operation) {
-        }
-
         template <class TScalar>
         inline
-        void
-        EvaluationOperation<TScalar>::execute(EvaluationContext<TScalar>& evaluationContext) const {
-            _operation(evaluationContext);
+        std::vector<MatrixView<TScalar, -1, -1, -1>>&
+        EvaluationWorkspace<TScalar>::mutableViews(int numViews) {
+            if (int(_mutableViews.size()) < numViews) {
+                _mutableViews.resize(numViews, MatrixView<TScalar, -1, -1, -1>(nullptr, 0, 0, 0));
+            }
+            return _mutableViews;
         }
     }
 }
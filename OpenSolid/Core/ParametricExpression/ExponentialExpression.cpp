@@ -24,6 +24,7 @@
 
 #include <OpenSolid/Core/ParametricExpression/ExponentialExpression.hpp>
 
+#include <OpenSolid/Core/ParametricExpression/Contractor.hpp>
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
 
 namespace opensolid
@@ -40,76 +41,27 @@ namespace opensolid
             return duplicateOperands(other);
         }
             
-        void
-        ExponentialExpression::evaluateImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
+        std::vector<int>
+        ExponentialExpression::compileImpl(
+            const std::vector<int>& parameterRegisters,
+            Compiler& compiler
         ) const {
-            expressionCompiler.evaluate(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                resultID,
-                [] (MatrixViewXd results) {
-                    results.setMap(
-                        results,
-                        [] (double value) {
-                            return opensolid::exp(value);
-                        }
-                    );
-                }
-            );
+            int operandRegister = compiler.evaluate(operand(), parameterRegisters).front();
+            return std::vector<int>(1, compiler.compute(Bytecode::EXP, operandRegister));
         }
 
-        void
-        ExponentialExpression::evaluateImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
-        ) const {
-            expressionCompiler.evaluate(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                resultID,
-                [] (IntervalMatrixViewXd results) {
-                    results.setMap(
-                        results,
-                        [] (Interval value) {
-                            return opensolid::exp(value);
-                        }
-                    );
-                }
-            );
+        std::vector<Interval>
+        ExponentialExpression::boundsImpl(Contractor& contractor) const {
+            const std::vector<Interval>& operandBounds = contractor.bounds(operand());
+            return std::vector<Interval>(1, opensolid::exp(operandBounds.front()));
         }
 
         void
-        ExponentialExpression::evaluateJacobianImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            expressionCompiler.evaluateJacobian(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(operand(), parameterID),
-                resultID,
-                [] (ConstMatrixViewXd operandValues, MatrixViewXd results) {
-                    results *= opensolid::exp(operandValues.value());
-                }
-            );
-        }
-        
-        void
-        ExponentialExpression::evaluateJacobianImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        ExponentialExpression::contractImpl(
+            const std::vector<Interval>& bounds,
+            Contractor& contractor
         ) const {
-            expressionCompiler.evaluateJacobian(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(operand(), parameterID),
-                resultID,
-                [] (ConstIntervalMatrixViewXd operandValues, IntervalMatrixViewXd results) {
-                    results *= opensolid::exp(operandValues.value());
-                }
-            );
+            contractor.narrow(operand(), 0, opensolid::log(bounds.front()));
         }
 
         ExpressionImplementationPtr
@@ -29,7 +29,12 @@
 #include <OpenSolid/Core/Matrix.declarations.hpp>
 #include <OpenSolid/Core/NumDimensions.definitions.hpp>
 #include <OpenSolid/Core/ParametricExpression.declarations.hpp>
+#include <OpenSolid/Core/Point.declarations.hpp>
 #include <OpenSolid/Core/Transformable.declarations.hpp>
+#include <OpenSolid/Core/UnitVector.declarations.hpp>
+#include <OpenSolid/Core/Vector.declarations.hpp>
+
+#include <vector>
 
 namespace opensolid
 {
@@ -173,6 +178,87 @@ namespace opensolid
             );
         };
 
+        template <class TValue, class TParameter>
+        class BSplineExpressionConstructors
+        {
+        };
+
+        template <class TValue>
+        class BSplineExpressionConstructors<TValue, double>
+        {
+        public:
+            // B-spline curve with the given degree, knots and control points. There must be
+            // degree + 1 more knots than control points, and the curve is defined over
+            // [knots[degree], knots[numControlPoints]] (it is extrapolated outside of that).
+            static ParametricExpression<TValue, double>
+            bspline(
+                int degree,
+                const std::vector<double>& knots,
+                const std::vector<TValue>& controlPoints
+            );
+
+            // Rational B-spline (NURBS) curve; all weights must be positive
+            static ParametricExpression<TValue, double>
+            bspline(
+                int degree,
+                const std::vector<double>& knots,
+                const std::vector<TValue>& controlPoints,
+                const std::vector<double>& weights
+            );
+        };
+
+        template <class TValue>
+        class BSplineExpressionConstructors<TValue, Point<2>>
+        {
+        public:
+            // Tensor product B-spline surface, where controlPoints[i][j] is the control point
+            // with index i along the first parameter and index j along the second
+            static ParametricExpression<TValue, Point<2>>
+            bspline(
+                int firstDegree,
+                int secondDegree,
+                const std::vector<double>& firstKnots,
+                const std::vector<double>& secondKnots,
+                const std::vector<std::vector<TValue>>& controlPoints
+            );
+
+            // Rational B-spline (NURBS) surface; all weights must be positive
+            static ParametricExpression<TValue, Point<2>>
+            bspline(
+                int firstDegree,
+                int secondDegree,
+                const std::vector<double>& firstKnots,
+                const std::vector<double>& secondKnots,
+                const std::vector<std::vector<TValue>>& controlPoints,
+                const std::vector<std::vector<double>>& weights
+            );
+        };
+
+        template <class TValue, class TParameter>
+        class PolynomialExpressionConstructors
+        {
+        };
+
+        template <class TValue>
+        class PolynomialExpressionConstructors<TValue, double>
+        {
+        public:
+            // Polynomial curve where coefficients[k] is the coefficient of t^k (for points, the
+            // coordinates of each coefficient are used)
+            static ParametricExpression<TValue, double>
+            polynomial(const std::vector<TValue>& coefficients);
+        };
+
+        template <class TValue>
+        class PolynomialExpressionConstructors<TValue, Point<2>>
+        {
+        public:
+            // Polynomial surface where coefficients[i][j] is the coefficient of u^i * v^j; every
+            // row must have the same number of coefficients
+            static ParametricExpression<TValue, Point<2>>
+            polynomial(const std::vector<std::vector<TValue>>& coefficients);
+        };
+
         template <class TValue, class TParameter>
         class ExpressionConstructors :
             public ZeroExpressionConstructor<TValue, TParameter>,
@@ -182,7 +268,9 @@ namespace opensolid
                 TValue,
                 NumDimensions<TValue>::Value,
                 TParameter
-            >
+            >,
+            public BSplineExpressionConstructors<TValue, TParameter>,
+            public PolynomialExpressionConstructors<TValue, TParameter>
         {
         };
     }
@@ -28,9 +28,12 @@
 
 #include <OpenSolid/Core/ParametricExpression/ExpressionConstructors.definitions.hpp>
 
+#include <OpenSolid/Core/Error.hpp>
 #include <OpenSolid/Core/Matrix.hpp>
 #include <OpenSolid/Core/ParametricExpression.definitions.hpp>
+#include <OpenSolid/Core/ParametricExpression/BSplineExpression.hpp>
 #include <OpenSolid/Core/ParametricExpression/ConstantExpression.hpp>
+#include <OpenSolid/Core/ParametricExpression/PolynomialExpression.hpp>
 #include <OpenSolid/Core/ParametricExpression/IdentityExpression.hpp>
 #include <OpenSolid/Core/ParametricExpression/ParameterExpression.hpp>
 #include <OpenSolid/Core/Transformable.hpp>
@@ -258,5 +261,199 @@ namespace opensolid
             );
             return xImplementation->concatenated(yImplementation)->concatenated(z.implementation());
         }
+
+        inline
+        void
+        appendWeightedComponents(double value, double weight, std::vector<double>& results) {
+            results.push_back(weight * value);
+        }
+
+        template <class TValue>
+        inline
+        void
+        appendWeightedComponents(
+            const TValue& value,
+            double weight,
+            std::vector<double>& results
+        ) {
+            for (int index = 0; index < NumDimensions<TValue>::Value; ++index) {
+                results.push_back(weight * value.component(index));
+            }
+        }
+
+        // Control point data in the form used by BSplineExpression, with weighted coordinates
+        // followed by the weight for rational splines (if any weights are given)
+        template <class TValue>
+        std::vector<double>
+        splineControlPoints(
+            const std::vector<TValue>& controlPoints,
+            const std::vector<double>& weights
+        ) {
+            if (!weights.empty() && weights.size() != controlPoints.size()) {
+                throw Error(new PlaceholderError());
+            }
+            std::vector<double> results;
+            for (std::size_t index = 0; index < controlPoints.size(); ++index) {
+                if (weights.empty()) {
+                    appendWeightedComponents(controlPoints[index], 1.0, results);
+                } else {
+                    appendWeightedComponents(controlPoints[index], weights[index], results);
+                    results.push_back(weights[index]);
+                }
+            }
+            return results;
+        }
+
+        template <class TValue>
+        ParametricExpression<TValue, double>
+        BSplineExpressionConstructors<TValue, double>::bspline(
+            int degree,
+            const std::vector<double>& knots,
+            const std::vector<TValue>& controlPoints
+        ) {
+            return ParametricExpression<TValue, double>(
+                std::make_shared<BSplineExpression>(
+                    int(NumDimensions<TValue>::Value),
+                    false,
+                    std::vector<int>(1, degree),
+                    std::vector<std::vector<double>>(1, knots),
+                    splineControlPoints(controlPoints, std::vector<double>())
+                )
+            );
+        }
+
+        template <class TValue>
+        ParametricExpression<TValue, double>
+        BSplineExpressionConstructors<TValue, double>::bspline(
+            int degree,
+            const std::vector<double>& knots,
+            const std::vector<TValue>& controlPoints,
+            const std::vector<double>& weights
+        ) {
+            if (weights.size() != controlPoints.size()) {
+                throw Error(new PlaceholderError());
+            }
+            return ParametricExpression<TValue, double>(
+                std::make_shared<BSplineExpression>(
+                    int(NumDimensions<TValue>::Value),
+                    true,
+                    std::vector<int>(1, degree),
+                    std::vector<std::vector<double>>(1, knots),
+                    splineControlPoints(controlPoints, weights)
+                )
+            );
+        }
+
+        template <class TValue>
+        ParametricExpression<TValue, Point<2>>
+        BSplineExpressionConstructors<TValue, Point<2>>::bspline(
+            int firstDegree,
+            int secondDegree,
+            const std::vector<double>& firstKnots,
+            const std::vector<double>& secondKnots,
+            const std::vector<std::vector<TValue>>& controlPoints
+        ) {
+            return bspline(
+                firstDegree,
+                secondDegree,
+                firstKnots,
+                secondKnots,
+                controlPoints,
+                std::vector<std::vector<double>>()
+            );
+        }
+
+        template <class TValue>
+        ParametricExpression<TValue, Point<2>>
+        BSplineExpressionConstructors<TValue, Point<2>>::bspline(
+            int firstDegree,
+            int secondDegree,
+            const std::vector<double>& firstKnots,
+            const std::vector<double>& secondKnots,
+            const std::vector<std::vector<TValue>>& controlPoints,
+            const std::vector<std::vector<double>>& weights
+        ) {
+            // An empty list of weights gives a non-rational surface
+            bool isRational = !weights.empty();
+            if (isRational && weights.size() != controlPoints.size()) {
+                throw Error(new PlaceholderError());
+            }
+            std::vector<double> flattenedControlPoints;
+            for (std::size_t index = 0; index < controlPoints.size(); ++index) {
+                if (controlPoints[index].size() != controlPoints.front().size()) {
+                    throw Error(new PlaceholderError());
+                }
+                std::vector<double> rowControlPoints = splineControlPoints(
+                    controlPoints[index],
+                    isRational ? weights[index] : std::vector<double>()
+                );
+                if (isRational && weights[index].empty()) {
+                    throw Error(new PlaceholderError());
+                }
+                flattenedControlPoints.insert(
+                    flattenedControlPoints.end(),
+                    rowControlPoints.begin(),
+                    rowControlPoints.end()
+                );
+            }
+            std::vector<int> degrees(2);
+            degrees[0] = firstDegree;
+            degrees[1] = secondDegree;
+            std::vector<std::vector<double>> knots(2);
+            knots[0] = firstKnots;
+            knots[1] = secondKnots;
+            return ParametricExpression<TValue, Point<2>>(
+                std::make_shared<BSplineExpression>(
+                    int(NumDimensions<TValue>::Value),
+                    isRational,
+                    degrees,
+                    knots,
+                    flattenedControlPoints
+                )
+            );
+        }
+
+        template <class TValue>
+        ParametricExpression<TValue, double>
+        PolynomialExpressionConstructors<TValue, double>::polynomial(
+            const std::vector<TValue>& coefficients
+        ) {
+            return ParametricExpression<TValue, double>(
+                std::make_shared<PolynomialExpression>(
+                    int(NumDimensions<TValue>::Value),
+                    std::vector<int>(1, int(coefficients.size()) - 1),
+                    splineControlPoints(coefficients, std::vector<double>())
+                )
+            );
+        }
+
+        template <class TValue>
+        ParametricExpression<TValue, Point<2>>
+        PolynomialExpressionConstructors<TValue, Point<2>>::polynomial(
+            const std::vector<std::vector<TValue>>& coefficients
+        ) {
+            if (coefficients.empty()) {
+                throw Error(new PlaceholderError());
+            }
+            std::vector<double> flattenedCoefficients;
+            for (const std::vector<TValue>& row : coefficients) {
+                if (row.size() != coefficients.front().size()) {
+                    throw Error(new PlaceholderError());
+                }
+                for (const TValue& coefficient : row) {
+                    appendWeightedComponents(coefficient, 1.0, flattenedCoefficients);
+                }
+            }
+            std::vector<int> degrees(2);
+            degrees[0] = int(coefficients.size()) - 1;
+            degrees[1] = int(coefficients.front().size()) - 1;
+            return ParametricExpression<TValue, Point<2>>(
+                std::make_shared<PolynomialExpression>(
+                    int(NumDimensions<TValue>::Value),
+                    degrees,
+                    flattenedCoefficients
+                )
+            );
+        }
     }
 }
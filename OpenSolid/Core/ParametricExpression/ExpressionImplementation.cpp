@@ -25,6 +25,7 @@
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
 
 #include <OpenSolid/Core/Error.hpp>
+#include <OpenSolid/Core/ExpressionInterning.hpp>
 #include <OpenSolid/Core/ParametricExpression/ArccosineExpression.hpp>
 #include <OpenSolid/Core/ParametricExpression/ArcsineExpression.hpp>
 #include <OpenSolid/Core/ParametricExpression/CompiledExpression.hpp>
@@ -55,95 +56,138 @@
 #include <OpenSolid/Core/ParametricExpression/TranslationExpression.hpp>
 #include <OpenSolid/Core/Vector.hpp>
 
+#include <functional>
+#include <mutex>
+#include <utility>
+
 namespace opensolid
 {
     namespace detail
     {
+        namespace
+        {
+            // Construct a new expression, but return an existing duplicate instead if global
+            // expression interning is enabled and one exists
+            template <class TExpression, class... TArguments>
+            ExpressionImplementationPtr
+            create(TArguments&&... arguments) {
+                return ExpressionInterning::intern(
+                    std::make_shared<TExpression>(std::forward<TArguments>(arguments)...)
+                );
+            }
+
+            // Derivative caches are protected by a fixed pool of mutexes shared between all
+            // expressions, rather than having a mutex per expression
+            std::mutex&
+            derivativesMutex(const ExpressionImplementation* expression) {
+                static const std::size_t NumMutexes = 64;
+                static std::mutex mutexes[NumMutexes];
+                std::size_t hash = std::hash<const ExpressionImplementation*>()(expression);
+                return mutexes[hash % NumMutexes];
+            }
+        }
+
+        void
+        ExpressionImplementation::contractImpl(
+            const std::vector<Interval>& bounds,
+            Contractor& contractor
+        ) const {
+        }
+
         ExpressionImplementationPtr
         ExpressionImplementation::composedImpl(
             const ExpressionImplementationPtr& innerExpression
         ) const {
-            return std::make_shared<CompositionExpression>(self(), innerExpression);
+            return create<CompositionExpression>(self(), innerExpression);
         }
         
         ExpressionImplementationPtr
         ExpressionImplementation::componentsImpl(int startIndex, int numComponents) const {
-            return std::make_shared<ComponentsExpression>(self(), startIndex, numComponents);
+            return create<ComponentsExpression>(self(), startIndex, numComponents);
         }
             
         ExpressionImplementationPtr
         ExpressionImplementation::scalingImpl(double scale) const {
-            return std::make_shared<ScalingExpression>(scale, self());
+            return create<ScalingExpression>(scale, self());
         }
             
         ExpressionImplementationPtr
         ExpressionImplementation::translationImpl(const ColumnMatrixXd& columnMatrix) const {
-            return std::make_shared<TranslationExpression>(self(), columnMatrix);
+            return create<TranslationExpression>(self(), columnMatrix);
         }
             
         ExpressionImplementationPtr
         ExpressionImplementation::transformationImpl(const MatrixXd& matrix) const {
-            return std::make_shared<TransformationExpression>(matrix, self());
+            return create<TransformationExpression>(matrix, self());
         }
         
         ExpressionImplementationPtr
         ExpressionImplementation::normImpl() const {
-            return std::make_shared<NormExpression>(self());
+            return create<NormExpression>(self());
         }
         
         ExpressionImplementationPtr
         ExpressionImplementation::normalizedImpl() const {
-            return std::make_shared<NormalizedExpression>(self());
+            return create<NormalizedExpression>(self());
         }
         
         ExpressionImplementationPtr
         ExpressionImplementation::squaredNormImpl() const {
-            return std::make_shared<SquaredNormExpression>(self());
+            return create<SquaredNormExpression>(self());
         }
 
         ExpressionImplementationPtr
         ExpressionImplementation::negatedImpl() const {
-            return std::make_shared<NegatedExpression>(self());
+            return create<NegatedExpression>(self());
         }
 
         ExpressionImplementationPtr
         ExpressionImplementation::sqrtImpl() const {
-            return std::make_shared<SquareRootExpression>(self());
+            return create<SquareRootExpression>(self());
         }
 
         ExpressionImplementationPtr
         ExpressionImplementation::sinImpl() const {
-            return std::make_shared<SineExpression>(self());
+            return create<SineExpression>(self());
         }
 
         ExpressionImplementationPtr
         ExpressionImplementation::cosImpl() const {
-            return std::make_shared<CosineExpression>(self());
+            return create<CosineExpression>(self());
         }
 
         ExpressionImplementationPtr
         ExpressionImplementation::tanImpl() const {
-            return std::make_shared<TangentExpression>(self());
+            return create<TangentExpression>(self());
         }
 
         ExpressionImplementationPtr
         ExpressionImplementation::acosImpl() const {
-            return std::make_shared<ArccosineExpression>(self());
+            return create<ArccosineExpression>(self());
         }
 
         ExpressionImplementationPtr
         ExpressionImplementation::asinImpl() const {
-            return std::make_shared<ArcsineExpression>(self());
+            return create<ArcsineExpression>(self());
         }
 
         ExpressionImplementationPtr
         ExpressionImplementation::expImpl() const {
-            return std::make_shared<ExponentialExpression>(self());
+            return create<ExponentialExpression>(self());
         }
 
         ExpressionImplementationPtr
         ExpressionImplementation::logImpl() const {
-            return std::make_shared<LogarithmExpression>(self());
+            return create<LogarithmExpression>(self());
+        }
+
+        std::size_t
+        ExpressionImplementation::structuralHashImpl() const {
+            return 0;
+        }
+
+        ExpressionImplementation::ExpressionImplementation() :
+            _structuralHash(0) {
         }
 
         ExpressionImplementation::~ExpressionImplementation() {
@@ -154,7 +198,29 @@ namespace opensolid
             if (parameterIndex < 0 || parameterIndex >= numParameters()) {
                 throw Error(new PlaceholderError());
             }
-            return derivativeImpl(parameterIndex);
+            {
+                std::lock_guard<std::mutex> lock(derivativesMutex(this));
+                if (_derivatives.empty()) {
+                    _derivatives.resize(numParameters());
+                }
+                ExpressionImplementationPtr cachedPtr = _derivatives[parameterIndex].lock();
+                if (cachedPtr) {
+                    return cachedPtr;
+                }
+            }
+
+            // Compute the derivative without holding the lock, since doing so will in general
+            // recursively compute derivatives of other expressions
+            ExpressionImplementationPtr derivativePtr = derivativeImpl(parameterIndex);
+
+            std::lock_guard<std::mutex> lock(derivativesMutex(this));
+            ExpressionImplementationPtr cachedPtr = _derivatives[parameterIndex].lock();
+            if (cachedPtr) {
+                // Another thread computed the same derivative concurrently
+                return cachedPtr;
+            }
+            _derivatives[parameterIndex] = derivativePtr;
+            return derivativePtr;
         }
 
         bool
@@ -162,6 +228,9 @@ namespace opensolid
             if (this == other.get()) {
                 return true;
             }
+            if (this->structuralHash() != other->structuralHash()) {
+                return false;
+            }
             if (typeid(*this) != typeid(*other)) {
                 return false;
             }
@@ -174,22 +243,39 @@ namespace opensolid
             return this->isDuplicateOfImpl(other);
         }
         
+        std::size_t
+        ExpressionImplementation::structuralHash() const {
+            std::size_t result = _structuralHash.load(std::memory_order_relaxed);
+            if (result == 0) {
+                // Computing the hash is idempotent, so concurrent callers may safely race here
+                result = typeid(*this).hash_code();
+                result = combineHashes(result, std::size_t(numDimensions()));
+                result = combineHashes(result, std::size_t(numParameters()));
+                result = combineHashes(result, structuralHashImpl());
+                if (result == 0) {
+                    result = 1;
+                }
+                _structuralHash.store(result, std::memory_order_relaxed);
+            }
+            return result;
+        }
+
         ExpressionImplementationPtr
         ExpressionImplementation::deduplicated(DeduplicationCache& deduplicationCache) const {
             // Try to find a function implementation in the cache that this is a duplicate of
+            // (only those with the same structural hash can possibly be duplicates)
+            auto range = deduplicationCache.equalRange(structuralHash());
             auto iterator = std::find_if(
-                deduplicationCache.begin(),
-                deduplicationCache.end(),
-                [this] (
-                    const ExpressionImplementationPtr& cachedExpressionImplementation
-                ) -> bool {
-                    return this->isDuplicateOf(cachedExpressionImplementation);
+                range.first,
+                range.second,
+                [this] (const DeduplicationCache::Entry& entry) -> bool {
+                    return this->isDuplicateOf(entry.second);
                 }
             );
 
             // Return the cached duplicate if one was found
-            if (iterator != deduplicationCache.end()) {
-                return *iterator;
+            if (iterator != range.second) {
+                return iterator->second;
             }
 
             // No matching function implementation was found: add a deduplicated copy of this
@@ -275,7 +361,7 @@ namespace opensolid
                     other->cast<ConstantExpression>()->columnMatrix();
                 return std::make_shared<ConstantExpression>(columnMatrix, numParameters());
             }
-            return std::make_shared<ConcatenationExpression>(self(), other);
+            return create<ConcatenationExpression>(self(), other);
         }
         
         ExpressionImplementationPtr
@@ -320,7 +406,7 @@ namespace opensolid
             if (other->isConstantExpression() && other->cast<ConstantExpression>()->isZero()) {
                 return std::make_shared<ConstantExpression>(0.0, numParameters());
             }
-            return std::make_shared<DotProductExpression>(self(), other);
+            return create<DotProductExpression>(self(), other);
         }
 
         ExpressionImplementationPtr
@@ -351,7 +437,7 @@ namespace opensolid
                     numParameters()
                 );
             }
-            return std::make_shared<CrossProductExpression>(self(), other);
+            return create<CrossProductExpression>(self(), other);
         }
 
         void
@@ -386,7 +472,7 @@ namespace opensolid
             if (firstOperand->isConstantExpression()) {
                 return secondOperand + firstOperand->cast<ConstantExpression>()->columnMatrix();
             }
-            return std::make_shared<SumExpression>(firstOperand, secondOperand);
+            return create<SumExpression>(firstOperand, secondOperand);
         }
 
         ExpressionImplementationPtr
@@ -442,7 +528,7 @@ namespace opensolid
                     firstOperand->cast<ConstantExpression>()->columnMatrix();
                 return (-secondOperand) + firstColumnMatrix;
             } else {
-                return std::make_shared<DifferenceExpression>(firstOperand, secondOperand);
+                return create<DifferenceExpression>(firstOperand, secondOperand);
             }
         }
 
@@ -521,7 +607,7 @@ namespace opensolid
                     return multiplicand;
                 }
             }
-            return std::make_shared<ProductExpression>(multiplier, multiplicand);
+            return create<ProductExpression>(multiplier, multiplicand);
         }
 
         ExpressionImplementationPtr
@@ -607,7 +693,7 @@ namespace opensolid
                     return firstOperand;
                 }
             }
-            return std::make_shared<QuotientExpression>(firstOperand, secondOperand);
+            return create<QuotientExpression>(firstOperand, secondOperand);
         }
 
         ExpressionImplementationPtr
@@ -736,7 +822,7 @@ namespace opensolid
                     base->numParameters()
                 );
             }
-            return std::make_shared<PowerExpression>(base, exponent);
+            return create<PowerExpression>(base, exponent);
         }
     }
 }
@@ -31,12 +31,14 @@
 #include <OpenSolid/Core/Interval.definitions.hpp>
 #include <OpenSolid/Core/Matrix.definitions.hpp>
 #include <OpenSolid/Core/MatrixView.definitions.hpp>
+#include <OpenSolid/Core/ParametricExpression/Bytecode/Compiler.declarations.hpp>
+#include <OpenSolid/Core/ParametricExpression/Contractor.declarations.hpp>
 #include <OpenSolid/Core/ParametricExpression/DeduplicationCache.declarations.hpp>
-#include <OpenSolid/Core/ParametricExpression/ExpressionCompiler.declarations.hpp>
-#include <OpenSolid/Core/ParametricExpression/MatrixID.declarations.hpp>
 
-#include <vector>
+#include <atomic>
+#include <cstddef>
 #include <memory>
+#include <vector>
 
 namespace opensolid
 {
@@ -46,6 +48,15 @@ namespace opensolid
             public std::enable_shared_from_this<ExpressionImplementation>
         {
         private:
+            // Cached result of structuralHash(), or zero if not yet computed
+            mutable std::atomic<std::size_t> _structuralHash;
+
+            // Previously computed derivatives, indexed by parameter index. These are held weakly
+            // since derivatives commonly refer back to the original expression (the derivative
+            // of exp(x) is exp(x) * x', for instance); they remain shared for as long as anything
+            // else uses them.
+            mutable std::vector<std::weak_ptr<const ExpressionImplementation>> _derivatives;
+
             OPENSOLID_CORE_EXPORT
             virtual int
             numDimensionsImpl() const = 0;
@@ -55,36 +66,21 @@ namespace opensolid
             numParametersImpl() const = 0;
 
             OPENSOLID_CORE_EXPORT
-            virtual void
-            evaluateImpl(
-                const MatrixID<const double>& parameterID,
-                const MatrixID<double>& resultView,
-                ExpressionCompiler<double>& expressionCompiler
-            ) const = 0;
-            
-            OPENSOLID_CORE_EXPORT
-            virtual void
-            evaluateImpl(
-                const MatrixID<const Interval>& parameterID,
-                const MatrixID<Interval>& resultView,
-                ExpressionCompiler<Interval>& expressionCompiler
-            ) const = 0;
+            virtual std::vector<int>
+            compileImpl(const std::vector<int>& parameterRegisters, Compiler& compiler) const = 0;
 
+            // Compute bounds on the value of this expression from the bounds of its operands,
+            // obtained using contractor.bounds()
             OPENSOLID_CORE_EXPORT
-            virtual void
-            evaluateJacobianImpl(
-                const MatrixID<const double>& parameterID,
-                const MatrixID<double>& resultView,
-                ExpressionCompiler<double>& expressionCompiler
-            ) const = 0;
-            
+            virtual std::vector<Interval>
+            boundsImpl(Contractor& contractor) const = 0;
+
+            // Narrow the bounds of the operands of this expression (using contractor.narrow())
+            // given the (already narrowed) bounds of this expression; the default
+            // implementation does nothing, which is always valid but gives no narrowing
             OPENSOLID_CORE_EXPORT
             virtual void
-            evaluateJacobianImpl(
-                const MatrixID<const Interval>& parameterID,
-                const MatrixID<Interval>& resultView,
-                ExpressionCompiler<Interval>& expressionCompiler
-            ) const = 0;
+            contractImpl(const std::vector<Interval>& bounds, Contractor& contractor) const;
 
             OPENSOLID_CORE_EXPORT
             virtual ExpressionImplementationPtr
@@ -93,6 +89,14 @@ namespace opensolid
             OPENSOLID_CORE_EXPORT
             virtual bool
             isDuplicateOfImpl(const ExpressionImplementationPtr& other) const = 0;
+
+            // Hash of any data (beyond type, dimensions and number of parameters) checked by
+            // isDuplicateOfImpl(); must return equal values for any two expressions that are
+            // duplicates of each other. Numeric data (constant values, scale factors, matrices)
+            // is compared exactly so that it can be hashed.
+            OPENSOLID_CORE_EXPORT
+            virtual std::size_t
+            structuralHashImpl() const;
             
             OPENSOLID_CORE_EXPORT
             virtual ExpressionImplementationPtr
@@ -183,8 +187,19 @@ namespace opensolid
             friend OPENSOLID_CORE_EXPORT ExpressionImplementationPtr exp(const ExpressionImplementationPtr&);
             friend OPENSOLID_CORE_EXPORT ExpressionImplementationPtr log(const ExpressionImplementationPtr&);
         protected:
+            OPENSOLID_CORE_EXPORT
+            ExpressionImplementation();
+
             ExpressionImplementationPtr
             self() const;
+
+            static std::size_t
+            combineHashes(std::size_t seed, std::size_t value);
+
+            // Hash of a value compared exactly by isDuplicateOfImpl() (negative zero hashes the
+            // same as positive zero, since the two compare equal)
+            static std::size_t
+            hashValue(double value);
         public:
             OPENSOLID_CORE_EXPORT
             virtual
@@ -212,41 +227,31 @@ namespace opensolid
             int
             numParameters() const;
             
-            void
-            evaluate(
-                const MatrixID<const double>& parameterID,
-                const MatrixID<double>& resultID,
-                ExpressionCompiler<double>& expressionCompiler
-            ) const;
-            
-            void
-            evaluate(
-                const MatrixID<const Interval>& parameterID,
-                const MatrixID<Interval>& resultID,
-                ExpressionCompiler<Interval>& expressionCompiler
-            ) const;
-            
-            void
-            evaluateJacobian(
-                const MatrixID<const double>& parameterID,
-                const MatrixID<double>& resultID,
-                ExpressionCompiler<double>& expressionCompiler
-            ) const;
+            std::vector<int>
+            compile(const std::vector<int>& parameterRegisters, Compiler& compiler) const;
+
+            std::vector<Interval>
+            bounds(Contractor& contractor) const;
 
             void
-            evaluateJacobian(
-                const MatrixID<const Interval>& parameterID,
-                const MatrixID<Interval>& resultID,
-                ExpressionCompiler<Interval>& expressionCompiler
-            ) const;
+            contract(const std::vector<Interval>& bounds, Contractor& contractor) const;
             
             OPENSOLID_CORE_EXPORT
             ExpressionImplementationPtr
             derivative(int parameterIndex = 0) const;
 
+            // True if the given expression is this expression or is structurally identical to
+            // it (same types of nodes, with duplicate operands and exactly equal numeric data),
+            // so that one can be substituted for the other without changing any results
             OPENSOLID_CORE_EXPORT
             bool
             isDuplicateOf(const ExpressionImplementationPtr& other) const;
+
+            // Hash of the structure of this expression, equal for any two expressions that are
+            // duplicates of each other
+            OPENSOLID_CORE_EXPORT
+            std::size_t
+            structuralHash() const;
             
             OPENSOLID_CORE_EXPORT
             ExpressionImplementationPtr
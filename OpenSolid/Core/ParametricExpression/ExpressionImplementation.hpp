@@ -30,13 +30,14 @@
 
 #include <OpenSolid/Core/Interval.hpp>
 #include <OpenSolid/Core/MatrixView.hpp>
+#include <OpenSolid/Core/ParametricExpression/Bytecode/Compiler.hpp>
 #include <OpenSolid/Core/ParametricExpression/ComponentsExpression.hpp>
 #include <OpenSolid/Core/ParametricExpression/ConstantExpression.hpp>
-#include <OpenSolid/Core/ParametricExpression/ExpressionCompiler.hpp>
 #include <OpenSolid/Core/ParametricExpression/IdentityExpression.hpp>
-#include <OpenSolid/Core/ParametricExpression/MatrixID.hpp>
 #include <OpenSolid/Core/ParametricExpression/ParameterExpression.hpp>
 
+#include <functional>
+
 namespace opensolid
 {
     namespace detail
@@ -47,6 +48,18 @@ namespace opensolid
             return shared_from_this();
         }
 
+        inline
+        std::size_t
+        ExpressionImplementation::combineHashes(std::size_t seed, std::size_t value) {
+            return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+        }
+
+        inline
+        std::size_t
+        ExpressionImplementation::hashValue(double value) {
+            return std::hash<double>()(value == 0.0 ? 0.0 : value);
+        }
+
         inline
         bool
         ExpressionImplementation::isConstantExpression() const {
@@ -92,43 +105,27 @@ namespace opensolid
         }
         
         inline
-        void
-        ExpressionImplementation::evaluate(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
+        std::vector<int>
+        ExpressionImplementation::compile(
+            const std::vector<int>& parameterRegisters,
+            Compiler& compiler
         ) const {
-            evaluateImpl(parameterID, resultID, expressionCompiler);
+            return compileImpl(parameterRegisters, compiler);
         }
-        
-        inline
-        void
-        ExpressionImplementation::evaluate(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
-        ) const {
-            evaluateImpl(parameterID, resultID, expressionCompiler);
-        }
-        
+
         inline
-        void
-        ExpressionImplementation::evaluateJacobian(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            evaluateJacobianImpl(parameterID, resultID, expressionCompiler);
+        std::vector<Interval>
+        ExpressionImplementation::bounds(Contractor& contractor) const {
+            return boundsImpl(contractor);
         }
 
         inline
         void
-        ExpressionImplementation::evaluateJacobian(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        ExpressionImplementation::contract(
+            const std::vector<Interval>& bounds,
+            Contractor& contractor
         ) const {
-            evaluateJacobianImpl(parameterID, resultID, expressionCompiler);
+            contractImpl(bounds, contractor);
         }
     }
 }
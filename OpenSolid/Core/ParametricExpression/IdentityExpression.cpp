@@ -24,6 +24,7 @@
 
 #include <OpenSolid/Core/ParametricExpression/IdentityExpression.hpp>
 
+#include <OpenSolid/Core/ParametricExpression/Contractor.hpp>
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
 
 namespace opensolid
@@ -40,62 +41,27 @@ namespace opensolid
             return _numDimensions;
         }
         
-        void
-        IdentityExpression::evaluateImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            expressionCompiler.compute(
-                parameterID,
-                resultID,
-                [] (ConstMatrixViewXd parameterValues, MatrixViewXd results) {
-                    results = parameterValues;
-                }
-            );
-        }
-        
-        void
-        IdentityExpression::evaluateImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        std::vector<int>
+        IdentityExpression::compileImpl(
+            const std::vector<int>& parameterRegisters,
+            Compiler& compiler
         ) const {
-            expressionCompiler.compute(
-                parameterID,
-                resultID,
-                [] (ConstIntervalMatrixViewXd parameterValues, IntervalMatrixViewXd results) {
-                    results = parameterValues;
-                }
-            );
+            return parameterRegisters;
         }
 
-        void
-        IdentityExpression::evaluateJacobianImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            expressionCompiler.compute(
-                resultID,
-                [] (MatrixViewXd results) {
-                    results.setIdentity();
-                }
-            );
+        std::vector<Interval>
+        IdentityExpression::boundsImpl(Contractor& contractor) const {
+            return contractor.parameterBounds();
         }
-        
+
         void
-        IdentityExpression::evaluateJacobianImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        IdentityExpression::contractImpl(
+            const std::vector<Interval>& bounds,
+            Contractor& contractor
         ) const {
-            expressionCompiler.compute(
-                resultID,
-                [] (IntervalMatrixViewXd results) {
-                    results.setIdentity();
-                }
-            );
+            for (int index = 0; index < numDimensions(); ++index) {
+                contractor.narrowParameter(index, bounds[index]);
+            }
         }
 
         ExpressionImplementationPtr
@@ -25,6 +25,7 @@
 #include <OpenSolid/Core/ParametricExpression/LogarithmExpression.hpp>
 
 #include <OpenSolid/Core/Error.hpp>
+#include <OpenSolid/Core/ParametricExpression/Contractor.hpp>
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
 
 namespace opensolid
@@ -41,84 +42,27 @@ namespace opensolid
             return duplicateOperands(other);
         }
             
-        void
-        LogarithmExpression::evaluateImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
+        std::vector<int>
+        LogarithmExpression::compileImpl(
+            const std::vector<int>& parameterRegisters,
+            Compiler& compiler
         ) const {
-            expressionCompiler.evaluate(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                resultID,
-                [] (MatrixViewXd results) {
-                    results.setMap(
-                        results,
-                        [] (double value) {
-                            return opensolid::log(value);
-                        }
-                    );
-                }
-            );
+            int operandRegister = compiler.evaluate(operand(), parameterRegisters).front();
+            return std::vector<int>(1, compiler.compute(Bytecode::LOG, operandRegister));
         }
 
-        void
-        LogarithmExpression::evaluateImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
-        ) const {
-            expressionCompiler.evaluate(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                resultID,
-                [] (IntervalMatrixViewXd results) {
-                    results.setMap(
-                        results,
-                        [] (Interval value) {
-                            return opensolid::log(value);
-                        }
-                    );
-                }
-            );
+        std::vector<Interval>
+        LogarithmExpression::boundsImpl(Contractor& contractor) const {
+            const std::vector<Interval>& operandBounds = contractor.bounds(operand());
+            return std::vector<Interval>(1, opensolid::log(operandBounds.front()));
         }
 
         void
-        LogarithmExpression::evaluateJacobianImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            expressionCompiler.evaluateJacobian(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(operand(), parameterID),
-                resultID,
-                [] (ConstMatrixViewXd operandValues, MatrixViewXd results) {
-                    double operandValue = operandValues.value();
-                    if (operandValue <= Zero()) {
-                        throw Error(new PlaceholderError());
-                    }
-                    results /= operandValue;
-                }
-            );
-        }
-        
-        void
-        LogarithmExpression::evaluateJacobianImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        LogarithmExpression::contractImpl(
+            const std::vector<Interval>& bounds,
+            Contractor& contractor
         ) const {
-            expressionCompiler.evaluateJacobian(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(operand(), parameterID),
-                resultID,
-                [] (ConstIntervalMatrixViewXd operandValues, IntervalMatrixViewXd results) {
-                    Interval operandValue = operandValues.value();
-                    if (operandValue.upperBound() <= Zero()) {
-                        throw Error(new PlaceholderError());
-                    }
-                    results /= operandValue;
-                }
-            );
+            contractor.narrow(operand(), 0, opensolid::exp(bounds.front()));
         }
 
         ExpressionImplementationPtr
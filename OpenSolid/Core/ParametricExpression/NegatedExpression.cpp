@@ -24,6 +24,7 @@
 
 #include <OpenSolid/Core/ParametricExpression/NegatedExpression.hpp>
 
+#include <OpenSolid/Core/ParametricExpression/Contractor.hpp>
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
 
 namespace opensolid
@@ -35,64 +36,36 @@ namespace opensolid
             return operand()->numDimensions();
         }
 
-        void
-        NegatedExpression::evaluateImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
+        std::vector<int>
+        NegatedExpression::compileImpl(
+            const std::vector<int>& parameterRegisters,
+            Compiler& compiler
         ) const {
-            expressionCompiler.evaluate(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                resultID,
-                [] (MatrixViewXd results) {
-                    results *= -1.0;
-                }
-            );
+            std::vector<int> results = compiler.evaluate(operand(), parameterRegisters);
+            for (std::size_t index = 0; index < results.size(); ++index) {
+                results[index] = compiler.compute(Bytecode::NEGATE, results[index]);
+            }
+            return results;
         }
 
-        void
-        NegatedExpression::evaluateImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
-        ) const {
-            expressionCompiler.evaluate(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                resultID,
-                [] (IntervalMatrixViewXd results) {
-                    results *= -1.0;
-                }
-            );
+        std::vector<Interval>
+        NegatedExpression::boundsImpl(Contractor& contractor) const {
+            const std::vector<Interval>& operandBounds = contractor.bounds(operand());
+            std::vector<Interval> results(numDimensions());
+            for (int index = 0; index < numDimensions(); ++index) {
+                results[index] = -operandBounds[index];
+            }
+            return results;
         }
 
         void
-        NegatedExpression::evaluateJacobianImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            expressionCompiler.evaluateJacobian(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                resultID,
-                [] (MatrixViewXd results) {
-                    results *= -1.0;
-                }
-            );
-        }
-        
-        void
-        NegatedExpression::evaluateJacobianImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        NegatedExpression::contractImpl(
+            const std::vector<Interval>& bounds,
+            Contractor& contractor
         ) const {
-            expressionCompiler.evaluateJacobian(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                resultID,
-                [] (IntervalMatrixViewXd results) {
-                    results *= -1.0;
-                }
-            );
+            for (int index = 0; index < numDimensions(); ++index) {
+                contractor.narrow(operand(), index, -bounds[index]);
+            }
         }
 
         ExpressionImplementationPtr
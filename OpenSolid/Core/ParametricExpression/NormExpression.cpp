@@ -25,8 +25,11 @@
 #include <OpenSolid/Core/ParametricExpression/NormExpression.hpp>
 
 #include <OpenSolid/Core/Error.hpp>
+#include <OpenSolid/Core/ParametricExpression/Contractor.hpp>
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
 
+#include <limits>
+
 namespace opensolid
 {   
     namespace detail
@@ -41,108 +44,42 @@ namespace opensolid
             return duplicateOperands(other);
         }
         
-        void
-        NormExpression::evaluateImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(operand(), parameterID),
-                resultID,
-                [] (ConstMatrixViewXd operandValues, MatrixViewXd results) {
-                    for (int columnIndex = 0; columnIndex < results.numColumns(); ++columnIndex) {
-                        results(0, columnIndex) = opensolid::sqrt(
-                            operandValues.column(columnIndex).fold(
-                                0.0,
-                                [] (double result, double value) {
-                                    return result + value * value;
-                                }
-                            )
-                        );
-                    }
-                }
-            );
-        }
-        
-        void 
-        NormExpression::evaluateImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        std::vector<int>
+        NormExpression::compileImpl(
+            const std::vector<int>& parameterRegisters,
+            Compiler& compiler
         ) const {
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(operand(), parameterID),
-                resultID,
-                [] (ConstIntervalMatrixViewXd operandValues, IntervalMatrixViewXd results) {
-                    for (int columnIndex = 0; columnIndex < results.numColumns(); ++columnIndex) {
-                        results(0, columnIndex) = opensolid::sqrt(
-                            operandValues.column(columnIndex).fold(
-                                Interval(0.0),
-                                [] (Interval result, Interval value) {
-                                    return result + value * value;
-                                }
-                            )
-                        );
-                    }
-                }
-            );
+            std::vector<int> operandRegisters = compiler.evaluate(operand(), parameterRegisters);
+            int squaredNormRegister = compiler.compute(Bytecode::SQUARE, operandRegisters.front());
+            for (std::size_t index = 1; index < operandRegisters.size(); ++index) {
+                squaredNormRegister = compiler.compute(
+                    Bytecode::ADD,
+                    squaredNormRegister,
+                    compiler.compute(Bytecode::SQUARE, operandRegisters[index])
+                );
+            }
+            return std::vector<int>(1, compiler.compute(Bytecode::SQRT, squaredNormRegister));
         }
 
-        void
-        NormExpression::evaluateJacobianImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(operand(), parameterID),
-                expressionCompiler.createTemporary(operand()->numDimensions(), 1),
-                expressionCompiler.evaluateJacobian(operand(), parameterID),
-                resultID,
-                [] (
-                    ConstMatrixViewXd operandValues,
-                    MatrixViewXd operandNormalized,
-                    ConstMatrixViewXd operandJacobian,
-                    MatrixViewXd results
-                ) {
-                    double operandNorm = opensolid::sqrt(operandValues.cwiseSquared().sum());
-                    if (operandNorm == Zero()) {
-                        throw Error(new PlaceholderError());
-                    }
-                    operandNormalized = operandValues;
-                    operandNormalized /= operandNorm;
-                    results.setTransposeProduct(operandNormalized, operandJacobian);
-                }
-            );
+        std::vector<Interval>
+        NormExpression::boundsImpl(Contractor& contractor) const {
+            const std::vector<Interval>& operandBounds = contractor.bounds(operand());
+            Interval squaredNorm(0.0);
+            for (Interval componentBounds : operandBounds) {
+                squaredNorm += componentBounds.squared();
+            }
+            return std::vector<Interval>(1, opensolid::sqrt(squaredNorm));
         }
-        
+
         void
-        NormExpression::evaluateJacobianImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        NormExpression::contractImpl(
+            const std::vector<Interval>& bounds,
+            Contractor& contractor
         ) const {
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(operand(), parameterID),
-                expressionCompiler.createTemporary(operand()->numDimensions(), 1),
-                expressionCompiler.evaluateJacobian(operand(), parameterID),
-                resultID,
-                [] (
-                    ConstIntervalMatrixViewXd operandValues,
-                    IntervalMatrixViewXd operandNormalized,
-                    ConstIntervalMatrixViewXd operandJacobian,
-                    IntervalMatrixViewXd results
-                ) {
-                    Interval operandNorm = opensolid::sqrt(operandValues.cwiseSquared().sum());
-                    if (operandNorm == Zero()) {
-                        throw Error(new PlaceholderError());
-                    }
-                    operandNormalized = operandValues;
-                    operandNormalized /= operandNorm;
-                    results.setTransposeProduct(operandNormalized, operandJacobian);
-                }
+            Interval nonNegative = bounds.front().intersection(
+                Interval(0.0, std::numeric_limits<double>::infinity())
             );
+            contractor.narrowSquaredNorm(operand(), Contractor::widened(nonNegative.squared()));
         }
 
         ExpressionImplementationPtr
@@ -25,6 +25,7 @@
 #include <OpenSolid/Core/ParametricExpression/NormalizedExpression.hpp>
 
 #include <OpenSolid/Core/Error.hpp>
+#include <OpenSolid/Core/ParametricExpression/Contractor.hpp>
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
 
 namespace opensolid
@@ -41,130 +42,46 @@ namespace opensolid
             return duplicateOperands(other);
         }
 
-        void
-        NormalizedExpression::evaluateImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            expressionCompiler.evaluate(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                resultID,
-                [] (MatrixViewXd results) {
-                    for (int columnIndex = 0; columnIndex < results.numColumns(); ++columnIndex) {
-                        auto column = results.column(columnIndex);
-                        double norm = opensolid::sqrt(
-                            column.fold(
-                                0.0,
-                                [] (double result, double value) {
-                                    return result + value * value;
-                                }
-                            )
-                        );
-                        if (norm == Zero()) {
-                            throw PlaceholderError();
-                        }
-                        column /= norm;
-                    }
-                }
-            );
-        }
-
-        void
-        NormalizedExpression::evaluateImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        std::vector<int>
+        NormalizedExpression::compileImpl(
+            const std::vector<int>& parameterRegisters,
+            Compiler& compiler
         ) const {
-            expressionCompiler.evaluate(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                resultID,
-                [] (IntervalMatrixViewXd results) {
-                    for (int columnIndex = 0; columnIndex < results.numColumns(); ++columnIndex) {
-                        auto column = results.column(columnIndex);
-                        Interval norm = opensolid::sqrt(
-                            column.fold(
-                                Interval(0.0),
-                                [] (Interval result, Interval value) {
-                                    return result + value * value;
-                                }
-                            )
-                        );
-                        if (norm == Zero()) {
-                            throw PlaceholderError();
-                        }
-                        column /= norm;
-                    }
-                }
-            );
+            std::vector<int> operandRegisters = compiler.evaluate(operand(), parameterRegisters);
+            int squaredNormRegister = compiler.compute(Bytecode::SQUARE, operandRegisters.front());
+            for (std::size_t index = 1; index < operandRegisters.size(); ++index) {
+                squaredNormRegister = compiler.compute(
+                    Bytecode::ADD,
+                    squaredNormRegister,
+                    compiler.compute(Bytecode::SQUARE, operandRegisters[index])
+                );
+            }
+            int normRegister = compiler.compute(Bytecode::SQRT, squaredNormRegister);
+            compiler.checkNonZero(normRegister);
+            std::vector<int> results(operandRegisters.size());
+            for (std::size_t index = 0; index < operandRegisters.size(); ++index) {
+                results[index] = compiler.compute(
+                    Bytecode::DIVIDE,
+                    operandRegisters[index],
+                    normRegister
+                );
+            }
+            return results;
         }
 
-        void
-        NormalizedExpression::evaluateJacobianImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            expressionCompiler.evaluateJacobian(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(operand(), parameterID),
-                expressionCompiler.createTemporary(numDimensions(), 1),
-                expressionCompiler.createTemporary(1, numParameters()),
-                expressionCompiler.createTemporary(numDimensions(), numParameters()),
-                resultID,
-                [] (
-                    ConstMatrixViewXd operandValues,
-                    MatrixViewXd operandNormalized,
-                    MatrixViewXd transposeProduct,
-                    MatrixViewXd outerProduct,
-                    MatrixViewXd results
-                ) {
-                    double operandNorm = opensolid::sqrt(operandValues.cwiseSquared().sum());
-                    if (operandNorm == Zero()) {
-                        throw Error(new PlaceholderError());
-                    }
-                    operandNormalized = operandValues;
-                    operandNormalized /= operandNorm;
-                    transposeProduct.setTransposeProduct(operandNormalized, results);
-                    outerProduct.setProduct(operandNormalized, transposeProduct);
-                    results -= outerProduct;
-                    results /= operandNorm;
-                }
-            );
-        }
-        
-        void
-        NormalizedExpression::evaluateJacobianImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
-        ) const {
-            expressionCompiler.evaluateJacobian(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(operand(), parameterID),
-                expressionCompiler.createTemporary(numDimensions(), 1),
-                expressionCompiler.createTemporary(1, numParameters()),
-                expressionCompiler.createTemporary(numDimensions(), numParameters()),
-                resultID,
-                [] (
-                    ConstIntervalMatrixViewXd operandValues,
-                    IntervalMatrixViewXd operandNormalized,
-                    IntervalMatrixViewXd transposeProduct,
-                    IntervalMatrixViewXd outerProduct,
-                    IntervalMatrixViewXd results
-                ) {
-                    Interval operandNorm = opensolid::sqrt(operandValues.cwiseSquared().sum());
-                    if (operandNorm == Zero()) {
-                        throw Error(new PlaceholderError());
-                    }
-                    operandNormalized = operandValues;
-                    operandNormalized /= operandNorm;
-                    transposeProduct.setTransposeProduct(operandNormalized, results);
-                    outerProduct.setProduct(operandNormalized, transposeProduct);
-                    results -= outerProduct;
-                    results /= operandNorm;
-                }
-            );
+        std::vector<Interval>
+        NormalizedExpression::boundsImpl(Contractor& contractor) const {
+            const std::vector<Interval>& operandBounds = contractor.bounds(operand());
+            Interval squaredNorm(0.0);
+            for (Interval componentBounds : operandBounds) {
+                squaredNorm += componentBounds.squared();
+            }
+            Interval norm = opensolid::sqrt(squaredNorm);
+            std::vector<Interval> results(numDimensions());
+            for (int index = 0; index < numDimensions(); ++index) {
+                results[index] = (operandBounds[index] / norm).intersection(Interval(-1, 1));
+            }
+            return results;
         }
 
         ExpressionImplementationPtr
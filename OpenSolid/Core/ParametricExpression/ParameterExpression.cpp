@@ -24,6 +24,7 @@
 
 #include <OpenSolid/Core/ParametricExpression/ParameterExpression.hpp>
 
+#include <OpenSolid/Core/ParametricExpression/Contractor.hpp>
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
 
 namespace opensolid
@@ -40,74 +41,25 @@ namespace opensolid
             return _numParameters;
         }
         
-        void
-        ParameterExpression::evaluateImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            int parameterIndex = this->parameterIndex();
-            expressionCompiler.compute(
-                parameterID,
-                resultID,
-                [parameterIndex] (
-                    ConstMatrixViewXd parameterValues,
-                    MatrixViewXd results
-                ) {
-                    results = parameterValues.row(parameterIndex);
-                }
-            );
-        }
-        
-        void
-        ParameterExpression::evaluateImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        std::vector<int>
+        ParameterExpression::compileImpl(
+            const std::vector<int>& parameterRegisters,
+            Compiler& compiler
         ) const {
-            int parameterIndex = this->parameterIndex();
-            expressionCompiler.compute(
-                parameterID,
-                resultID,
-                [parameterIndex] (
-                    ConstIntervalMatrixViewXd parameterValues,
-                    IntervalMatrixViewXd results
-                ) {
-                    results = parameterValues.row(parameterIndex);
-                }
-            );
+            return std::vector<int>(1, parameterRegisters[parameterIndex()]);
         }
 
-        void
-        ParameterExpression::evaluateJacobianImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            int parameterIndex = this->parameterIndex();
-            expressionCompiler.compute(
-                resultID,
-                [parameterIndex] (MatrixViewXd results) {
-                    results.setZero();
-                    results(0, parameterIndex) = 1.0;
-                }
-            );
+        std::vector<Interval>
+        ParameterExpression::boundsImpl(Contractor& contractor) const {
+            return std::vector<Interval>(1, contractor.parameterBounds()[parameterIndex()]);
         }
-        
+
         void
-        ParameterExpression::evaluateJacobianImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        ParameterExpression::contractImpl(
+            const std::vector<Interval>& bounds,
+            Contractor& contractor
         ) const {
-            int parameterIndex = this->parameterIndex();
-            expressionCompiler.compute(
-                resultID,
-                [parameterIndex] (IntervalMatrixViewXd results) {
-                    results.setZero();
-                    results(0, parameterIndex) = Interval(1.0);
-                }
-            );
+            contractor.narrowParameter(parameterIndex(), bounds.front());
         }
 
         ExpressionImplementationPtr
@@ -123,6 +75,11 @@ namespace opensolid
             return this->parameterIndex() == other->cast<ParameterExpression>()->parameterIndex();
         }
 
+        std::size_t
+        ParameterExpression::structuralHashImpl() const {
+            return std::size_t(parameterIndex());
+        }
+
         ExpressionImplementationPtr
         ParameterExpression::deduplicatedImpl(DeduplicationCache& deduplicationCache) const {
             return self();
@@ -0,0 +1,408 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#include <OpenSolid/Core/ParametricExpression/PolynomialExpression.hpp>
+
+#include <OpenSolid/Core/Error.hpp>
+#include <OpenSolid/Core/ParametricExpression/Contractor.hpp>
+#include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
+
+#include <cmath>
+#include <limits>
+
+namespace opensolid
+{
+    namespace
+    {
+        // Polynomials needing at most this many intermediate values are evaluated without heap
+        // allocation
+        const int LOCAL_BUFFER_SIZE = 256;
+
+        // One step of Horner's rule applied to degree + 1 consecutive blocks of the given
+        // length (the coefficients of each power of a single parameter). Results may be stored
+        // in place, over the first block.
+        template <class TSource, class TScalar>
+        inline
+        void
+        hornerStep(
+            const TSource* source,
+            int degree,
+            int length,
+            TScalar parameterValue,
+            TScalar* results
+        ) {
+            for (int offset = 0; offset < length; ++offset) {
+                TScalar value = TScalar(source[degree * length + offset]);
+                for (int power = degree - 1; power >= 0; --power) {
+                    value = value * parameterValue + source[power * length + offset];
+                }
+                results[offset] = value;
+            }
+        }
+
+        // Evaluate a polynomial by eliminating one parameter at a time, leaving the results at
+        // the start of values (which must have room for size / (degrees[0] + 1) values)
+        template <class TScalar>
+        void
+        horner(
+            const double* coefficients,
+            int size,
+            const std::vector<int>& degrees,
+            const TScalar* parameterValues,
+            TScalar* values
+        ) {
+            int length = size / (degrees[0] + 1);
+            hornerStep(coefficients, degrees[0], length, parameterValues[0], values);
+            for (std::size_t index = 1; index < degrees.size(); ++index) {
+                length /= degrees[index] + 1;
+                hornerStep(values, degrees[index], length, parameterValues[index], values);
+            }
+        }
+
+        // Re-expand the polynomial about the given value of one parameter, so that
+        // coefficients become those of powers of (parameter value - center)
+        void
+        shift(
+            std::vector<double>& coefficients,
+            int numDimensions,
+            const std::vector<int>& degrees,
+            int parameterIndex,
+            double center
+        ) {
+            int degree = degrees[parameterIndex];
+            int numRows = 1;
+            for (int index = 0; index < parameterIndex; ++index) {
+                numRows *= degrees[index] + 1;
+            }
+            int length = numDimensions;
+            for (std::size_t index = parameterIndex + 1; index < degrees.size(); ++index) {
+                length *= degrees[index] + 1;
+            }
+            for (int rowIndex = 0; rowIndex < numRows; ++rowIndex) {
+                double* row = coefficients.data() + rowIndex * (degree + 1) * length;
+                for (int offset = 0; offset < length; ++offset) {
+                    for (int start = 0; start < degree; ++start) {
+                        for (int power = degree - 1; power >= start; --power) {
+                            double higherCoefficient = row[(power + 1) * length + offset];
+                            row[power * length + offset] += center * higherCoefficient;
+                        }
+                    }
+                }
+            }
+        }
+
+        // Compile one step of Horner's rule, where operands holds the registers of degree + 1
+        // consecutive blocks of the given length (-1 for coefficients known to be zero)
+        std::vector<int>
+        compileHornerStep(
+            const std::vector<int>& operands,
+            int degree,
+            int length,
+            int parameterRegister,
+            detail::Compiler& compiler
+        ) {
+            std::vector<int> results(length);
+            for (int offset = 0; offset < length; ++offset) {
+                int result = operands[degree * length + offset];
+                for (int power = degree - 1; power >= 0; --power) {
+                    if (result >= 0) {
+                        result = compiler.compute(
+                            detail::Bytecode::MULTIPLY,
+                            result,
+                            parameterRegister
+                        );
+                    }
+                    int operand = operands[power * length + offset];
+                    if (operand >= 0 && result >= 0) {
+                        result = compiler.compute(detail::Bytecode::ADD, result, operand);
+                    } else if (operand >= 0) {
+                        result = operand;
+                    }
+                }
+                results[offset] = result;
+            }
+            return results;
+        }
+
+        bool
+        isBounded(Interval interval) {
+            return (
+                std::abs(interval.lowerBound()) < std::numeric_limits<double>::infinity() &&
+                std::abs(interval.upperBound()) < std::numeric_limits<double>::infinity()
+            );
+        }
+    }
+
+    namespace detail
+    {
+        int
+        PolynomialExpression::numDimensionsImpl() const {
+            return _numDimensions;
+        }
+
+        int
+        PolynomialExpression::numParametersImpl() const {
+            return int(_degrees.size());
+        }
+
+        std::vector<int>
+        PolynomialExpression::compileImpl(
+            const std::vector<int>& parameterRegisters,
+            Compiler& compiler
+        ) const {
+            // Zero coefficients are skipped, so sparse polynomials stay short
+            std::vector<int> operands(_coefficients.size());
+            for (std::size_t index = 0; index < _coefficients.size(); ++index) {
+                double coefficient = _coefficients[index];
+                operands[index] = coefficient == 0.0 ? -1 : compiler.constant(coefficient);
+            }
+            int length = int(_coefficients.size());
+            for (int parameterIndex = 0; parameterIndex < numParameters(); ++parameterIndex) {
+                int degree = _degrees[parameterIndex];
+                length /= degree + 1;
+                operands = compileHornerStep(
+                    operands,
+                    degree,
+                    length,
+                    parameterRegisters[parameterIndex],
+                    compiler
+                );
+            }
+            for (int index = 0; index < numDimensions(); ++index) {
+                if (operands[index] < 0) {
+                    operands[index] = compiler.constant(0.0);
+                }
+            }
+            return operands;
+        }
+
+        std::vector<Interval>
+        PolynomialExpression::boundsImpl(Contractor& contractor) const {
+            std::vector<Interval> results(numDimensions());
+            evaluate(contractor.parameterBounds().data(), results.data());
+            return results;
+        }
+
+        ExpressionImplementationPtr
+        PolynomialExpression::derivativeImpl(int parameterIndex) const {
+            int degree = _degrees[parameterIndex];
+            if (degree == 0) {
+                return std::make_shared<ConstantExpression>(
+                    ColumnMatrixXd::zero(numDimensions()),
+                    numParameters()
+                );
+            }
+            int numRows = 1;
+            for (int index = 0; index < parameterIndex; ++index) {
+                numRows *= _degrees[index] + 1;
+            }
+            int length = _numDimensions;
+            for (int index = parameterIndex + 1; index < numParameters(); ++index) {
+                length *= _degrees[index] + 1;
+            }
+
+            // The coefficient of each power k of the differentiated parameter becomes
+            // (k + 1) times the coefficient of power k + 1
+            std::vector<double> coefficients(numRows * degree * length);
+            for (int rowIndex = 0; rowIndex < numRows; ++rowIndex) {
+                const double* row = _coefficients.data() + rowIndex * (degree + 1) * length;
+                double* derivativeRow = coefficients.data() + rowIndex * degree * length;
+                for (int power = 0; power < degree; ++power) {
+                    for (int offset = 0; offset < length; ++offset) {
+                        double coefficient = row[(power + 1) * length + offset];
+                        derivativeRow[power * length + offset] = (power + 1) * coefficient;
+                    }
+                }
+            }
+            std::vector<int> degrees = _degrees;
+            degrees[parameterIndex] = degree - 1;
+            return std::make_shared<PolynomialExpression>(_numDimensions, degrees, coefficients);
+        }
+
+        bool
+        PolynomialExpression::isDuplicateOfImpl(const ExpressionImplementationPtr& other) const {
+            const PolynomialExpression* otherPolynomial = other->cast<PolynomialExpression>();
+            return (
+                this->numDimensions() == otherPolynomial->numDimensions() &&
+                this->degrees() == otherPolynomial->degrees() &&
+                this->coefficients() == otherPolynomial->coefficients()
+            );
+        }
+
+        std::size_t
+        PolynomialExpression::structuralHashImpl() const {
+            std::size_t result = std::size_t(_numDimensions);
+            for (int degree : _degrees) {
+                result = combineHashes(result, std::size_t(degree));
+            }
+            for (double coefficient : _coefficients) {
+                result = combineHashes(result, hashValue(coefficient));
+            }
+            return result;
+        }
+
+        ExpressionImplementationPtr
+        PolynomialExpression::deduplicatedImpl(DeduplicationCache& deduplicationCache) const {
+            return self();
+        }
+
+        ExpressionImplementationPtr
+        PolynomialExpression::scalingImpl(double scale) const {
+            std::vector<double> coefficients = _coefficients;
+            for (double& coefficient : coefficients) {
+                coefficient *= scale;
+            }
+            return std::make_shared<PolynomialExpression>(_numDimensions, _degrees, coefficients);
+        }
+
+        ExpressionImplementationPtr
+        PolynomialExpression::translationImpl(const ColumnMatrixXd& columnMatrix) const {
+            // Only the constant term (stored first) changes
+            std::vector<double> coefficients = _coefficients;
+            for (int index = 0; index < _numDimensions; ++index) {
+                coefficients[index] += columnMatrix(index);
+            }
+            return std::make_shared<PolynomialExpression>(_numDimensions, _degrees, coefficients);
+        }
+
+        ExpressionImplementationPtr
+        PolynomialExpression::transformationImpl(const MatrixXd& matrix) const {
+            int numTransformedDimensions = matrix.numRows();
+            int numTerms = int(_coefficients.size()) / _numDimensions;
+            std::vector<double> coefficients(numTerms * numTransformedDimensions);
+            for (int termIndex = 0; termIndex < numTerms; ++termIndex) {
+                const double* term = _coefficients.data() + termIndex * _numDimensions;
+                double* result = coefficients.data() + termIndex * numTransformedDimensions;
+                for (int rowIndex = 0; rowIndex < numTransformedDimensions; ++rowIndex) {
+                    double sum = 0.0;
+                    for (int index = 0; index < _numDimensions; ++index) {
+                        sum += matrix(rowIndex, index) * term[index];
+                    }
+                    result[rowIndex] = sum;
+                }
+            }
+            return std::make_shared<PolynomialExpression>(
+                numTransformedDimensions,
+                _degrees,
+                coefficients
+            );
+        }
+
+        void
+        PolynomialExpression::debugImpl(std::ostream& stream, int indent) const {
+            stream << "PolynomialExpression: degrees =";
+            for (int degree : _degrees) {
+                stream << " " << degree;
+            }
+            stream << std::endl;
+        }
+
+        PolynomialExpression::PolynomialExpression(
+            int numDimensions,
+            const std::vector<int>& degrees,
+            const std::vector<double>& coefficients
+        ) : _numDimensions(numDimensions),
+            _degrees(degrees),
+            _coefficients(coefficients) {
+
+            if (numDimensions < 1 || degrees.empty()) {
+                throw Error(new PlaceholderError());
+            }
+            std::size_t expectedSize = numDimensions;
+            for (int degree : degrees) {
+                if (degree < 0) {
+                    throw Error(new PlaceholderError());
+                }
+                expectedSize *= degree + 1;
+            }
+            if (coefficients.size() != expectedSize) {
+                throw Error(new PlaceholderError());
+            }
+        }
+
+        void
+        PolynomialExpression::evaluate(const double* parameterValues, double* results) const {
+            int size = int(_coefficients.size());
+            int workSize = size / (_degrees[0] + 1);
+            double localBuffer[LOCAL_BUFFER_SIZE];
+            std::vector<double> heapBuffer;
+            double* values = localBuffer;
+            if (workSize > LOCAL_BUFFER_SIZE) {
+                heapBuffer.resize(workSize);
+                values = heapBuffer.data();
+            }
+            horner(_coefficients.data(), size, _degrees, parameterValues, values);
+            std::copy(values, values + _numDimensions, results);
+        }
+
+        void
+        PolynomialExpression::evaluate(const Interval* parameterBounds, Interval* results) const {
+            bool isUnbounded = false;
+            for (int index = 0; index < numParameters(); ++index) {
+                if (parameterBounds[index].isEmpty()) {
+                    std::fill(results, results + _numDimensions, Interval::EMPTY());
+                    return;
+                }
+                if (_degrees[index] > 0 && !isBounded(parameterBounds[index])) {
+                    isUnbounded = true;
+                }
+            }
+            if (isUnbounded) {
+                std::fill(results, results + _numDimensions, Interval::WHOLE());
+                return;
+            }
+
+            int size = int(_coefficients.size());
+            int workSize = size / (_degrees[0] + 1);
+            std::vector<Interval> naturalBounds(workSize);
+            horner(_coefficients.data(), size, _degrees, parameterBounds, naturalBounds.data());
+
+            // In centered form every parameter offset is symmetric about zero, so each step of
+            // Horner's rule only widens the current bounds by the magnitude of the higher-order
+            // part instead of also shifting them
+            std::vector<double> shiftedCoefficients = _coefficients;
+            std::vector<Interval> offsets(numParameters());
+            for (int index = 0; index < numParameters(); ++index) {
+                double center = parameterBounds[index].median();
+                if (_degrees[index] > 0 && center != 0.0) {
+                    shift(shiftedCoefficients, _numDimensions, _degrees, index, center);
+                }
+                offsets[index] = parameterBounds[index] - center;
+            }
+            std::vector<Interval> centeredBounds(workSize);
+            horner(
+                shiftedCoefficients.data(),
+                size,
+                _degrees,
+                offsets.data(),
+                centeredBounds.data()
+            );
+
+            for (int index = 0; index < _numDimensions; ++index) {
+                Interval intersection = naturalBounds[index].intersection(centeredBounds[index]);
+                results[index] = intersection.isEmpty() ? centeredBounds[index] : intersection;
+            }
+        }
+    }
+}
@@ -0,0 +1,143 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#pragma once
+
+#include <OpenSolid/config.hpp>
+
+#include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.definitions.hpp>
+
+#include <vector>
+
+namespace opensolid
+{
+    namespace detail
+    {
+        // Dense polynomial in one or more parameters, evaluated in Horner form instead of being
+        // built up from powers, products and sums. Each parameter has its own degree, and there
+        // is one coefficient (of numDimensions consecutive values) for every combination of
+        // exponents up to those degrees, with the exponent of the last parameter varying fastest.
+        class PolynomialExpression :
+            public ExpressionImplementation
+        {
+        private:
+            int _numDimensions;
+            std::vector<int> _degrees;
+            std::vector<double> _coefficients;
+
+            OPENSOLID_CORE_EXPORT
+            int
+            numDimensionsImpl() const override;
+
+            OPENSOLID_CORE_EXPORT
+            int
+            numParametersImpl() const override;
+
+            OPENSOLID_CORE_EXPORT
+            std::vector<int>
+            compileImpl(
+                const std::vector<int>& parameterRegisters,
+                Compiler& compiler
+            ) const override;
+
+            OPENSOLID_CORE_EXPORT
+            std::vector<Interval>
+            boundsImpl(Contractor& contractor) const override;
+
+            OPENSOLID_CORE_EXPORT
+            ExpressionImplementationPtr
+            derivativeImpl(int parameterIndex) const override;
+
+            OPENSOLID_CORE_EXPORT
+            bool
+            isDuplicateOfImpl(const ExpressionImplementationPtr& other) const override;
+
+            OPENSOLID_CORE_EXPORT
+            std::size_t
+            structuralHashImpl() const override;
+
+            OPENSOLID_CORE_EXPORT
+            ExpressionImplementationPtr
+            deduplicatedImpl(DeduplicationCache& deduplicationCache) const override;
+
+            OPENSOLID_CORE_EXPORT
+            ExpressionImplementationPtr
+            scalingImpl(double scale) const override;
+
+            OPENSOLID_CORE_EXPORT
+            ExpressionImplementationPtr
+            translationImpl(const ColumnMatrixXd& columnMatrix) const override;
+
+            OPENSOLID_CORE_EXPORT
+            ExpressionImplementationPtr
+            transformationImpl(const MatrixXd& matrix) const override;
+
+            OPENSOLID_CORE_EXPORT
+            void
+            debugImpl(std::ostream& stream, int indent) const override;
+        public:
+            // Throws if the number of coefficients does not match the degrees
+            OPENSOLID_CORE_EXPORT
+            PolynomialExpression(
+                int numDimensions,
+                const std::vector<int>& degrees,
+                const std::vector<double>& coefficients
+            );
+
+            const std::vector<int>&
+            degrees() const;
+
+            const std::vector<double>&
+            coefficients() const;
+
+            OPENSOLID_CORE_EXPORT
+            void
+            evaluate(const double* parameterValues, double* results) const;
+
+            // Bounds in centered form (the polynomial re-expanded about the midpoint of the
+            // parameter bounds), intersected with the bounds from plain Horner evaluation
+            OPENSOLID_CORE_EXPORT
+            void
+            evaluate(const Interval* parameterBounds, Interval* results) const;
+        };
+    }
+}
+
+namespace opensolid
+{
+    namespace detail
+    {
+        inline
+        const std::vector<int>&
+        PolynomialExpression::degrees() const {
+            return _degrees;
+        }
+
+        inline
+        const std::vector<double>&
+        PolynomialExpression::coefficients() const {
+            return _coefficients;
+        }
+    }
+}
@@ -26,10 +26,45 @@
 
 #include <OpenSolid/Core/Error.hpp>
 #include <OpenSolid/Core/ParametricExpression/ConstantExpression.hpp>
+#include <OpenSolid/Core/ParametricExpression/Contractor.hpp>
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
 
+#include <cmath>
+#include <limits>
+
 namespace opensolid
 {
+    namespace
+    {
+        // Bounds on an integer power, valid for negative as well as positive bases
+        Interval
+        integerPower(Interval base, int exponent) {
+            if (exponent == 0) {
+                return Interval(1.0);
+            } else if (exponent < 0) {
+                return 1.0 / integerPower(base, -exponent);
+            } else if (exponent % 2 == 0) {
+                Interval magnitude = abs(base);
+                return Interval(
+                    std::pow(magnitude.lowerBound(), exponent),
+                    std::pow(magnitude.upperBound(), exponent)
+                );
+            } else {
+                return Interval(
+                    std::pow(base.lowerBound(), exponent),
+                    std::pow(base.upperBound(), exponent)
+                );
+            }
+        }
+
+        // Real (signed, for odd exponents) integer root of a value
+        double
+        integerRoot(double value, int exponent) {
+            double magnitude = std::pow(std::abs(value), 1.0 / exponent);
+            return value < 0.0 ? -magnitude : magnitude;
+        }
+    }
+
     namespace detail
     {
         int
@@ -95,211 +130,86 @@ namespace opensolid
             }
         };
             
-        void
-        PowerExpression::evaluateImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
+        std::vector<int>
+        PowerExpression::compileImpl(
+            const std::vector<int>& parameterRegisters,
+            Compiler& compiler
         ) const {
-            expressionCompiler.evaluate(firstOperand(), parameterID, resultID);
+            int baseRegister = compiler.evaluate(firstOperand(), parameterRegisters).front();
+            int resultRegister = -1;
             if (_exponentIsInteger) {
-                int integerExponent = _integerExponent;
-                expressionCompiler.compute(
-                    resultID,
-                    [integerExponent] (MatrixViewXd results) {
-                        results.setMap(
-                            results,
-                            [integerExponent] (double baseValue) {
-                                return opensolid::pow(baseValue, integerExponent);
-                            }
-                        );
-                    }
-                );
+                resultRegister = compiler.computeIntegerPower(baseRegister, _integerExponent);
             } else if (_exponentIsConstant) {
-                double constantExponent = _constantExponent;
-                expressionCompiler.compute(
-                    resultID,
-                    [constantExponent] (MatrixViewXd results) {
-                        results.setMap(
-                            results,
-                            [constantExponent] (double baseValue) {
-                                return opensolid::pow(baseValue, constantExponent);
-                            }
-                        );
-                    }
-                );
+                resultRegister = compiler.computeConstantPower(baseRegister, _constantExponent);
             } else {
-                expressionCompiler.compute(
-                    expressionCompiler.evaluate(secondOperand(), parameterID),
-                    resultID,
-                    [] (ConstMatrixViewXd exponentValues, MatrixViewXd results) {
-                        results.setBinaryMap(
-                            results,
-                            exponentValues,
-                            [] (double baseValue, double exponentValue) {
-                                return opensolid::pow(baseValue, exponentValue);
-                            }
-                        );
-                    }
-                );
+                int exponentRegister =
+                    compiler.evaluate(secondOperand(), parameterRegisters).front();
+                resultRegister = compiler.compute(Bytecode::POW, baseRegister, exponentRegister);
             }
+            return std::vector<int>(1, resultRegister);
         }
 
-        void
-        PowerExpression::evaluateImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
-        ) const {
-            expressionCompiler.evaluate(firstOperand(), parameterID, resultID);
+        std::vector<Interval>
+        PowerExpression::boundsImpl(Contractor& contractor) const {
+            const std::vector<Interval>& baseBounds = contractor.bounds(firstOperand());
+            const std::vector<Interval>& exponentBounds = contractor.bounds(secondOperand());
+            Interval result;
             if (_exponentIsInteger) {
-                int integerExponent = _integerExponent;
-                expressionCompiler.compute(
-                    resultID,
-                    [integerExponent] (IntervalMatrixViewXd results) {
-                        results.setMap(
-                            results,
-                            [integerExponent] (Interval baseValue) {
-                                return opensolid::pow(baseValue, integerExponent);
-                            }
-                        );
-                    }
-                );
+                result = integerPower(baseBounds.front(), _integerExponent);
             } else if (_exponentIsConstant) {
-                double constantExponent = _constantExponent;
-                expressionCompiler.compute(
-                    resultID,
-                    [constantExponent] (IntervalMatrixViewXd results) {
-                        results.setMap(
-                            results,
-                            [constantExponent] (Interval baseValue) {
-                                return opensolid::pow(baseValue, constantExponent);
-                            }
-                        );
-                    }
-                );
+                result = opensolid::pow(baseBounds.front(), _constantExponent);
             } else {
-                expressionCompiler.compute(
-                    expressionCompiler.evaluate(secondOperand(), parameterID),
-                    resultID,
-                    [] (ConstIntervalMatrixViewXd exponentValues, IntervalMatrixViewXd results) {
-                        results.setBinaryMap(
-                            results,
-                            exponentValues,
-                            [] (Interval baseValue, Interval exponentValue) {
-                                return opensolid::pow(baseValue, exponentValue);
-                            }
-                        );
-                    }
-                );
+                result = opensolid::pow(baseBounds.front(), exponentBounds.front());
             }
+            return std::vector<Interval>(1, result);
         }
 
         void
-        PowerExpression::evaluateJacobianImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            expressionCompiler.evaluateJacobian(firstOperand(), parameterID, resultID);
-            if (_exponentIsConstant) {
-                double constantExponent = _constantExponent;
-                expressionCompiler.compute(
-                    expressionCompiler.evaluate(firstOperand(), parameterID),
-                    resultID,
-                    [constantExponent] (
-                        ConstMatrixViewXd baseValues,
-                        MatrixViewXd results
-                    ) {
-                        double baseValue = baseValues.value();
-                        if (baseValue <= Zero()) {
-                            throw Error(new PlaceholderError());
-                        }
-                        results *= (
-                            constantExponent * opensolid::pow(baseValue, constantExponent - 1.0)
-                        );
-                    }
-                );
-            } else {
-                expressionCompiler.compute(
-                    expressionCompiler.evaluate(firstOperand(), parameterID),
-                    expressionCompiler.evaluate(secondOperand(), parameterID),
-                    expressionCompiler.evaluateJacobian(secondOperand(), parameterID),
-                    expressionCompiler.createTemporary(numDimensions(), numParameters()),
-                    resultID,
-                    [] (
-                        ConstMatrixViewXd baseValues,
-                        ConstMatrixViewXd exponentValues,
-                        ConstMatrixViewXd exponentJacobian,
-                        MatrixViewXd scaledExponentJacobian,
-                        MatrixViewXd results
-                    ) {
-                        double baseValue = baseValues.value();
-                        if (baseValue <= Zero()) {
-                            throw Error(new PlaceholderError());
-                        }
-                        double exponentValue = exponentValues.value();
-                        scaledExponentJacobian = exponentJacobian;
-                        scaledExponentJacobian *= opensolid::log(baseValue);
-                        results *= (exponentValue / baseValue);
-                        results += scaledExponentJacobian;
-                        results *= opensolid::pow(baseValue, exponentValue);
-                    }
-                );
-            }
-        }
-        
-        void
-        PowerExpression::evaluateJacobianImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        PowerExpression::contractImpl(
+            const std::vector<Interval>& bounds,
+            Contractor& contractor
         ) const {
-            expressionCompiler.evaluateJacobian(firstOperand(), parameterID, resultID);
-            if (_exponentIsConstant) {
-                double constantExponent = _constantExponent;
-                expressionCompiler.compute(
-                    expressionCompiler.evaluate(firstOperand(), parameterID),
-                    resultID,
-                    [constantExponent] (
-                        ConstIntervalMatrixViewXd baseValues,
-                        IntervalMatrixViewXd results
-                    ) {
-                        Interval baseValue = baseValues.value();
-                        if (baseValue.upperBound() <= Zero()) {
-                            throw Error(new PlaceholderError());
-                        }
-                        results *= (
-                            constantExponent * opensolid::pow(baseValue, constantExponent - 1.0)
-                        );
-                    }
-                );
-            } else {
-                expressionCompiler.compute(
-                    expressionCompiler.evaluate(firstOperand(), parameterID),
-                    expressionCompiler.evaluate(secondOperand(), parameterID),
-                    expressionCompiler.evaluateJacobian(secondOperand(), parameterID),
-                    expressionCompiler.createTemporary(numDimensions(), numParameters()),
-                    resultID,
-                    [] (
-                        ConstIntervalMatrixViewXd baseValues,
-                        ConstIntervalMatrixViewXd exponentValues,
-                        ConstIntervalMatrixViewXd exponentJacobian,
-                        IntervalMatrixViewXd scaledExponentJacobian,
-                        IntervalMatrixViewXd results
-                    ) {
-                        Interval baseValue = baseValues.value();
-                        if (baseValue.upperBound() <= Zero()) {
-                            throw Error(new PlaceholderError());
-                        }
-                        Interval exponentValue = exponentValues.value();
-                        scaledExponentJacobian = exponentJacobian;
-                        scaledExponentJacobian *= opensolid::log(baseValue);
-                        results *= (exponentValue / baseValue);
-                        results += scaledExponentJacobian;
-                        results *= opensolid::pow(baseValue, exponentValue);
+            Interval baseBounds = contractor.bounds(firstOperand()).front();
+            Interval valueBounds = bounds.front();
+            if (_exponentIsInteger && _integerExponent > 0) {
+                int exponent = _integerExponent;
+                if (exponent % 2 == 0) {
+                    // Even powers have both a positive and a negative root
+                    Interval nonNegative = valueBounds.intersection(
+                        Interval(0.0, std::numeric_limits<double>::infinity())
+                    );
+                    if (nonNegative.isEmpty()) {
+                        contractor.narrow(firstOperand(), 0, Interval::EMPTY());
+                        return;
                     }
+                    Interval root = Contractor::widened(
+                        Interval(
+                            integerRoot(nonNegative.lowerBound(), exponent),
+                            integerRoot(nonNegative.upperBound(), exponent)
+                        )
+                    );
+                    Interval preimage = baseBounds.intersection(root).hull(
+                        baseBounds.intersection(-root)
+                    );
+                    contractor.narrow(firstOperand(), 0, preimage);
+                } else {
+                    Interval root = Interval(
+                        integerRoot(valueBounds.lowerBound(), exponent),
+                        integerRoot(valueBounds.upperBound(), exponent)
+                    );
+                    contractor.narrow(firstOperand(), 0, root);
+                }
+            } else if (_exponentIsConstant && !_exponentIsInteger) {
+                // Non-integer powers are only defined for non-negative bases
+                Interval nonNegative = valueBounds.intersection(
+                    Interval(0.0, std::numeric_limits<double>::infinity())
                 );
+                if (nonNegative.isEmpty()) {
+                    contractor.narrow(firstOperand(), 0, Interval::EMPTY());
+                    return;
+                }
+                Interval preimage = opensolid::pow(nonNegative, 1.0 / _constantExponent);
+                contractor.narrow(firstOperand(), 0, preimage);
             }
         }
 
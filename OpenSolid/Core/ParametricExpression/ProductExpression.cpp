@@ -24,6 +24,7 @@
 
 #include <OpenSolid/Core/ParametricExpression/ProductExpression.hpp>
 
+#include <OpenSolid/Core/ParametricExpression/Contractor.hpp>
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
 
 namespace opensolid
@@ -35,96 +36,59 @@ namespace opensolid
             return secondOperand()->numDimensions();
         }
         
-        void
-        ProductExpression::evaluateImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
+        std::vector<int>
+        ProductExpression::compileImpl(
+            const std::vector<int>& parameterRegisters,
+            Compiler& compiler
         ) const {
-            expressionCompiler.evaluate(secondOperand(), parameterID, resultID);
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(firstOperand(), parameterID),
-                resultID,
-                [] (ConstMatrixViewXd multiplierValues, MatrixViewXd results) {
-                    for (int columnIndex = 0; columnIndex < results.numColumns(); ++columnIndex) {
-                        results.column(columnIndex) *= multiplierValues(0, columnIndex);
-                    }
-                }
-            );
-        }
-        
-        void
-        ProductExpression::evaluateImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
-        ) const {
-            expressionCompiler.evaluate(secondOperand(), parameterID, resultID);
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(firstOperand(), parameterID),
-                resultID,
-                [] (ConstIntervalMatrixViewXd multiplierValues, IntervalMatrixViewXd results) {
-                    for (int columnIndex = 0; columnIndex < results.numColumns(); ++columnIndex) {
-                        results.column(columnIndex) *= multiplierValues(0, columnIndex);
-                    }
-                }
-            );
+            int multiplierRegister = compiler.evaluate(firstOperand(), parameterRegisters).front();
+            std::vector<int> results = compiler.evaluate(secondOperand(), parameterRegisters);
+            for (std::size_t index = 0; index < results.size(); ++index) {
+                results[index] = compiler.compute(
+                    Bytecode::MULTIPLY,
+                    multiplierRegister,
+                    results[index]
+                );
+            }
+            return results;
         }
 
-        void
-        ProductExpression::evaluateJacobianImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            expressionCompiler.evaluateJacobian(secondOperand(), parameterID, resultID);
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(firstOperand(), parameterID),
-                expressionCompiler.evaluate(secondOperand(), parameterID),
-                expressionCompiler.evaluateJacobian(firstOperand(), parameterID),
-                expressionCompiler.createTemporary(numDimensions(), numParameters()),
-                resultID,
-                [] (
-                    ConstMatrixViewXd multiplierValues,
-                    ConstMatrixViewXd multiplicandValues,
-                    ConstMatrixViewXd multiplierJacobian,
-                    MatrixViewXd tempProduct,
-                    MatrixViewXd results
-                ) {
-                    double multiplierValue = multiplierValues.value();
-                    results *= multiplierValue;
-                    tempProduct.setProduct(multiplicandValues, multiplierJacobian);
-                    results += tempProduct;
-                }
-            );
+        std::vector<Interval>
+        ProductExpression::boundsImpl(Contractor& contractor) const {
+            const std::vector<Interval>& firstBounds = contractor.bounds(firstOperand());
+            const std::vector<Interval>& secondBounds = contractor.bounds(secondOperand());
+            if (firstOperand() == secondOperand()) {
+                return std::vector<Interval>(1, firstBounds.front().squared());
+            }
+            std::vector<Interval> results(numDimensions());
+            for (int index = 0; index < numDimensions(); ++index) {
+                results[index] = firstBounds.front() * secondBounds[index];
+            }
+            return results;
         }
-        
+
         void
-        ProductExpression::evaluateJacobianImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        ProductExpression::contractImpl(
+            const std::vector<Interval>& bounds,
+            Contractor& contractor
         ) const {
-            expressionCompiler.evaluateJacobian(secondOperand(), parameterID, resultID);
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(firstOperand(), parameterID),
-                expressionCompiler.evaluate(secondOperand(), parameterID),
-                expressionCompiler.evaluateJacobian(firstOperand(), parameterID),
-                expressionCompiler.createTemporary(numDimensions(), numParameters()),
-                resultID,
-                [] (
-                    ConstIntervalMatrixViewXd multiplierValues,
-                    ConstIntervalMatrixViewXd multiplicandValues,
-                    ConstIntervalMatrixViewXd multiplierJacobian,
-                    IntervalMatrixViewXd tempProduct,
-                    IntervalMatrixViewXd results
-                ) {
-                    Interval multiplierValue = multiplierValues.value();
-                    results *= multiplierValue;
-                    tempProduct.setProduct(multiplicandValues, multiplierJacobian);
-                    results += tempProduct;
-                }
-            );
+            const std::vector<Interval>& firstBounds = contractor.bounds(firstOperand());
+            const std::vector<Interval>& secondBounds = contractor.bounds(secondOperand());
+            if (firstOperand() == secondOperand()) {
+                // Dividing by an interval containing zero would give no information, so treat
+                // the product of an expression with itself as a square
+                Interval preimage = Contractor::squarePreimage(bounds.front(), firstBounds.front());
+                contractor.narrow(firstOperand(), 0, preimage);
+                return;
+            }
+            for (int index = 0; index < numDimensions(); ++index) {
+                Interval secondPreimage =
+                    Contractor::quotientBounds(bounds[index], firstBounds.front());
+                contractor.narrow(secondOperand(), index, secondPreimage);
+                Interval firstPreimage =
+                    Contractor::quotientBounds(bounds[index], secondBounds[index]);
+                contractor.narrow(firstOperand(), 0, firstPreimage);
+            }
         }
 
         ExpressionImplementationPtr
@@ -25,6 +25,7 @@
 #include <OpenSolid/Core/ParametricExpression/QuotientExpression.hpp>
 
 #include <OpenSolid/Core/Error.hpp>
+#include <OpenSolid/Core/ParametricExpression/Contractor.hpp>
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
 
 namespace opensolid
@@ -36,112 +37,50 @@ namespace opensolid
             return firstOperand()->numDimensions();
         }
         
-        void
-        QuotientExpression::evaluateImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
+        std::vector<int>
+        QuotientExpression::compileImpl(
+            const std::vector<int>& parameterRegisters,
+            Compiler& compiler
         ) const {
-            expressionCompiler.evaluate(firstOperand(), parameterID, resultID);
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(secondOperand(), parameterID),
-                resultID,
-                [] (ConstMatrixViewXd divisorValues, MatrixViewXd results) {
-                    for (int columnIndex = 0; columnIndex < results.numColumns(); ++columnIndex) {
-                        double divisorValue = divisorValues(0, columnIndex);
-                        if (divisorValue == Zero()) {
-                            throw Error(new PlaceholderError());
-                        }
-                        results.column(columnIndex) /= divisorValue;
-                    }
-                }
-            );
-        }
-        
-        void
-        QuotientExpression::evaluateImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
-        ) const {
-            expressionCompiler.evaluate(firstOperand(), parameterID, resultID);
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(secondOperand(), parameterID),
-                resultID,
-                [] (ConstIntervalMatrixViewXd divisorValues, IntervalMatrixViewXd results) {
-                    for (int columnIndex = 0; columnIndex < results.numColumns(); ++columnIndex) {
-                        Interval divisorValue = divisorValues(0, columnIndex);
-                        if (divisorValue == Zero()) {
-                            throw Error(new PlaceholderError());
-                        }
-                        results.column(columnIndex) /= divisorValue;
-                    }
-                }
-            );
+            std::vector<int> results = compiler.evaluate(firstOperand(), parameterRegisters);
+            int divisorRegister = compiler.evaluate(secondOperand(), parameterRegisters).front();
+            compiler.checkNonZero(divisorRegister);
+            for (std::size_t index = 0; index < results.size(); ++index) {
+                results[index] = compiler.compute(
+                    Bytecode::DIVIDE,
+                    results[index],
+                    divisorRegister
+                );
+            }
+            return results;
         }
 
-        void
-        QuotientExpression::evaluateJacobianImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            expressionCompiler.evaluateJacobian(firstOperand(), parameterID, resultID);
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(firstOperand(), parameterID),
-                expressionCompiler.evaluate(secondOperand(), parameterID),
-                expressionCompiler.evaluateJacobian(secondOperand(), parameterID),
-                expressionCompiler.createTemporary(numDimensions(), numParameters()),
-                resultID,
-                [] (
-                    ConstMatrixViewXd dividendValues,
-                    ConstMatrixViewXd divisorValues,
-                    ConstMatrixViewXd divisorJacobian,
-                    MatrixViewXd tempProduct,
-                    MatrixViewXd results
-                ) {
-                    double divisorValue = divisorValues.value();
-                    if (divisorValue == Zero()) {
-                        throw Error(new PlaceholderError());
-                    }
-                    results *= divisorValue;
-                    tempProduct.setProduct(dividendValues, divisorJacobian);
-                    results -= tempProduct;
-                    results *= (1.0 / (divisorValue * divisorValue));
-                }
-            );
+        std::vector<Interval>
+        QuotientExpression::boundsImpl(Contractor& contractor) const {
+            const std::vector<Interval>& firstBounds = contractor.bounds(firstOperand());
+            const std::vector<Interval>& secondBounds = contractor.bounds(secondOperand());
+            std::vector<Interval> results(numDimensions());
+            for (int index = 0; index < numDimensions(); ++index) {
+                results[index] = firstBounds[index] / secondBounds.front();
+            }
+            return results;
         }
-        
+
         void
-        QuotientExpression::evaluateJacobianImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        QuotientExpression::contractImpl(
+            const std::vector<Interval>& bounds,
+            Contractor& contractor
         ) const {
-            expressionCompiler.evaluateJacobian(firstOperand(), parameterID, resultID);
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(firstOperand(), parameterID),
-                expressionCompiler.evaluate(secondOperand(), parameterID),
-                expressionCompiler.evaluateJacobian(secondOperand(), parameterID),
-                expressionCompiler.createTemporary(numDimensions(), numParameters()),
-                resultID,
-                [] (
-                    ConstIntervalMatrixViewXd dividendValues,
-                    ConstIntervalMatrixViewXd divisorValues,
-                    ConstIntervalMatrixViewXd divisorJacobian,
-                    IntervalMatrixViewXd tempProduct,
-                    IntervalMatrixViewXd results
-                ) {
-                    Interval divisorValue = divisorValues.value();
-                    if (divisorValue == Zero()) {
-                        throw Error(new PlaceholderError());
-                    }
-                    results *= divisorValue;
-                    tempProduct.setProduct(dividendValues, divisorJacobian);
-                    results -= tempProduct;
-                    results *= (1.0 / divisorValue.squared());
-                }
-            );
+            const std::vector<Interval>& firstBounds = contractor.bounds(firstOperand());
+            const std::vector<Interval>& secondBounds = contractor.bounds(secondOperand());
+            for (int index = 0; index < numDimensions(); ++index) {
+                Interval dividendPreimage =
+                    Contractor::productBounds(bounds[index], secondBounds.front());
+                contractor.narrow(firstOperand(), index, dividendPreimage);
+                Interval divisorPreimage =
+                    Contractor::quotientBounds(firstBounds[index], bounds[index]);
+                contractor.narrow(secondOperand(), 0, divisorPreimage);
+            }
         }
 
         ExpressionImplementationPtr
@@ -24,6 +24,7 @@
 
 #include <OpenSolid/Core/ParametricExpression/ScalingExpression.hpp>
 
+#include <OpenSolid/Core/ParametricExpression/Contractor.hpp>
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
 
 namespace opensolid
@@ -35,70 +36,46 @@ namespace opensolid
             return operand()->numDimensions();
         }
         
-        void
-        ScalingExpression::evaluateImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
+        std::vector<int>
+        ScalingExpression::compileImpl(
+            const std::vector<int>& parameterRegisters,
+            Compiler& compiler
         ) const {
-            expressionCompiler.evaluate(operand(), parameterID, resultID);
-            double scale = this->scale();
-            expressionCompiler.compute(
-                resultID,
-                [scale] (MatrixViewXd results) {
-                    results *= scale;
-                }
-            );
-        }
-        
-        void
-        ScalingExpression::evaluateImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
-        ) const {
-            expressionCompiler.evaluate(operand(), parameterID, resultID);
-            double scale = this->scale();
-            expressionCompiler.compute(
-                resultID,
-                [scale] (IntervalMatrixViewXd results) {
-                    results *= scale;
-                }
-            );
+            std::vector<int> results = compiler.evaluate(operand(), parameterRegisters);
+            int scaleRegister = compiler.constant(scale());
+            for (std::size_t index = 0; index < results.size(); ++index) {
+                results[index] = compiler.compute(
+                    Bytecode::MULTIPLY,
+                    scaleRegister,
+                    results[index]
+                );
+            }
+            return results;
         }
 
-        void
-        ScalingExpression::evaluateJacobianImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            expressionCompiler.evaluateJacobian(operand(), parameterID, resultID);
-            double scale = this->scale();
-            expressionCompiler.compute(
-                resultID,
-                [scale] (MatrixViewXd results) {
-                    results *= scale;
-                }
-            );
+        std::vector<Interval>
+        ScalingExpression::boundsImpl(Contractor& contractor) const {
+            const std::vector<Interval>& operandBounds = contractor.bounds(operand());
+            std::vector<Interval> results(numDimensions());
+            for (int index = 0; index < numDimensions(); ++index) {
+                results[index] = scale() * operandBounds[index];
+            }
+            return results;
         }
-        
+
         void
-        ScalingExpression::evaluateJacobianImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        ScalingExpression::contractImpl(
+            const std::vector<Interval>& bounds,
+            Contractor& contractor
         ) const {
-            expressionCompiler.evaluateJacobian(operand(), parameterID, resultID);
-            double scale = this->scale();
-            expressionCompiler.compute(
-                resultID,
-                [scale] (IntervalMatrixViewXd results) {
-                    results *= scale;
-                }
-            );
+            if (scale() == 0.0) {
+                return;
+            }
+            for (int index = 0; index < numDimensions(); ++index) {
+                contractor.narrow(operand(), index, bounds[index] / scale());
+            }
         }
-        
+
         ExpressionImplementationPtr
         ScalingExpression::derivativeImpl(int parameterIndex) const {
             return scale() * operand()->derivative(parameterIndex);
@@ -114,6 +91,11 @@ namespace opensolid
             );
         }
 
+        std::size_t
+        ScalingExpression::structuralHashImpl() const {
+            return combineHashes(operand()->structuralHash(), hashValue(scale()));
+        }
+
         ExpressionImplementationPtr
         ScalingExpression::scalingImpl(double scale) const {
             return (scale * this->scale()) * operand();
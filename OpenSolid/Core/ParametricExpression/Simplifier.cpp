@@ -0,0 +1,569 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#include <OpenSolid/Core/ParametricExpression/Simplifier.hpp>
+
+#include <OpenSolid/Core/Error.hpp>
+#include <OpenSolid/Core/MatrixView.hpp>
+#include <OpenSolid/Core/ParametricExpression/BinaryOperation.hpp>
+#include <OpenSolid/Core/ParametricExpression/Bytecode/Compiler.hpp>
+#include <OpenSolid/Core/ParametricExpression/Bytecode/Evaluator.hpp>
+#include <OpenSolid/Core/ParametricExpression/CompositionExpression.hpp>
+#include <OpenSolid/Core/ParametricExpression/ConstantExpression.hpp>
+#include <OpenSolid/Core/ParametricExpression/DifferenceExpression.hpp>
+#include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
+#include <OpenSolid/Core/ParametricExpression/NegatedExpression.hpp>
+#include <OpenSolid/Core/ParametricExpression/ScalingExpression.hpp>
+#include <OpenSolid/Core/ParametricExpression/SquaredNormExpression.hpp>
+#include <OpenSolid/Core/ParametricExpression/SquareRootExpression.hpp>
+#include <OpenSolid/Core/ParametricExpression/SumExpression.hpp>
+#include <OpenSolid/Core/ParametricExpression/TransformationExpression.hpp>
+#include <OpenSolid/Core/ParametricExpression/TranslationExpression.hpp>
+#include <OpenSolid/Core/ParametricExpression/UnaryOperation.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <typeinfo>
+#include <vector>
+
+namespace opensolid
+{
+    namespace detail
+    {
+        namespace
+        {
+            std::mutex&
+            totalStatisticsMutex() {
+                static std::mutex mutex;
+                return mutex;
+            }
+
+            Simplifier::Statistics&
+            totalStatisticsInstance() {
+                static Simplifier::Statistics statistics;
+                return statistics;
+            }
+
+            template <class TExpression>
+            bool
+            isA(const ExpressionImplementationPtr& expressionPtr) {
+                return typeid(*expressionPtr) == typeid(TExpression);
+            }
+
+            bool
+            isLeaf(const ExpressionImplementationPtr& expressionPtr) {
+                return (
+                    expressionPtr->isConstantExpression() ||
+                    expressionPtr->isIdentityExpression() ||
+                    expressionPtr->isParameterExpression()
+                );
+            }
+
+            std::vector<ExpressionImplementationPtr>
+            operands(const ExpressionImplementationPtr& expressionPtr) {
+                std::vector<ExpressionImplementationPtr> results;
+                const UnaryOperation* unaryOperation =
+                    dynamic_cast<const UnaryOperation*>(expressionPtr.get());
+                const BinaryOperation* binaryOperation =
+                    dynamic_cast<const BinaryOperation*>(expressionPtr.get());
+                if (unaryOperation) {
+                    results.push_back(unaryOperation->operand());
+                } else if (binaryOperation) {
+                    results.push_back(binaryOperation->firstOperand());
+                    results.push_back(binaryOperation->secondOperand());
+                } else if (isA<CompositionExpression>(expressionPtr)) {
+                    const CompositionExpression* compositionExpression =
+                        expressionPtr->cast<CompositionExpression>();
+                    results.push_back(compositionExpression->outerExpression());
+                    results.push_back(compositionExpression->innerExpression());
+                }
+                return results;
+            }
+
+            // True for non-leaf nodes whose value does not depend on their parameters since
+            // all of their operands are constant (for a composition, only the inner expression
+            // needs to be constant)
+            bool
+            hasConstantOperands(const ExpressionImplementationPtr& expressionPtr) {
+                if (isLeaf(expressionPtr)) {
+                    return false;
+                }
+                const UnaryOperation* unaryOperation =
+                    dynamic_cast<const UnaryOperation*>(expressionPtr.get());
+                const BinaryOperation* binaryOperation =
+                    dynamic_cast<const BinaryOperation*>(expressionPtr.get());
+                if (unaryOperation) {
+                    return unaryOperation->operand()->isConstantExpression();
+                } else if (binaryOperation) {
+                    return (
+                        binaryOperation->firstOperand()->isConstantExpression() &&
+                        binaryOperation->secondOperand()->isConstantExpression()
+                    );
+                } else if (isA<CompositionExpression>(expressionPtr)) {
+                    const CompositionExpression* compositionExpression =
+                        expressionPtr->cast<CompositionExpression>();
+                    return compositionExpression->innerExpression()->isConstantExpression();
+                }
+                return false;
+            }
+        }
+
+        Simplifier::Statistics::Statistics() :
+            numInputNodes(0),
+            numOutputNodes(0),
+            numConstantFolds(0),
+            numIdentityEliminations(0),
+            numAffineMerges(0),
+            numNormRewrites(0),
+            numNegationRewrites(0),
+            numDuplicateOperandRewrites(0) {
+        }
+
+        Simplifier::Statistics&
+        Simplifier::Statistics::operator+=(const Statistics& other) {
+            numInputNodes += other.numInputNodes;
+            numOutputNodes += other.numOutputNodes;
+            numConstantFolds += other.numConstantFolds;
+            numIdentityEliminations += other.numIdentityEliminations;
+            numAffineMerges += other.numAffineMerges;
+            numNormRewrites += other.numNormRewrites;
+            numNegationRewrites += other.numNegationRewrites;
+            numDuplicateOperandRewrites += other.numDuplicateOperandRewrites;
+            return *this;
+        }
+
+        ExpressionImplementationPtr
+        Simplifier::simplifiedNode(const ExpressionImplementationPtr& expressionPtr) {
+            auto iterator = _cache.find(expressionPtr.get());
+            if (iterator != _cache.end()) {
+                return iterator->second.second;
+            }
+
+            // Apply rewrite rules until none of them change the expression (each rule either
+            // removes nodes or moves a translation outwards, so this always terminates)
+            ExpressionImplementationPtr resultPtr = rebuilt(expressionPtr);
+            while (true) {
+                ExpressionImplementationPtr nextPtr = rewritten(resultPtr);
+                if (nextPtr == resultPtr) {
+                    break;
+                }
+                resultPtr = nextPtr;
+            }
+
+            CacheEntry cacheEntry(expressionPtr, resultPtr);
+            _cache.insert(std::make_pair(expressionPtr.get(), cacheEntry));
+            return resultPtr;
+        }
+
+        ExpressionImplementationPtr
+        Simplifier::rebuilt(const ExpressionImplementationPtr& expressionPtr) {
+            if (isLeaf(expressionPtr)) {
+                return expressionPtr;
+            }
+
+            const UnaryOperation* unaryOperation =
+                dynamic_cast<const UnaryOperation*>(expressionPtr.get());
+            if (unaryOperation) {
+                ExpressionImplementationPtr operandPtr = simplifiedNode(unaryOperation->operand());
+                if (operandPtr == unaryOperation->operand()) {
+                    return expressionPtr;
+                }
+                ExpressionImplementationPtr resultPtr = unaryOperation->withNewOperand(operandPtr);
+                if (resultPtr == operandPtr) {
+                    ++_statistics.numIdentityEliminations;
+                }
+                return resultPtr;
+            }
+
+            const BinaryOperation* binaryOperation =
+                dynamic_cast<const BinaryOperation*>(expressionPtr.get());
+            if (binaryOperation) {
+                ExpressionImplementationPtr firstOperandPtr =
+                    simplifiedNode(binaryOperation->firstOperand());
+                ExpressionImplementationPtr secondOperandPtr =
+                    simplifiedNode(binaryOperation->secondOperand());
+                bool unchanged = (
+                    firstOperandPtr == binaryOperation->firstOperand() &&
+                    secondOperandPtr == binaryOperation->secondOperand()
+                );
+                if (unchanged) {
+                    return expressionPtr;
+                }
+                ExpressionImplementationPtr resultPtr =
+                    binaryOperation->withNewOperands(firstOperandPtr, secondOperandPtr);
+                if (resultPtr == firstOperandPtr || resultPtr == secondOperandPtr) {
+                    ++_statistics.numIdentityEliminations;
+                }
+                return resultPtr;
+            }
+
+            if (isA<CompositionExpression>(expressionPtr)) {
+                const CompositionExpression* compositionExpression =
+                    expressionPtr->cast<CompositionExpression>();
+                ExpressionImplementationPtr outerPtr =
+                    simplifiedNode(compositionExpression->outerExpression());
+                ExpressionImplementationPtr innerPtr =
+                    simplifiedNode(compositionExpression->innerExpression());
+                bool unchanged = (
+                    outerPtr == compositionExpression->outerExpression() &&
+                    innerPtr == compositionExpression->innerExpression()
+                );
+                if (unchanged) {
+                    return expressionPtr;
+                }
+                ExpressionImplementationPtr resultPtr = outerPtr->composed(innerPtr);
+                if (resultPtr == outerPtr || resultPtr == innerPtr) {
+                    ++_statistics.numIdentityEliminations;
+                }
+                return resultPtr;
+            }
+
+            return expressionPtr;
+        }
+
+        bool
+        Simplifier::evaluatedConstants(
+            const std::vector<ExpressionImplementationPtr>& expressions,
+            std::vector<double>& values
+        ) {
+            // Evaluate at an arbitrary parameter value, since none of the expressions depend on
+            // their parameters
+            int numParameters = expressions.front()->numParameters();
+            int numValues = 0;
+            for (const ExpressionImplementationPtr& expressionPtr : expressions) {
+                numValues += expressionPtr->numDimensions();
+            }
+            std::vector<double> parameterValues(std::max(numParameters, 1), 0.0);
+            values.assign(numValues, 0.0);
+            try {
+                Evaluator evaluator = Compiler::compile(expressions);
+                MatrixView<const double, -1, -1, -1> parameterView(
+                    parameterValues.data(),
+                    numParameters,
+                    1,
+                    numParameters * sizeof(double)
+                );
+                MatrixView<double, -1, -1, -1> resultView(
+                    values.data(),
+                    numValues,
+                    1,
+                    numValues * sizeof(double)
+                );
+                evaluator.evaluate(parameterView, resultView);
+            } catch (const Error&) {
+                return false;
+            }
+            return true;
+        }
+
+        bool
+        Simplifier::foldedConstants(const ExpressionImplementationPtr& expressionPtr) {
+            // Find all foldable nodes (grouped by number of parameters, since nodes inside the
+            // outer expression of a composition have a different number of parameters than the
+            // rest of the graph)
+            std::unordered_set<const ExpressionImplementation*> visitedNodes;
+            std::map<int, std::vector<ExpressionImplementationPtr>> foldableNodes;
+            collectFoldableNodes(expressionPtr, visitedNodes, foldableNodes);
+            if (foldableNodes.empty()) {
+                return false;
+            }
+
+            // Evaluate all foldable nodes with the same number of parameters together, so that
+            // only one evaluator is compiled per group. If that fails (division by zero etc.),
+            // evaluate each node separately to find out which ones can be folded. Nodes that fail
+            // to evaluate or that evaluate to NaN are left alone so that the error is reported at
+            // evaluation time as it would have been without simplification.
+            std::unordered_set<const ExpressionImplementation*> foldedNodes;
+            for (const auto& group : foldableNodes) {
+                const std::vector<ExpressionImplementationPtr>& nodes = group.second;
+                std::vector<double> values;
+                bool evaluated = evaluatedConstants(nodes, values);
+                int offset = 0;
+                for (const ExpressionImplementationPtr& nodePtr : nodes) {
+                    int numDimensions = nodePtr->numDimensions();
+                    std::vector<double> nodeValues;
+                    if (evaluated) {
+                        nodeValues.assign(
+                            values.begin() + offset,
+                            values.begin() + offset + numDimensions
+                        );
+                        offset += numDimensions;
+                    } else {
+                        std::vector<ExpressionImplementationPtr> node(1, nodePtr);
+                        if (!evaluatedConstants(node, nodeValues)) {
+                            _unfoldableNodes.insert(std::make_pair(nodePtr.get(), nodePtr));
+                            continue;
+                        }
+                    }
+
+                    ColumnMatrixXd columnMatrix(numDimensions);
+                    bool isNaN = false;
+                    for (int index = 0; index < numDimensions; ++index) {
+                        isNaN = isNaN || std::isnan(nodeValues[index]);
+                        columnMatrix(index) = nodeValues[index];
+                    }
+                    if (isNaN) {
+                        _unfoldableNodes.insert(std::make_pair(nodePtr.get(), nodePtr));
+                        continue;
+                    }
+                    _cache[nodePtr.get()] = CacheEntry(
+                        nodePtr,
+                        std::make_shared<ConstantExpression>(columnMatrix, group.first)
+                    );
+                    foldedNodes.insert(nodePtr.get());
+                    ++_statistics.numConstantFolds;
+                }
+            }
+            if (foldedNodes.empty()) {
+                return false;
+            }
+
+            // Forget the simplified versions of all nodes that depend on a folded node, then
+            // simplify them again (picking up the folded constants) and update any cache entries
+            // that referred to their old versions
+            std::unordered_map<const ExpressionImplementation*, bool> dependentNodes;
+            collectDependentNodes(expressionPtr, foldedNodes, dependentNodes);
+            for (const auto& dependentNode : dependentNodes) {
+                if (dependentNode.second && !foldedNodes.count(dependentNode.first)) {
+                    _cache.erase(dependentNode.first);
+                }
+            }
+            std::vector<const ExpressionImplementation*> cachedNodes;
+            cachedNodes.reserve(_cache.size());
+            for (const auto& cacheEntry : _cache) {
+                cachedNodes.push_back(cacheEntry.first);
+            }
+            for (const ExpressionImplementation* cachedNode : cachedNodes) {
+                ExpressionImplementationPtr resultPtr = _cache[cachedNode].second;
+                auto iterator = dependentNodes.find(resultPtr.get());
+                if (iterator != dependentNodes.end() && iterator->second) {
+                    ExpressionImplementationPtr updatedPtr = simplifiedNode(resultPtr);
+                    _cache[cachedNode].second = updatedPtr;
+                }
+            }
+            return true;
+        }
+
+        ExpressionImplementationPtr
+        Simplifier::rewritten(const ExpressionImplementationPtr& expressionPtr) {
+            if (isA<SquareRootExpression>(expressionPtr)) {
+                const ExpressionImplementationPtr& operandPtr =
+                    expressionPtr->cast<SquareRootExpression>()->operand();
+                if (isA<SquaredNormExpression>(operandPtr)) {
+                    ++_statistics.numNormRewrites;
+                    return operandPtr->cast<SquaredNormExpression>()->operand()->norm();
+                }
+            } else if (isA<NegatedExpression>(expressionPtr)) {
+                const ExpressionImplementationPtr& operandPtr =
+                    expressionPtr->cast<NegatedExpression>()->operand();
+                if (isA<NegatedExpression>(operandPtr)) {
+                    ++_statistics.numNegationRewrites;
+                    return operandPtr->cast<NegatedExpression>()->operand();
+                }
+                if (isA<TranslationExpression>(operandPtr)) {
+                    const TranslationExpression* translationExpression =
+                        operandPtr->cast<TranslationExpression>();
+                    ++_statistics.numAffineMerges;
+                    return (
+                        -translationExpression->operand() +
+                        ColumnMatrixXd(-translationExpression->columnMatrix())
+                    );
+                }
+            } else if (isA<ScalingExpression>(expressionPtr)) {
+                const ScalingExpression* scalingExpression =
+                    expressionPtr->cast<ScalingExpression>();
+                const ExpressionImplementationPtr& operandPtr = scalingExpression->operand();
+                if (isA<TranslationExpression>(operandPtr)) {
+                    const TranslationExpression* translationExpression =
+                        operandPtr->cast<TranslationExpression>();
+                    double scale = scalingExpression->scale();
+                    ++_statistics.numAffineMerges;
+                    return (
+                        scale * translationExpression->operand() +
+                        ColumnMatrixXd(scale * translationExpression->columnMatrix())
+                    );
+                }
+            } else if (isA<TransformationExpression>(expressionPtr)) {
+                const TransformationExpression* transformationExpression =
+                    expressionPtr->cast<TransformationExpression>();
+                const ExpressionImplementationPtr& operandPtr =
+                    transformationExpression->operand();
+                if (isA<TranslationExpression>(operandPtr)) {
+                    const TranslationExpression* translationExpression =
+                        operandPtr->cast<TranslationExpression>();
+                    const MatrixXd& matrix = transformationExpression->matrix();
+                    ++_statistics.numAffineMerges;
+                    return (
+                        matrix * translationExpression->operand() +
+                        ColumnMatrixXd(matrix * translationExpression->columnMatrix())
+                    );
+                }
+            } else if (isA<SumExpression>(expressionPtr)) {
+                const SumExpression* sumExpression = expressionPtr->cast<SumExpression>();
+                const ExpressionImplementationPtr& firstOperandPtr = sumExpression->firstOperand();
+                const ExpressionImplementationPtr& secondOperandPtr =
+                    sumExpression->secondOperand();
+                // isDuplicateOf() compares numeric data exactly, so this only matches operands
+                // that are the same node or structurally identical to it
+                if (firstOperandPtr->isDuplicateOf(secondOperandPtr)) {
+                    ++_statistics.numDuplicateOperandRewrites;
+                    return 2.0 * firstOperandPtr;
+                }
+                if (isA<NegatedExpression>(secondOperandPtr)) {
+                    ++_statistics.numNegationRewrites;
+                    return (
+                        firstOperandPtr -
+                        secondOperandPtr->cast<NegatedExpression>()->operand()
+                    );
+                }
+                if (isA<NegatedExpression>(firstOperandPtr)) {
+                    ++_statistics.numNegationRewrites;
+                    return (
+                        secondOperandPtr -
+                        firstOperandPtr->cast<NegatedExpression>()->operand()
+                    );
+                }
+            } else if (isA<DifferenceExpression>(expressionPtr)) {
+                const DifferenceExpression* differenceExpression =
+                    expressionPtr->cast<DifferenceExpression>();
+                const ExpressionImplementationPtr& firstOperandPtr =
+                    differenceExpression->firstOperand();
+                const ExpressionImplementationPtr& secondOperandPtr =
+                    differenceExpression->secondOperand();
+                // As above, merely nearly equal operands (which would leave a small but
+                // nonzero difference) are not matched
+                if (firstOperandPtr->isDuplicateOf(secondOperandPtr)) {
+                    ++_statistics.numDuplicateOperandRewrites;
+                    return std::make_shared<ConstantExpression>(
+                        ColumnMatrixXd::zero(expressionPtr->numDimensions()),
+                        expressionPtr->numParameters()
+                    );
+                }
+                if (isA<NegatedExpression>(secondOperandPtr)) {
+                    ++_statistics.numNegationRewrites;
+                    return (
+                        firstOperandPtr +
+                        secondOperandPtr->cast<NegatedExpression>()->operand()
+                    );
+                }
+            }
+            return expressionPtr;
+        }
+
+        void
+        Simplifier::collectNodes(
+            const ExpressionImplementationPtr& expressionPtr,
+            std::unordered_set<const ExpressionImplementation*>& nodes
+        ) {
+            if (!nodes.insert(expressionPtr.get()).second) {
+                return;
+            }
+            for (const ExpressionImplementationPtr& operandPtr : operands(expressionPtr)) {
+                collectNodes(operandPtr, nodes);
+            }
+        }
+
+        void
+        Simplifier::collectFoldableNodes(
+            const ExpressionImplementationPtr& expressionPtr,
+            std::unordered_set<const ExpressionImplementation*>& visitedNodes,
+            std::map<int, std::vector<ExpressionImplementationPtr>>& foldableNodes
+        ) const {
+            if (!visitedNodes.insert(expressionPtr.get()).second) {
+                return;
+            }
+            if (hasConstantOperands(expressionPtr)) {
+                if (!_unfoldableNodes.count(expressionPtr.get())) {
+                    foldableNodes[expressionPtr->numParameters()].push_back(expressionPtr);
+                }
+                return;
+            }
+            for (const ExpressionImplementationPtr& operandPtr : operands(expressionPtr)) {
+                collectFoldableNodes(operandPtr, visitedNodes, foldableNodes);
+            }
+        }
+
+        bool
+        Simplifier::collectDependentNodes(
+            const ExpressionImplementationPtr& expressionPtr,
+            const std::unordered_set<const ExpressionImplementation*>& foldedNodes,
+            std::unordered_map<const ExpressionImplementation*, bool>& dependentNodes
+        ) {
+            auto iterator = dependentNodes.find(expressionPtr.get());
+            if (iterator != dependentNodes.end()) {
+                return iterator->second;
+            }
+            bool isDependent = foldedNodes.count(expressionPtr.get()) > 0;
+            if (!isDependent) {
+                for (const ExpressionImplementationPtr& operandPtr : operands(expressionPtr)) {
+                    // Visit every operand (even once a dependent one has been found) so that all
+                    // dependent nodes in the graph are recorded
+                    if (collectDependentNodes(operandPtr, foldedNodes, dependentNodes)) {
+                        isDependent = true;
+                    }
+                }
+            }
+            dependentNodes[expressionPtr.get()] = isDependent;
+            return isDependent;
+        }
+
+        Simplifier::Simplifier() {
+        }
+
+        ExpressionImplementationPtr
+        Simplifier::simplified(const ExpressionImplementationPtr& expressionPtr) {
+            collectNodes(expressionPtr, _inputNodes);
+            ExpressionImplementationPtr resultPtr = simplifiedNode(expressionPtr);
+
+            // Folding constants may enable further rewrites (and those may produce new constant
+            // subexpressions), so alternate the two until nothing more can be folded
+            while (foldedConstants(resultPtr)) {
+                resultPtr = simplifiedNode(expressionPtr);
+            }
+            collectNodes(resultPtr, _outputNodes);
+            _statistics.numInputNodes = int(_inputNodes.size());
+            _statistics.numOutputNodes = int(_outputNodes.size());
+            return resultPtr;
+        }
+
+        Simplifier::Statistics
+        Simplifier::totalStatistics() {
+            std::lock_guard<std::mutex> lock(totalStatisticsMutex());
+            return totalStatisticsInstance();
+        }
+
+        void
+        Simplifier::resetTotalStatistics() {
+            std::lock_guard<std::mutex> lock(totalStatisticsMutex());
+            totalStatisticsInstance() = Statistics();
+        }
+
+        Simplifier::~Simplifier() {
+            std::lock_guard<std::mutex> lock(totalStatisticsMutex());
+            totalStatisticsInstance() += _statistics;
+        }
+    }
+}
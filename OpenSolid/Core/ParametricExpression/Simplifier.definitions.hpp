@@ -0,0 +1,178 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#pragma once
+
+#include <OpenSolid/config.hpp>
+
+#include <OpenSolid/Core/ParametricExpression/Simplifier.declarations.hpp>
+
+#include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.declarations.hpp>
+
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace opensolid
+{
+    namespace detail
+    {
+        // Algebraic simplification pass run over expression graphs before they are compiled.
+        // Every node is rebuilt bottom-up from its simplified operands (which re-applies the
+        // simplifications performed by the expression construction operators, such as
+        // dropping multiplication by one), then a set of rewrite rules is applied until none
+        // matches. Constant subexpressions are then replaced by their values (all of those found
+        // in one pass are evaluated together) and the result simplified again until nothing
+        // more can be folded. Shared subexpressions stay shared as long as the same Simplifier
+        // is used.
+        class Simplifier
+        {
+        public:
+            struct Statistics
+            {
+                // Number of distinct nodes in the input and output graphs
+                int numInputNodes;
+                int numOutputNodes;
+
+                // Nodes with only constant operands replaced by their value
+                int numConstantFolds;
+
+                // Nodes that collapsed to one of their own operands when rebuilt (x * 1, x + 0)
+                int numIdentityEliminations;
+
+                // Scalings/transformations/negations of translations rewritten so that chains
+                // of affine operations collapse into a single transformation and translation
+                int numAffineMerges;
+
+                // sqrt(x.squaredNorm()) rewritten to x.norm()
+                int numNormRewrites;
+
+                // Additions/subtractions of negated operands rewritten (x + -y to x - y etc.)
+                int numNegationRewrites;
+
+                // Sums/differences of duplicate operands rewritten (x - x to 0, x + x to 2 * x)
+                int numDuplicateOperandRewrites;
+
+                OPENSOLID_CORE_EXPORT
+                Statistics();
+
+                OPENSOLID_CORE_EXPORT
+                Statistics&
+                operator+=(const Statistics& other);
+            };
+        private:
+            typedef std::pair<ExpressionImplementationPtr, ExpressionImplementationPtr> CacheEntry;
+
+            // Simplified versions of already-visited nodes, keyed by the original node (which is
+            // also stored in the entry to ensure that it is not destroyed and its address reused)
+            std::unordered_map<const ExpressionImplementation*, CacheEntry> _cache;
+            std::unordered_set<const ExpressionImplementation*> _inputNodes;
+            std::unordered_set<const ExpressionImplementation*> _outputNodes;
+
+            // Constant subexpressions that failed to evaluate (or evaluated to NaN), so that
+            // they are not evaluated again on every folding pass
+            std::unordered_map<const ExpressionImplementation*, ExpressionImplementationPtr>
+                _unfoldableNodes;
+
+            Statistics _statistics;
+
+            OPENSOLID_CORE_EXPORT
+            ExpressionImplementationPtr
+            simplifiedNode(const ExpressionImplementationPtr& expressionPtr);
+
+            OPENSOLID_CORE_EXPORT
+            ExpressionImplementationPtr
+            rebuilt(const ExpressionImplementationPtr& expressionPtr);
+
+            // Evaluates the given constant expressions (which must all have the same number of
+            // parameters) with a single evaluator, returning false if evaluation fails
+            OPENSOLID_CORE_EXPORT
+            static bool
+            evaluatedConstants(
+                const std::vector<ExpressionImplementationPtr>& expressions,
+                std::vector<double>& values
+            );
+
+            // Replaces all constant subexpressions of an already-simplified expression with
+            // their values and re-simplifies everything that depends on them, returning false
+            // if nothing could be folded
+            OPENSOLID_CORE_EXPORT
+            bool
+            foldedConstants(const ExpressionImplementationPtr& expressionPtr);
+
+            OPENSOLID_CORE_EXPORT
+            void
+            collectFoldableNodes(
+                const ExpressionImplementationPtr& expressionPtr,
+                std::unordered_set<const ExpressionImplementation*>& visitedNodes,
+                std::map<int, std::vector<ExpressionImplementationPtr>>& foldableNodes
+            ) const;
+
+            OPENSOLID_CORE_EXPORT
+            static bool
+            collectDependentNodes(
+                const ExpressionImplementationPtr& expressionPtr,
+                const std::unordered_set<const ExpressionImplementation*>& foldedNodes,
+                std::unordered_map<const ExpressionImplementation*, bool>& dependentNodes
+            );
+
+            OPENSOLID_CORE_EXPORT
+            ExpressionImplementationPtr
+            rewritten(const ExpressionImplementationPtr& expressionPtr);
+
+            OPENSOLID_CORE_EXPORT
+            static void
+            collectNodes(
+                const ExpressionImplementationPtr& expressionPtr,
+                std::unordered_set<const ExpressionImplementation*>& nodes
+            );
+        public:
+            OPENSOLID_CORE_EXPORT
+            Simplifier();
+
+            OPENSOLID_CORE_EXPORT
+            ExpressionImplementationPtr
+            simplified(const ExpressionImplementationPtr& expressionPtr);
+
+            // Statistics accumulated over all simplified() calls on this Simplifier
+            const Statistics&
+            statistics() const;
+
+            // Statistics accumulated over all Simplifiers that have been destroyed (including
+            // those used internally when compiling expressions)
+            OPENSOLID_CORE_EXPORT
+            static Statistics
+            totalStatistics();
+
+            OPENSOLID_CORE_EXPORT
+            static void
+            resetTotalStatistics();
+
+            OPENSOLID_CORE_EXPORT
+            ~Simplifier();
+        };
+    }
+}
@@ -25,8 +25,11 @@
 #include <OpenSolid/Core/ParametricExpression/SquareRootExpression.hpp>
 
 #include <OpenSolid/Core/Error.hpp>
+#include <OpenSolid/Core/ParametricExpression/Contractor.hpp>
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
 
+#include <limits>
+
 namespace opensolid
 { 
     namespace detail
@@ -36,88 +39,40 @@ namespace opensolid
             return 1;
         }
         
-        void
-        SquareRootExpression::evaluateImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
+        std::vector<int>
+        SquareRootExpression::compileImpl(
+            const std::vector<int>& parameterRegisters,
+            Compiler& compiler
         ) const {
-            expressionCompiler.evaluate(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                resultID,
-                [] (MatrixViewXd results) {
-                    results.setMap(
-                        results,
-                        [] (double value) {
-                            if (value >= 0.0) {
-                                return opensolid::sqrt(value);
-                            } else if (value == Zero()) {
-                                return 0.0;
-                            } else {
-                                throw Error(new PlaceholderError());
-                            }
-                        }
-                    );
-                }
-            );
-        }
-        
-        void
-        SquareRootExpression::evaluateImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
-        ) const {
-            expressionCompiler.evaluate(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                resultID,
-                [] (IntervalMatrixViewXd results) {
-                    results.setMap(
-                        results,
-                        [] (Interval value) {
-                            return opensolid::sqrt(value);
-                        }
-                    );
-                }
-            );
+            int operandRegister = compiler.evaluate(operand(), parameterRegisters).front();
+            return std::vector<int>(1, compiler.compute(Bytecode::SQRT, operandRegister));
         }
 
-        void
-        SquareRootExpression::evaluateJacobianImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            expressionCompiler.evaluateJacobian(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(operand(), parameterID),
-                resultID,
-                [] (ConstMatrixViewXd operandValues, MatrixViewXd results) {
-                    double operandValue = operandValues.value();
-                    if (operandValue > 0.0) {
-                        results *= (0.5 / opensolid::sqrt(operandValue));
-                    } else {
-                        throw Error(new PlaceholderError());
-                    }
-                }
-            );
+        std::vector<Interval>
+        SquareRootExpression::boundsImpl(Contractor& contractor) const {
+            const std::vector<Interval>& operandBounds = contractor.bounds(operand());
+            return std::vector<Interval>(1, opensolid::sqrt(operandBounds.front()));
         }
-        
+
         void
-        SquareRootExpression::evaluateJacobianImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        SquareRootExpression::contractImpl(
+            const std::vector<Interval>& bounds,
+            Contractor& contractor
         ) const {
-            expressionCompiler.evaluateJacobian(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(operand(), parameterID),
-                resultID,
-                [] (ConstIntervalMatrixViewXd operandValues, IntervalMatrixViewXd results) {
-                    Interval operandValue = operandValues.value();
-                    results *= (0.5 / opensolid::sqrt(operandValue));
-                }
+            double infinity = std::numeric_limits<double>::infinity();
+            Interval nonNegative = bounds.front().intersection(Interval(0.0, infinity));
+            if (nonNegative.isEmpty()) {
+                contractor.narrow(operand(), 0, Interval::EMPTY());
+                return;
+            }
+            // A zero square root could be the result of a slightly negative argument
+            double lowerBound = nonNegative.lowerBound();
+            double upperBound = nonNegative.upperBound();
+            Interval operandBounds(
+                lowerBound > 0.0 ? lowerBound * lowerBound : -infinity,
+                upperBound * upperBound
             );
+            contractor.narrow(operand(), 0, operandBounds);
         }
 
         ExpressionImplementationPtr
@@ -24,6 +24,7 @@
 
 #include <OpenSolid/Core/ParametricExpression/SquaredNormExpression.hpp>
 
+#include <OpenSolid/Core/ParametricExpression/Contractor.hpp>
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
 
 namespace opensolid
@@ -35,90 +36,39 @@ namespace opensolid
             return 1;
         }
         
-        void
-        SquaredNormExpression::evaluateImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(operand(), parameterID),
-                resultID,
-                [] (ConstMatrixViewXd operandValues, MatrixViewXd results) {
-                    for (int columnIndex = 0; columnIndex < results.numColumns(); ++columnIndex) {
-                        results(0, columnIndex) = operandValues.column(columnIndex).fold(
-                            0.0,
-                            [] (double result, double value) {
-                                return result + value * value;
-                            }
-                        );
-                    }
-                }
-            );
-        }
-        
-        void
-        SquaredNormExpression::evaluateImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        std::vector<int>
+        SquaredNormExpression::compileImpl(
+            const std::vector<int>& parameterRegisters,
+            Compiler& compiler
         ) const {
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(operand(), parameterID),
-                resultID,
-                [] (ConstIntervalMatrixViewXd operandValues, IntervalMatrixViewXd results) {
-                    for (int columnIndex = 0; columnIndex < results.numColumns(); ++columnIndex) {
-                        results(0, columnIndex) = operandValues.column(columnIndex).fold(
-                            Interval(0.0),
-                            [] (Interval result, Interval value) {
-                                return result + value * value;
-                            }
-                        );
-                    }
-                }
-            );
+            std::vector<int> operandRegisters = compiler.evaluate(operand(), parameterRegisters);
+            int squaredNormRegister = compiler.compute(Bytecode::SQUARE, operandRegisters.front());
+            for (std::size_t index = 1; index < operandRegisters.size(); ++index) {
+                squaredNormRegister = compiler.compute(
+                    Bytecode::ADD,
+                    squaredNormRegister,
+                    compiler.compute(Bytecode::SQUARE, operandRegisters[index])
+                );
+            }
+            return std::vector<int>(1, squaredNormRegister);
         }
 
-        void
-        SquaredNormExpression::evaluateJacobianImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(operand(), parameterID),
-                expressionCompiler.evaluateJacobian(operand(), parameterID),
-                resultID,
-                [] (
-                    ConstMatrixViewXd operandValues,
-                    ConstMatrixViewXd operandJacobian,
-                    MatrixViewXd results
-                ) {
-                    results.setTransposeProduct(operandValues, operandJacobian);
-                    results *= 2.0;
-                }
-            );
+        std::vector<Interval>
+        SquaredNormExpression::boundsImpl(Contractor& contractor) const {
+            const std::vector<Interval>& operandBounds = contractor.bounds(operand());
+            Interval result(0.0);
+            for (Interval componentBounds : operandBounds) {
+                result += componentBounds.squared();
+            }
+            return std::vector<Interval>(1, result);
         }
-        
+
         void
-        SquaredNormExpression::evaluateJacobianImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        SquaredNormExpression::contractImpl(
+            const std::vector<Interval>& bounds,
+            Contractor& contractor
         ) const {
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(operand(), parameterID),
-                expressionCompiler.evaluateJacobian(operand(), parameterID),
-                resultID,
-                [] (
-                    ConstIntervalMatrixViewXd operandValues,
-                    ConstIntervalMatrixViewXd operandJacobian,
-                    IntervalMatrixViewXd results
-                ) {
-                    results.setTransposeProduct(operandValues, operandJacobian);
-                    results *= 2.0;
-                }
-            );
+            contractor.narrowSquaredNorm(operand(), bounds.front());
         }
 
         ExpressionImplementationPtr
@@ -24,6 +24,7 @@
 
 #include <OpenSolid/Core/ParametricExpression/TransformationExpression.hpp>
 
+#include <OpenSolid/Core/ParametricExpression/Contractor.hpp>
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
 
 namespace opensolid
@@ -35,82 +36,87 @@ namespace opensolid
             return int(matrix().numRows());
         }
         
-        void
-        TransformationExpression::evaluateImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            MatrixXd transformationMatrix = this->matrix();
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(operand(), parameterID),
-                resultID,
-                [transformationMatrix] (
-                    ConstMatrixViewXd operandValues,
-                    MatrixViewXd results
-                ) {
-                    results.setProduct(transformationMatrix, operandValues);
-                }
-            );
-        }
-        
-        void
-        TransformationExpression::evaluateImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        std::vector<int>
+        TransformationExpression::compileImpl(
+            const std::vector<int>& parameterRegisters,
+            Compiler& compiler
         ) const {
-            MatrixXd transformationMatrix = this->matrix();
-            expressionCompiler.compute(
-                expressionCompiler.evaluate(operand(), parameterID),
-                resultID,
-                [transformationMatrix] (
-                    ConstIntervalMatrixViewXd operandValues,
-                    IntervalMatrixViewXd results
-                ) {
-                    results.setProduct(transformationMatrix, operandValues);
+            std::vector<int> operandRegisters = compiler.evaluate(operand(), parameterRegisters);
+            const MatrixXd& matrix = this->matrix();
+            std::vector<int> results(numDimensions());
+            for (int rowIndex = 0; rowIndex < matrix.numRows(); ++rowIndex) {
+                // Skip zero coefficients entirely, so sparse matrices (such as axis-aligned
+                // projections) only generate the instructions they actually need
+                int resultRegister = -1;
+                for (int columnIndex = 0; columnIndex < matrix.numColumns(); ++columnIndex) {
+                    double coefficient = matrix(rowIndex, columnIndex);
+                    if (coefficient == 0.0) {
+                        continue;
+                    }
+                    int termRegister = operandRegisters[columnIndex];
+                    if (coefficient != 1.0) {
+                        termRegister = compiler.compute(
+                            Bytecode::MULTIPLY,
+                            compiler.constant(coefficient),
+                            termRegister
+                        );
+                    }
+                    if (resultRegister < 0) {
+                        resultRegister = termRegister;
+                    } else {
+                        resultRegister = compiler.compute(
+                            Bytecode::ADD,
+                            resultRegister,
+                            termRegister
+                        );
+                    }
                 }
-            );
+                results[rowIndex] = resultRegister < 0 ? compiler.constant(0.0) : resultRegister;
+            }
+            return results;
         }
 
-        void
-        TransformationExpression::evaluateJacobianImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            MatrixXd transformationMatrix = this->matrix();
-            expressionCompiler.compute(
-                expressionCompiler.evaluateJacobian(operand(), parameterID),
-                resultID,
-                [transformationMatrix] (
-                    ConstMatrixViewXd operandJacobian,
-                    MatrixViewXd results
-                ) {
-                    results.setProduct(transformationMatrix, operandJacobian);
+        std::vector<Interval>
+        TransformationExpression::boundsImpl(Contractor& contractor) const {
+            const std::vector<Interval>& operandBounds = contractor.bounds(operand());
+            int numColumns = int(operandBounds.size());
+            std::vector<Interval> results(numDimensions(), Interval(0.0));
+            for (int rowIndex = 0; rowIndex < numDimensions(); ++rowIndex) {
+                for (int columnIndex = 0; columnIndex < numColumns; ++columnIndex) {
+                    double coefficient = matrix()(rowIndex, columnIndex);
+                    if (coefficient != 0.0) {
+                        results[rowIndex] += coefficient * operandBounds[columnIndex];
+                    }
                 }
-            );
+            }
+            return results;
         }
-        
+
         void
-        TransformationExpression::evaluateJacobianImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        TransformationExpression::contractImpl(
+            const std::vector<Interval>& bounds,
+            Contractor& contractor
         ) const {
-            MatrixXd transformationMatrix = this->matrix();
-            expressionCompiler.compute(
-                expressionCompiler.evaluateJacobian(operand(), parameterID),
-                resultID,
-                [transformationMatrix] (
-                    ConstIntervalMatrixViewXd operandJacobian,
-                    IntervalMatrixViewXd results
-                ) {
-                    results.setProduct(transformationMatrix, operandJacobian);
+            const std::vector<Interval>& operandBounds = contractor.bounds(operand());
+            int numColumns = int(operandBounds.size());
+            for (int rowIndex = 0; rowIndex < numDimensions(); ++rowIndex) {
+                for (int columnIndex = 0; columnIndex < numColumns; ++columnIndex) {
+                    double coefficient = matrix()(rowIndex, columnIndex);
+                    if (coefficient == 0.0) {
+                        continue;
+                    }
+                    // Solve the row for this component, in terms of all other components
+                    Interval remainder = bounds[rowIndex];
+                    for (int otherIndex = 0; otherIndex < numColumns; ++otherIndex) {
+                        if (otherIndex != columnIndex) {
+                            remainder -= matrix()(rowIndex, otherIndex) * operandBounds[otherIndex];
+                        }
+                    }
+                    contractor.narrow(operand(), columnIndex, remainder / coefficient);
                 }
-            );
+            }
         }
-        
+
         ExpressionImplementationPtr
         TransformationExpression::derivativeImpl(int parameterIndex) const {
             return matrix() * operand()->derivative(parameterIndex);
@@ -120,8 +126,19 @@ namespace opensolid
         TransformationExpression::isDuplicateOfImpl(
             const ExpressionImplementationPtr& other
         ) const {
-            MatrixXd otherMatrix = other->cast<TransformationExpression>()->matrix();
-            return duplicateOperands(other) && (matrix() - otherMatrix).isZero();
+            return (
+                duplicateOperands(other) &&
+                matrix() == other->cast<TransformationExpression>()->matrix()
+            );
+        }
+
+        std::size_t
+        TransformationExpression::structuralHashImpl() const {
+            std::size_t result = operand()->structuralHash();
+            for (int index = 0; index < matrix().numComponents(); ++index) {
+                result = combineHashes(result, hashValue(matrix().component(index)));
+            }
+            return result;
         }
 
         ExpressionImplementationPtr
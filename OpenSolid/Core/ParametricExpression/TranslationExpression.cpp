@@ -24,6 +24,7 @@
 
 #include <OpenSolid/Core/ParametricExpression/TranslationExpression.hpp>
 
+#include <OpenSolid/Core/ParametricExpression/Contractor.hpp>
 #include <OpenSolid/Core/ParametricExpression/ExpressionImplementation.hpp>
 
 namespace opensolid
@@ -35,60 +36,42 @@ namespace opensolid
             return int(columnMatrix().numRows());
         }
         
-        void
-        TranslationExpression::evaluateImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            ColumnMatrixXd columnMatrix = this->columnMatrix();
-            expressionCompiler.evaluate(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                resultID,
-                [columnMatrix] (MatrixViewXd results) {
-                    for (int columnIndex = 0; columnIndex < results.numColumns(); ++columnIndex) {
-                        results.column(columnIndex) += columnMatrix;
-                    }
-                }
-            );
-        }
-        
-        void
-        TranslationExpression::evaluateImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        std::vector<int>
+        TranslationExpression::compileImpl(
+            const std::vector<int>& parameterRegisters,
+            Compiler& compiler
         ) const {
-            ColumnMatrixXd columnMatrix = this->columnMatrix();
-            expressionCompiler.evaluate(operand(), parameterID, resultID);
-            expressionCompiler.compute(
-                resultID,
-                [columnMatrix] (IntervalMatrixViewXd results) {
-                    for (int columnIndex = 0; columnIndex < results.numColumns(); ++columnIndex) {
-                        results.column(columnIndex) += columnMatrix;
-                    }
-                }
-            );
+            std::vector<int> results = compiler.evaluate(operand(), parameterRegisters);
+            for (int index = 0; index < numDimensions(); ++index) {
+                results[index] = compiler.compute(
+                    Bytecode::ADD,
+                    results[index],
+                    compiler.constant(columnMatrix()(index))
+                );
+            }
+            return results;
         }
 
-        void
-        TranslationExpression::evaluateJacobianImpl(
-            const MatrixID<const double>& parameterID,
-            const MatrixID<double>& resultID,
-            ExpressionCompiler<double>& expressionCompiler
-        ) const {
-            expressionCompiler.evaluateJacobian(operand(), parameterID, resultID);
+        std::vector<Interval>
+        TranslationExpression::boundsImpl(Contractor& contractor) const {
+            const std::vector<Interval>& operandBounds = contractor.bounds(operand());
+            std::vector<Interval> results(numDimensions());
+            for (int index = 0; index < numDimensions(); ++index) {
+                results[index] = operandBounds[index] + columnMatrix()(index);
+            }
+            return results;
         }
-        
+
         void
-        TranslationExpression::evaluateJacobianImpl(
-            const MatrixID<const Interval>& parameterID,
-            const MatrixID<Interval>& resultID,
-            ExpressionCompiler<Interval>& expressionCompiler
+        TranslationExpression::contractImpl(
+            const std::vector<Interval>& bounds,
+            Contractor& contractor
         ) const {
-            expressionCompiler.evaluateJacobian(operand(), parameterID, resultID);
+            for (int index = 0; index < numDimensions(); ++index) {
+                contractor.narrow(operand(), index, bounds[index] - columnMatrix()(index));
+            }
         }
-        
+
         ExpressionImplementationPtr
         TranslationExpression::derivativeImpl(int parameterIndex) const {
             return operand()->derivative(parameterIndex);
@@ -98,10 +81,19 @@ namespace opensolid
         TranslationExpression::isDuplicateOfImpl(const ExpressionImplementationPtr& other) const {
             return (
                 duplicateOperands(other) &&
-                (columnMatrix() - other->cast<TranslationExpression>()->columnMatrix()).isZero()
+                columnMatrix() == other->cast<TranslationExpression>()->columnMatrix()
             );
         }
 
+        std::size_t
+        TranslationExpression::structuralHashImpl() const {
+            std::size_t result = operand()->structuralHash();
+            for (int index = 0; index < columnMatrix().numComponents(); ++index) {
+                result = combineHashes(result, hashValue(columnMatrix().component(index)));
+            }
+            return result;
+        }
+
         ExpressionImplementationPtr
         TranslationExpression::translationImpl(const ColumnMatrixXd& columnMatrix) const {
             return operand() + (this->columnMatrix() + columnMatrix);
@@ -45,6 +45,11 @@ namespace opensolid
             return this->withNewOperand(operand()->composed(innerExpression));
         }
 
+        std::size_t
+        UnaryOperation::structuralHashImpl() const {
+            return operand()->structuralHash();
+        }
+
         bool
         UnaryOperation::duplicateOperands(const ExpressionImplementationPtr& other) const {
             return this->operand()->isDuplicateOf(other->cast<UnaryOperation>()->operand());
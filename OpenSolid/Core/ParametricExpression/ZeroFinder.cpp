@@ -0,0 +1,209 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#include <OpenSolid/Core/ParametricExpression/ZeroFinder.hpp>
+
+#include <OpenSolid/Core/Error.hpp>
+#include <OpenSolid/Core/ParametricExpression/CompiledExpression.hpp>
+#include <OpenSolid/Core/Zero.hpp>
+
+#include <cmath>
+
+namespace opensolid
+{
+    namespace detail
+    {
+        void
+        ZeroFinder::evaluate(
+            Interval interval,
+            Interval& bounds,
+            Interval& derivativeBounds
+        ) const {
+            Interval results[2];
+            ConstIntervalMatrixViewXd parameterView(&interval, 1, 1, sizeof(Interval));
+            IntervalMatrixViewXd resultView(results, 2, 1, 2 * sizeof(Interval));
+            try {
+                _compiledExpression.evaluateWithJacobian(parameterView, resultView);
+            } catch (const Error&) {
+                // Could not prove that the expression is nonzero over the interval; treat it as
+                // completely unknown so that it gets subdivided
+                bounds = Interval::WHOLE();
+                derivativeBounds = Interval::WHOLE();
+                return;
+            }
+            bounds = results[0];
+            derivativeBounds = results[1];
+        }
+
+        Interval
+        ZeroFinder::evaluate(double parameterValue) const {
+            Interval parameterBounds(parameterValue);
+            Interval result;
+            ConstIntervalMatrixViewXd parameterView(&parameterBounds, 1, 1, sizeof(Interval));
+            IntervalMatrixViewXd resultView(&result, 1, 1, sizeof(Interval));
+            try {
+                _compiledExpression.evaluate(parameterView, resultView);
+            } catch (const Error&) {
+                return Interval::WHOLE();
+            }
+            return result;
+        }
+
+        double
+        ZeroFinder::refined(Interval interval) const {
+            // Point Newton iteration from the center of an interval known to contain at most
+            // one zero, stopping if an iterate would leave the interval
+            double parameterValue = interval.median();
+            for (int iteration = 0; iteration < 8; ++iteration) {
+                Interval value;
+                Interval derivative;
+                evaluate(Interval(parameterValue), value, derivative);
+                double step = value.median() / derivative.median();
+                double next = parameterValue - step;
+                if (!(std::abs(step) > 0.0) || !interval.contains(next, 0.0)) {
+                    break;
+                }
+                parameterValue = next;
+            }
+            return parameterValue;
+        }
+
+        void
+        ZeroFinder::isolate(
+            Interval domain,
+            double zeroPrecision,
+            std::vector<Interval>& isolations
+        ) const {
+            // Depth-first, always processing the lower half of a bisected interval first, so
+            // that isolated intervals are produced in increasing order
+            std::vector<Interval> stack(1, domain);
+            while (!stack.empty()) {
+                Interval interval = stack.back();
+                stack.pop_back();
+
+                Interval bounds;
+                Interval derivativeBounds;
+                evaluate(interval, bounds, derivativeBounds);
+                double median = interval.median();
+                Interval medianValue = evaluate(median);
+
+                // Use the mean value form as well as the natural bounds, since it is much
+                // tighter for small intervals
+                Interval centered = medianValue + derivativeBounds * (interval - median);
+                Interval intersection = bounds.intersection(centered);
+                if (!intersection.isEmpty()) {
+                    bounds = intersection;
+                }
+                if (bounds.isEmpty() || !bounds.overlaps(Interval(0.0), zeroPrecision)) {
+                    continue;
+                }
+                if (bounds == Zero(zeroPrecision)) {
+                    // Zero (to within precision) over the entire interval, so there is no point
+                    // subdividing further
+                    isolations.push_back(interval);
+                    continue;
+                }
+
+                bool isMonotonic = (
+                    derivativeBounds.lowerBound() > 0.0 ||
+                    derivativeBounds.upperBound() < 0.0
+                );
+                if (isMonotonic) {
+                    // Any zero is unique, and must lie within the Newton image of the interval
+                    Interval target = medianValue + Interval(-zeroPrecision, zeroPrecision);
+                    Interval newton = median - target / derivativeBounds;
+                    Interval contracted = interval.intersection(newton);
+                    if (contracted.isEmpty()) {
+                        continue;
+                    }
+                    if (contracted.width() <= _tolerance) {
+                        isolations.push_back(contracted);
+                        continue;
+                    }
+                    if (contracted.width() < 0.5 * interval.width()) {
+                        stack.push_back(contracted);
+                        continue;
+                    }
+                    interval = contracted;
+                }
+
+                std::pair<Interval, Interval> halves = interval.bisected();
+                bool canBisect = (
+                    halves.first.width() < interval.width() &&
+                    halves.second.width() < interval.width()
+                );
+                if (interval.width() <= _tolerance || !canBisect) {
+                    isolations.push_back(interval);
+                    continue;
+                }
+                stack.push_back(halves.second);
+                stack.push_back(halves.first);
+            }
+        }
+
+        ZeroFinder::ZeroFinder(const CompiledExpression& compiledExpression, double tolerance) :
+            _compiledExpression(compiledExpression),
+            _tolerance(tolerance) {
+
+            if (!(tolerance > 0.0)) {
+                throw Error(new PlaceholderError());
+            }
+        }
+
+        std::vector<double>
+        ZeroFinder::zeros(Interval domain) const {
+            std::vector<Interval> isolations;
+            if (!domain.isEmpty()) {
+                ConstIntervalMatrixViewXd domainView(&domain, 1, 1, sizeof(Interval));
+                double zeroPrecision = _compiledExpression.zeroPrecisions(domainView).front();
+                isolate(domain, zeroPrecision, isolations);
+            }
+
+            // Touching intervals (for instance on either side of a bisection point that is
+            // itself a zero, or covering a multiple zero) are merged into a single zero
+            std::vector<double> results;
+            std::size_t index = 0;
+            while (index < isolations.size()) {
+                Interval hull = isolations[index];
+                ++index;
+                while (index < isolations.size()) {
+                    if (isolations[index].lowerBound() > hull.upperBound()) {
+                        break;
+                    }
+                    hull = hull.hull(isolations[index]);
+                    ++index;
+                }
+                Interval bounds;
+                Interval derivativeBounds;
+                evaluate(hull, bounds, derivativeBounds);
+                bool isMonotonic = (
+                    derivativeBounds.lowerBound() > 0.0 ||
+                    derivativeBounds.upperBound() < 0.0
+                );
+                results.push_back(isMonotonic ? refined(hull) : hull.median());
+            }
+            return results;
+        }
+    }
+}
@@ -28,6 +28,6 @@ namespace opensolid
 {
     namespace detail
     {
-        class Variable;
+        class ZeroFinder;
     }
 }
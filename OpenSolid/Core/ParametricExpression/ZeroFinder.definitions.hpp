@@ -0,0 +1,79 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#pragma once
+
+#include <OpenSolid/config.hpp>
+
+#include <OpenSolid/Core/ParametricExpression/ZeroFinder.declarations.hpp>
+
+#include <OpenSolid/Core/Interval.definitions.hpp>
+#include <OpenSolid/Core/ParametricExpression/CompiledExpression.declarations.hpp>
+
+#include <vector>
+
+namespace opensolid
+{
+    namespace detail
+    {
+        // Isolates all zeros of a scalar expression of one parameter using interval bisection
+        // combined with the interval Newton operator. Subintervals are discarded once interval
+        // evaluation shows that they contain no zero; where the interval derivative excludes
+        // zero, the Newton operator contracts the subinterval towards its (unique) zero.
+        // Multiple zeros (where the derivative is also zero, as for tangential intersections)
+        // cannot be separated by Newton steps and are instead isolated by bisection down to
+        // the given tolerance, with adjacent subintervals merged into a single zero; each
+        // merged zero is refined using point Newton iteration when the derivative is known to
+        // be nonzero over it.
+        class ZeroFinder
+        {
+        private:
+            const CompiledExpression& _compiledExpression;
+            double _tolerance;
+
+            void
+            evaluate(Interval interval, Interval& bounds, Interval& derivativeBounds) const;
+
+            Interval
+            evaluate(double parameterValue) const;
+
+            double
+            refined(Interval interval) const;
+
+            void
+            isolate(
+                Interval domain,
+                double zeroPrecision,
+                std::vector<Interval>& isolations
+            ) const;
+        public:
+            OPENSOLID_CORE_EXPORT
+            ZeroFinder(const CompiledExpression& compiledExpression, double tolerance);
+
+            OPENSOLID_CORE_EXPORT
+            std::vector<double>
+            zeros(Interval domain) const;
+        };
+    }
+}
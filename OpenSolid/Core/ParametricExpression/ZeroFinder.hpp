@@ -24,11 +24,8 @@
 
 #pragma once
 
-namespace opensolid
-{
-    namespace  detail
-    {
-        template <class TScalar>
-        class EvaluationContext;
-    }
-}
+#include <OpenSolid/config.hpp>
+
+#include <OpenSolid/Core/ParametricExpression/ZeroFinder.definitions.hpp>
+
+#include <OpenSolid/Core/Interval.hpp>
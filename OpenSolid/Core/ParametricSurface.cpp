@@ -26,6 +26,8 @@
 
 #include <OpenSolid/Core/ParametricSurface.hpp>
 
+#include <OpenSolid/Core/SurfaceTessellator.hpp>
+
 namespace opensolid
 {
     ParametricSurface3d::ParametricSurface3d() {
@@ -51,7 +53,7 @@ namespace opensolid
     ) : _expression(expression),
         _domain(domain),
         _handedness(Handedness::RIGHT_HANDED()),
-        _bounds(expression.evaluate(domain.bounds())) {
+        _bounds(expression.evaluate(domain.bounds(), AFFINE_BOUNDS)) {
     }
 
     ParametricSurface3d::ParametricSurface3d(
@@ -61,7 +63,7 @@ namespace opensolid
     ) : _expression(expression),
         _domain(domain),
         _handedness(handedness),
-        _bounds(expression.evaluate(domain.bounds())) {
+        _bounds(expression.evaluate(domain.bounds(), AFFINE_BOUNDS)) {
     }
 
     Point3d
@@ -82,6 +84,11 @@ namespace opensolid
         );
     }
 
+    SurfaceMesh3d
+    ParametricSurface3d::tessellate(double chordTolerance, double angleTolerance) const {
+        return detail::SurfaceTessellator(*this, chordTolerance, angleTolerance).mesh();
+    }
+
     ParametricArea2d
     ParametricSurface3d::projectedInto(const Plane3d& plane) const {
         return ParametricArea2d(expression().projectedInto(plane), domain(), handedness());
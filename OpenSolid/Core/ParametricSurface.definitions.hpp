@@ -38,6 +38,7 @@
 #include <OpenSolid/Core/ParametricExpression.definitions.hpp>
 #include <OpenSolid/Core/Plane.declarations.hpp>
 #include <OpenSolid/Core/Point.definitions.hpp>
+#include <OpenSolid/Core/SurfaceMesh.declarations.hpp>
 #include <OpenSolid/Core/Transformable.definitions.hpp>
 #include <OpenSolid/Core/UnitVector.declarations.hpp>
 
@@ -110,6 +111,13 @@ namespace opensolid
         ParametricExpression<UnitVector<3>, Point<2>>
         normalVector() const;
 
+        // Triangle mesh within the given distance of this surface, trimmed to its domain, with
+        // the tangent directions turning by no more than the given angle (in radians) across
+        // each triangle. Throws if either tolerance is not positive.
+        OPENSOLID_CORE_EXPORT
+        SurfaceMesh3d
+        tessellate(double chordTolerance, double angleTolerance) const;
+
         template <class TTransformation>
         ParametricSurface3d
         transformedBy(const TTransformation& transformation) const;
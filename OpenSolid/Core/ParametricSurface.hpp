@@ -37,6 +37,7 @@
 #include <OpenSolid/Core/ParametricExpression.hpp>
 #include <OpenSolid/Core/Plane.hpp>
 #include <OpenSolid/Core/Point.hpp>
+#include <OpenSolid/Core/SurfaceMesh.hpp>
 #include <OpenSolid/Core/Transformable.hpp>
 #include <OpenSolid/Core/UnitVector.hpp>
 
@@ -51,7 +51,7 @@ namespace opensolid
     ) : _expression(expression),
         _domain(domain),
         _handedness(Handedness::RIGHT_HANDED()),
-        _bounds(expression.evaluate(domain.bounds())) {
+        _bounds(expression.evaluate(domain.bounds(), AFFINE_BOUNDS)) {
     }
 
     ParametricVolume3d::ParametricVolume3d(
@@ -61,7 +61,7 @@ namespace opensolid
     ) : _expression(expression),
         _domain(domain),
         _handedness(handedness),
-        _bounds(expression.evaluate(domain.bounds())) {
+        _bounds(expression.evaluate(domain.bounds(), AFFINE_BOUNDS)) {
     }
 
     Point3d
@@ -27,6 +27,8 @@
 
 namespace opensolid
 {
+    const int NumDimensions<double>::Value;
+
     bool
     Point2d::isOn(const LineSegment2d& lineSegment, double precision) const {
         Vector2d parallelVector = lineSegment.vector();
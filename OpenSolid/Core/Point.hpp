@@ -42,6 +42,9 @@
 
 namespace opensolid
 {
+    template <int iNumDimensions>
+    const int NumDimensions<Point<iNumDimensions>>::Value;
+
     namespace detail
     {
         template <int iNumDimensions>
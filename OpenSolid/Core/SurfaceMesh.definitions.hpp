@@ -26,44 +26,56 @@
 
 #include <OpenSolid/config.hpp>
 
-#include <OpenSolid/Core/ParametricExpression/EvaluationSequence.declarations.hpp>
+#include <OpenSolid/Core/SurfaceMesh.declarations.hpp>
 
-#include <OpenSolid/Core/MatrixView.declarations.hpp>
-#include <OpenSolid/Core/ParametricExpression/EvaluationOperation.definitions.hpp>
+#include <OpenSolid/Core/Point.definitions.hpp>
+#include <OpenSolid/Core/Triangle.declarations.hpp>
+#include <OpenSolid/Core/UnitVector.definitions.hpp>
 
 #include <vector>
 
 namespace opensolid
 {
-    namespace detail
+    // Indexed triangle mesh approximating a surface (see ParametricSurface3d::tessellate()).
+    // Each vertex has a position, a unit normal and the surface parameter values it was
+    // evaluated at. Each triangle is given by three consecutive entries in indices(), ordered
+    // counterclockwise when viewed from the side the normals point to.
+    class SurfaceMesh3d
     {
-        template <class TScalar>
-        class EvaluationSequence
-        {
-        private:
-            std::vector<EvaluationOperation<TScalar>> _evaluationOperations;
-            int _maxStackRows;
-            int _maxStackComponents;
-            int _numHeapRows;
-            int _numHeapComponents;
-            int _maxTemporaryMatrices;
-        public:
-            OPENSOLID_CORE_EXPORT
-            EvaluationSequence(
-                std::vector<EvaluationOperation<TScalar>> evaluationOperations,
-                int maxStackRows,
-                int maxStackComponents,
-                int numHeapRows,
-                int numHeapComponents,
-                int maxTemporaryMatrices
-            );
+    private:
+        std::vector<Point<3>> _vertices;
+        std::vector<UnitVector<3>> _normals;
+        std::vector<Point<2>> _parameterValues;
+        std::vector<int> _indices;
+    public:
+        SurfaceMesh3d();
 
-            OPENSOLID_CORE_EXPORT   
-            void
-            execute(
-                const MatrixView<const TScalar, -1, -1, -1>& parameterView,
-                MatrixView<TScalar, -1, -1, -1>& resultView
-            ) const;
-        };
-    }
+        SurfaceMesh3d(
+            std::vector<Point<3>>&& vertices,
+            std::vector<UnitVector<3>>&& normals,
+            std::vector<Point<2>>&& parameterValues,
+            std::vector<int>&& indices
+        );
+
+        const std::vector<Point<3>>&
+        vertices() const;
+
+        const std::vector<UnitVector<3>>&
+        normals() const;
+
+        const std::vector<Point<2>>&
+        parameterValues() const;
+
+        const std::vector<int>&
+        indices() const;
+
+        bool
+        isEmpty() const;
+
+        int
+        numTriangles() const;
+
+        Triangle<3>
+        triangle(int index) const;
+    };
 }
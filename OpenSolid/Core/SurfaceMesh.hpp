@@ -0,0 +1,100 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#pragma once
+
+#include <OpenSolid/config.hpp>
+
+#include <OpenSolid/Core/SurfaceMesh.definitions.hpp>
+
+#include <OpenSolid/Core/Point.hpp>
+#include <OpenSolid/Core/Triangle.hpp>
+#include <OpenSolid/Core/UnitVector.hpp>
+
+#include <utility>
+
+namespace opensolid
+{
+    inline
+    SurfaceMesh3d::SurfaceMesh3d() {
+    }
+
+    inline
+    SurfaceMesh3d::SurfaceMesh3d(
+        std::vector<Point<3>>&& vertices,
+        std::vector<UnitVector<3>>&& normals,
+        std::vector<Point<2>>&& parameterValues,
+        std::vector<int>&& indices
+    ) : _vertices(std::move(vertices)),
+        _normals(std::move(normals)),
+        _parameterValues(std::move(parameterValues)),
+        _indices(std::move(indices)) {
+    }
+
+    inline
+    const std::vector<Point<3>>&
+    SurfaceMesh3d::vertices() const {
+        return _vertices;
+    }
+
+    inline
+    const std::vector<UnitVector<3>>&
+    SurfaceMesh3d::normals() const {
+        return _normals;
+    }
+
+    inline
+    const std::vector<Point<2>>&
+    SurfaceMesh3d::parameterValues() const {
+        return _parameterValues;
+    }
+
+    inline
+    const std::vector<int>&
+    SurfaceMesh3d::indices() const {
+        return _indices;
+    }
+
+    inline
+    bool
+    SurfaceMesh3d::isEmpty() const {
+        return _indices.empty();
+    }
+
+    inline
+    int
+    SurfaceMesh3d::numTriangles() const {
+        return int(_indices.size() / 3);
+    }
+
+    inline
+    Triangle<3>
+    SurfaceMesh3d::triangle(int index) const {
+        return Triangle<3>(
+            _vertices[_indices[3 * index]],
+            _vertices[_indices[3 * index + 1]],
+            _vertices[_indices[3 * index + 2]]
+        );
+    }
+}
@@ -0,0 +1,625 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#include <OpenSolid/Core/SurfaceTessellator.hpp>
+
+#include <OpenSolid/Core/BoundedArea.hpp>
+#include <OpenSolid/Core/Error.hpp>
+#include <OpenSolid/Core/Interval.hpp>
+#include <OpenSolid/Core/ParametricCurve.hpp>
+#include <OpenSolid/Core/ParametricCurve/CurveTessellator.hpp>
+#include <OpenSolid/Core/ParametricExpression.hpp>
+#include <OpenSolid/Core/SpatialSet.hpp>
+#include <OpenSolid/Core/ThreadPool.hpp>
+#include <OpenSolid/Core/UnitVector.hpp>
+#include <OpenSolid/Core/Vector.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <set>
+#include <unordered_map>
+#include <utility>
+
+namespace opensolid
+{
+    namespace
+    {
+        // Maximum number of times the parameter domain is bisected in each direction
+        const int MAX_DEPTH = 12;
+
+        // Number of cells along each side of the domain at the maximum depth; cell corners have
+        // integer coordinates in [0, GRID_SIZE] so that shared vertices are found exactly
+        const int GRID_SIZE = 1 << MAX_DEPTH;
+
+        // Minimum number of cells or vertices handled by each parallel task
+        const int CHUNK_SIZE = 16;
+
+        enum CellStatus
+        {
+            OUTSIDE_CELL,
+            INSIDE_CELL,
+            CROSSING_CELL,
+            REFINED_CELL
+        };
+
+        // Square quadtree cell in integer grid coordinates
+        struct Cell
+        {
+            int x;
+            int y;
+            int size;
+
+            Cell(int cellX, int cellY, int cellSize) :
+                x(cellX),
+                y(cellY),
+                size(cellSize) {
+            }
+        };
+
+        Point2d
+        gridPoint(const Box2d& domainBounds, int x, int y) {
+            return domainBounds.interpolated(double(x) / GRID_SIZE, double(y) / GRID_SIZE);
+        }
+
+        Box2d
+        cellBounds(const Box2d& domainBounds, const Cell& cell) {
+            double scale = 1.0 / GRID_SIZE;
+            Interval xInterval(scale * cell.x, scale * (cell.x + cell.size));
+            Interval yInterval(scale * cell.y, scale * (cell.y + cell.size));
+            return domainBounds.interpolated(xInterval, yInterval);
+        }
+
+        std::int64_t
+        vertexKey(int x, int y) {
+            return std::int64_t(x) * (GRID_SIZE + 1) + y;
+        }
+
+        // Upper and lower bounds on a norm, given bounds on the squared norm
+        double
+        maxNorm(Interval squaredNormBounds) {
+            return std::sqrt(std::max(squaredNormBounds.upperBound(), 0.0));
+        }
+
+        double
+        minNorm(Interval squaredNormBounds) {
+            return std::sqrt(std::max(squaredNormBounds.lowerBound(), 0.0));
+        }
+
+        // Bound on the size of the piece of surface over a cell
+        double
+        spatialSize(
+            const Box2d& bounds,
+            Interval squaredUSpeedBounds,
+            Interval squaredVSpeedBounds
+        ) {
+            double uSize = bounds.x().width() * maxNorm(squaredUSpeedBounds);
+            double vSize = bounds.y().width() * maxNorm(squaredVSpeedBounds);
+            return uSize + vSize;
+        }
+
+        // Whether two triangles approximate the surface over a cell well enough. Linear
+        // interpolation over a u by v rectangle deviates from the surface by at most
+        // (u^2 * Muu + 2 * u * v * Muv + v^2 * Mvv) / 8, where Muu, Muv and Mvv bound the second
+        // derivatives, and the two tangent directions turn by at most (u * Muu + v * Muv) / Mu
+        // and (u * Muv + v * Mvv) / Mv, where Mu and Mv are lower bounds on the first
+        // derivatives. Where a first derivative may be zero (next to a degenerate point such as
+        // the pole of a sphere) its turn cannot be bounded, so in that direction the angle check
+        // is skipped for cells no larger than the chord tolerance - otherwise those cells would
+        // be refined indefinitely. Everywhere else the angle tolerance is always respected.
+        bool
+        isFlat(
+            const Box2d& bounds,
+            double size,
+            Interval squaredUSpeedBounds,
+            Interval squaredVSpeedBounds,
+            Interval squaredUUBounds,
+            Interval squaredUVBounds,
+            Interval squaredVVBounds,
+            double chordTolerance,
+            double angleTolerance
+        ) {
+            double uWidth = bounds.x().width();
+            double vWidth = bounds.y().width();
+            double maxUU = maxNorm(squaredUUBounds);
+            double maxUV = maxNorm(squaredUVBounds);
+            double maxVV = maxNorm(squaredVVBounds);
+            double uuDeviation = uWidth * uWidth * maxUU;
+            double uvDeviation = 2 * uWidth * vWidth * maxUV;
+            double vvDeviation = vWidth * vWidth * maxVV;
+            if (!((uuDeviation + uvDeviation + vvDeviation) / 8 <= chordTolerance)) {
+                return false;
+            }
+            bool isSmall = size <= chordTolerance;
+            double minUSpeed = minNorm(squaredUSpeedBounds);
+            double minVSpeed = minNorm(squaredVSpeedBounds);
+            double uTurn = uWidth * maxUU + vWidth * maxUV;
+            double vTurn = uWidth * maxUV + vWidth * maxVV;
+            return (
+                (uTurn <= angleTolerance * minUSpeed || (minUSpeed == 0.0 && isSmall)) &&
+                (vTurn <= angleTolerance * minVSpeed || (minVSpeed == 0.0 && isSmall))
+            );
+        }
+
+        // Whether the line segment between the given points touches the given box (Liang-Barsky
+        // clipping)
+        bool
+        touches(const Point2d& startPoint, const Point2d& endPoint, const Box2d& box) {
+            double lower = 0.0;
+            double upper = 1.0;
+            for (int index = 0; index < 2; ++index) {
+                double start = startPoint.component(index);
+                double delta = endPoint.component(index) - start;
+                Interval range = box.component(index);
+                if (delta == 0.0) {
+                    if (start < range.lowerBound() || start > range.upperBound()) {
+                        return false;
+                    }
+                    continue;
+                }
+                double first = (range.lowerBound() - start) / delta;
+                double second = (range.upperBound() - start) / delta;
+                lower = std::max(lower, std::min(first, second));
+                upper = std::min(upper, std::max(first, second));
+                if (lower > upper) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Update closestPoint if some point of the polyline is closer to the given point
+        void
+        updateClosestPoint(
+            const std::vector<Point2d>& polyline,
+            const Point2d& point,
+            Point2d& closestPoint,
+            double& minSquaredDistance
+        ) {
+            for (std::size_t index = 1; index < polyline.size(); ++index) {
+                Vector2d segmentVector = polyline[index] - polyline[index - 1];
+                double squaredLength = segmentVector.squaredNorm();
+                double parameterValue = 0.0;
+                if (squaredLength > 0.0) {
+                    parameterValue = (point - polyline[index - 1]).dot(segmentVector);
+                    parameterValue = std::min(std::max(parameterValue / squaredLength, 0.0), 1.0);
+                }
+                Point2d candidate = polyline[index - 1] + parameterValue * segmentVector;
+                double squaredDistance = (candidate - point).squaredNorm();
+                if (squaredDistance < minSquaredDistance) {
+                    closestPoint = candidate;
+                    minSquaredDistance = squaredDistance;
+                }
+            }
+        }
+
+        // Values in the given set strictly between low and high, in increasing order
+        std::vector<int>
+        between(const std::set<int>& values, int low, int high) {
+            return std::vector<int>(values.upper_bound(low), values.lower_bound(high));
+        }
+    }
+
+    namespace detail
+    {
+        int
+        SurfaceTessellator::numCrossings(const Box2d& parameterBounds, int limit) const {
+            int result = 0;
+            auto candidates = _surface.domain().boundaries().overlapping(parameterBounds);
+            for (auto iterator = candidates.begin(); iterator != candidates.end(); ++iterator) {
+                const std::vector<Point2d>& polyline = _boundaries[iterator.index()];
+                for (std::size_t index = 1; index < polyline.size(); ++index) {
+                    if (touches(polyline[index - 1], polyline[index], parameterBounds)) {
+                        ++result;
+                        if (result >= limit) {
+                            return result;
+                        }
+                    }
+                }
+            }
+            return result;
+        }
+
+        bool
+        SurfaceTessellator::isInside(const Point2d& parameterValues) const {
+            // Even-odd rule, counting crossings of a ray from the given point in the positive x
+            // direction
+            double x = parameterValues.x();
+            double y = parameterValues.y();
+            Interval rayInterval(x, std::numeric_limits<double>::infinity());
+            auto candidates = _surface.domain().boundaries().overlapping(
+                Box2d(rayInterval, Interval(y))
+            );
+            bool result = false;
+            for (auto iterator = candidates.begin(); iterator != candidates.end(); ++iterator) {
+                const std::vector<Point2d>& polyline = _boundaries[iterator.index()];
+                for (std::size_t index = 1; index < polyline.size(); ++index) {
+                    const Point2d& startPoint = polyline[index - 1];
+                    const Point2d& endPoint = polyline[index];
+                    if ((startPoint.y() > y) != (endPoint.y() > y)) {
+                        double ratio = (y - startPoint.y()) / (endPoint.y() - startPoint.y());
+                        if (startPoint.x() + ratio * (endPoint.x() - startPoint.x()) > x) {
+                            result = !result;
+                        }
+                    }
+                }
+            }
+            return result;
+        }
+
+        Point2d
+        SurfaceTessellator::closestBoundaryPoint(
+            const Point2d& parameterValues,
+            double maxDistance
+        ) const {
+            Point2d result = parameterValues;
+            double minSquaredDistance = std::numeric_limits<double>::infinity();
+            Interval offset(-maxDistance, maxDistance);
+            Box2d searchBounds(
+                parameterValues.x() + offset,
+                parameterValues.y() + offset
+            );
+            auto candidates = _surface.domain().boundaries().overlapping(searchBounds);
+            for (auto iterator = candidates.begin(); iterator != candidates.end(); ++iterator) {
+                updateClosestPoint(
+                    _boundaries[iterator.index()],
+                    parameterValues,
+                    result,
+                    minSquaredDistance
+                );
+            }
+            return result;
+        }
+
+        SurfaceTessellator::SurfaceTessellator(
+            const ParametricSurface3d& surface,
+            double chordTolerance,
+            double angleTolerance
+        ) : _surface(surface),
+            _chordTolerance(chordTolerance),
+            _angleTolerance(angleTolerance) {
+
+            if (!(chordTolerance > 0.0) || !(angleTolerance > 0.0)) {
+                throw Error(new PlaceholderError());
+            }
+
+            // Tessellate each boundary curve as it appears on the surface (instead of in the
+            // parameter domain), so that the trimmed edges of the mesh meet the same tolerances
+            // as its interior
+            const SpatialSet<ParametricCurve2d>& boundaries = surface.domain().boundaries();
+            int numBoundaries = int(boundaries.size());
+            _boundaries.resize(numBoundaries);
+            ThreadPool::global().parallelFor(
+                numBoundaries,
+                1,
+                [&] (int begin, int end) {
+                    for (int index = begin; index < end; ++index) {
+                        const ParametricCurve2d& curve = boundaries[index];
+                        ParametricExpression<Vector3d, double> derivative =
+                            surface.expression().composed(curve.expression()).derivative();
+                        CurveTessellator tessellator(
+                            derivative.squaredNorm(),
+                            derivative.derivative().squaredNorm(),
+                            curve.domain(),
+                            chordTolerance,
+                            angleTolerance
+                        );
+                        _boundaries[index] = curve.evaluate(tessellator.parameterValues());
+                    }
+                }
+            );
+        }
+
+        SurfaceMesh3d
+        SurfaceTessellator::mesh() const {
+            if (_surface.domain().isEmpty()) {
+                return SurfaceMesh3d();
+            }
+            Box2d domainBounds = _surface.domain().bounds();
+
+            typedef ParametricExpression<double, Point2d> ScalarExpression;
+            typedef ParametricExpression<Vector3d, Point2d> VectorExpression;
+            VectorExpression uDerivative = _surface.expression().derivative(0);
+            VectorExpression vDerivative = _surface.expression().derivative(1);
+            ScalarExpression squaredUSpeed = uDerivative.squaredNorm();
+            ScalarExpression squaredVSpeed = vDerivative.squaredNorm();
+            ScalarExpression squaredUU = uDerivative.derivative(0).squaredNorm();
+            ScalarExpression squaredUV = uDerivative.derivative(1).squaredNorm();
+            ScalarExpression squaredVV = vDerivative.derivative(1).squaredNorm();
+
+            // Refine the quadtree breadth first, keeping cells that are inside or crossing the
+            // boundary of the domain
+            std::vector<Cell> cells;
+            std::vector<CellStatus> cellStatuses;
+            std::vector<Cell> pending(1, Cell(0, 0, GRID_SIZE));
+            while (!pending.empty()) {
+                int numPending = int(pending.size());
+                std::vector<Box2d> bounds(numPending);
+                for (int index = 0; index < numPending; ++index) {
+                    bounds[index] = cellBounds(domainBounds, pending[index]);
+                }
+                std::vector<Interval> uSpeedBounds =
+                    squaredUSpeed.evaluate(bounds, AFFINE_BOUNDS);
+                std::vector<Interval> vSpeedBounds =
+                    squaredVSpeed.evaluate(bounds, AFFINE_BOUNDS);
+                std::vector<Interval> uuBounds = squaredUU.evaluate(bounds, AFFINE_BOUNDS);
+                std::vector<Interval> uvBounds = squaredUV.evaluate(bounds, AFFINE_BOUNDS);
+                std::vector<Interval> vvBounds = squaredVV.evaluate(bounds, AFFINE_BOUNDS);
+
+                std::vector<CellStatus> statuses(numPending);
+                ThreadPool::global().parallelFor(
+                    numPending,
+                    CHUNK_SIZE,
+                    [&] (int begin, int end) {
+                        for (int index = begin; index < end; ++index) {
+                            int crossings = numCrossings(bounds[index], 2);
+                            if (crossings == 0 && !isInside(bounds[index].centroid())) {
+                                statuses[index] = OUTSIDE_CELL;
+                                continue;
+                            }
+                            CellStatus keptStatus = INSIDE_CELL;
+                            if (crossings > 0) {
+                                keptStatus = CROSSING_CELL;
+                            }
+                            if (pending[index].size == 1) {
+                                statuses[index] = keptStatus;
+                                continue;
+                            }
+                            double size = spatialSize(
+                                bounds[index],
+                                uSpeedBounds[index],
+                                vSpeedBounds[index]
+                            );
+                            bool isAccurate = isFlat(
+                                bounds[index],
+                                size,
+                                uSpeedBounds[index],
+                                vSpeedBounds[index],
+                                uuBounds[index],
+                                uvBounds[index],
+                                vvBounds[index],
+                                _chordTolerance,
+                                _angleTolerance
+                            );
+                            if (crossings > 1 && size > _chordTolerance) {
+                                isAccurate = false;
+                            }
+                            statuses[index] = isAccurate ? keptStatus : REFINED_CELL;
+                        }
+                    }
+                );
+
+                std::vector<Cell> next;
+                for (int index = 0; index < numPending; ++index) {
+                    const Cell& cell = pending[index];
+                    if (statuses[index] == REFINED_CELL) {
+                        int half = cell.size / 2;
+                        next.push_back(Cell(cell.x, cell.y, half));
+                        next.push_back(Cell(cell.x + half, cell.y, half));
+                        next.push_back(Cell(cell.x, cell.y + half, half));
+                        next.push_back(Cell(cell.x + half, cell.y + half, half));
+                    } else if (statuses[index] != OUTSIDE_CELL) {
+                        cells.push_back(cell);
+                        cellStatuses.push_back(statuses[index]);
+                    }
+                }
+                pending.swap(next);
+            }
+
+            // Collect cell corners, along with the corners lying along each row and column of
+            // the grid (to find the corners of finer neighbors along the edges of each cell)
+            std::unordered_map<std::int64_t, int> vertexIndices;
+            std::vector<Point2d> parameterValues;
+            auto vertexIndex = [&] (int x, int y) -> int {
+                auto inserted = vertexIndices.insert(
+                    std::make_pair(vertexKey(x, y), int(parameterValues.size()))
+                );
+                if (inserted.second) {
+                    parameterValues.push_back(gridPoint(domainBounds, x, y));
+                }
+                return inserted.first->second;
+            };
+            std::unordered_map<int, std::set<int>> rows;
+            std::unordered_map<int, std::set<int>> columns;
+            for (const Cell& cell : cells) {
+                for (int corner = 0; corner < 4; ++corner) {
+                    int x = cell.x + (corner % 2) * cell.size;
+                    int y = cell.y + (corner / 2) * cell.size;
+                    vertexIndex(x, y);
+                    rows[y].insert(x);
+                    columns[x].insert(y);
+                }
+            }
+
+            // Triangulate each cell, going counterclockwise around its boundary
+            std::vector<int> indices;
+            std::vector<int> triangleCells;
+            for (std::size_t cellIndex = 0; cellIndex < cells.size(); ++cellIndex) {
+                const Cell& cell = cells[cellIndex];
+                int x0 = cell.x;
+                int y0 = cell.y;
+                int x1 = cell.x + cell.size;
+                int y1 = cell.y + cell.size;
+                std::vector<int> ring;
+                ring.push_back(vertexIndex(x0, y0));
+                for (int x : between(rows[y0], x0, x1)) {
+                    ring.push_back(vertexIndex(x, y0));
+                }
+                ring.push_back(vertexIndex(x1, y0));
+                for (int y : between(columns[x1], y0, y1)) {
+                    ring.push_back(vertexIndex(x1, y));
+                }
+                ring.push_back(vertexIndex(x1, y1));
+                std::vector<int> topValues = between(rows[y1], x0, x1);
+                std::reverse(topValues.begin(), topValues.end());
+                for (int x : topValues) {
+                    ring.push_back(vertexIndex(x, y1));
+                }
+                ring.push_back(vertexIndex(x0, y1));
+                std::vector<int> leftValues = between(columns[x0], y0, y1);
+                std::reverse(leftValues.begin(), leftValues.end());
+                for (int y : leftValues) {
+                    ring.push_back(vertexIndex(x0, y));
+                }
+
+                int numRingVertices = int(ring.size());
+                if (numRingVertices == 4) {
+                    indices.push_back(ring[0]);
+                    indices.push_back(ring[1]);
+                    indices.push_back(ring[2]);
+                    indices.push_back(ring[0]);
+                    indices.push_back(ring[2]);
+                    indices.push_back(ring[3]);
+                    triangleCells.push_back(int(cellIndex));
+                    triangleCells.push_back(int(cellIndex));
+                } else {
+                    // Fan around the cell center (cells with finer neighbors have even sizes)
+                    int center = vertexIndex(x0 + cell.size / 2, y0 + cell.size / 2);
+                    for (int index = 0; index < numRingVertices; ++index) {
+                        indices.push_back(center);
+                        indices.push_back(ring[index]);
+                        indices.push_back(ring[(index + 1) % numRingVertices]);
+                        triangleCells.push_back(int(cellIndex));
+                    }
+                }
+            }
+
+            // Classify vertices of triangles in cells crossing the boundary, recording for each
+            // one the largest such cell it belongs to (the boundary is no further away than the
+            // size of that cell)
+            int numVertices = int(parameterValues.size());
+            int numTriangles = int(triangleCells.size());
+            std::vector<double> searchDistances(numVertices, 0.0);
+            for (int triangleIndex = 0; triangleIndex < numTriangles; ++triangleIndex) {
+                int cellIndex = triangleCells[triangleIndex];
+                if (cellStatuses[cellIndex] == CROSSING_CELL) {
+                    Box2d bounds = cellBounds(domainBounds, cells[cellIndex]);
+                    double distance = bounds.diagonalVector().norm();
+                    for (int index = 3 * triangleIndex; index < 3 * triangleIndex + 3; ++index) {
+                        double& searchDistance = searchDistances[indices[index]];
+                        searchDistance = std::max(searchDistance, distance);
+                    }
+                }
+            }
+            std::vector<char> isOutside(numVertices, false);
+            ThreadPool::global().parallelFor(
+                numVertices,
+                CHUNK_SIZE,
+                [&] (int begin, int end) {
+                    for (int index = begin; index < end; ++index) {
+                        if (searchDistances[index] > 0.0) {
+                            isOutside[index] = !isInside(parameterValues[index]);
+                        }
+                    }
+                }
+            );
+
+            // Drop triangles entirely outside the domain, and move the outside vertices of
+            // the remaining ones onto the boundary
+            std::vector<char> isKept(numTriangles, true);
+            std::vector<char> isSnapped(numVertices, false);
+            for (int triangleIndex = 0; triangleIndex < numTriangles; ++triangleIndex) {
+                const int* triangleVertices = &indices[3 * triangleIndex];
+                bool isFullyOutside = (
+                    isOutside[triangleVertices[0]] &&
+                    isOutside[triangleVertices[1]] &&
+                    isOutside[triangleVertices[2]]
+                );
+                if (isFullyOutside) {
+                    isKept[triangleIndex] = false;
+                    continue;
+                }
+                for (int index = 0; index < 3; ++index) {
+                    if (isOutside[triangleVertices[index]]) {
+                        isSnapped[triangleVertices[index]] = true;
+                    }
+                }
+            }
+            ThreadPool::global().parallelFor(
+                numVertices,
+                CHUNK_SIZE,
+                [&] (int begin, int end) {
+                    for (int index = begin; index < end; ++index) {
+                        if (isSnapped[index]) {
+                            parameterValues[index] = closestBoundaryPoint(
+                                parameterValues[index],
+                                searchDistances[index]
+                            );
+                        }
+                    }
+                }
+            );
+
+            // Collect vertices of the remaining triangles (skipping any that have collapsed or
+            // flipped from snapping), reversing triangles if the surface is left handed so that
+            // they are counterclockwise with respect to the surface normal
+            bool isReversed = _surface.handedness().sign() < 0;
+            std::vector<int> vertexMapping(numVertices, -1);
+            std::vector<Point2d> meshParameterValues;
+            std::vector<int> meshIndices;
+            for (int triangleIndex = 0; triangleIndex < numTriangles; ++triangleIndex) {
+                if (!isKept[triangleIndex]) {
+                    continue;
+                }
+                int triangleVertices[3];
+                std::copy(
+                    indices.begin() + 3 * triangleIndex,
+                    indices.begin() + 3 * triangleIndex + 3,
+                    triangleVertices
+                );
+                const Point2d& firstPoint = parameterValues[triangleVertices[0]];
+                Vector2d firstEdge = parameterValues[triangleVertices[1]] - firstPoint;
+                Vector2d secondEdge = parameterValues[triangleVertices[2]] - firstPoint;
+                double firstProduct = firstEdge.x() * secondEdge.y();
+                double secondProduct = firstEdge.y() * secondEdge.x();
+                if (!(firstProduct > secondProduct)) {
+                    continue;
+                }
+                if (isReversed) {
+                    std::swap(triangleVertices[1], triangleVertices[2]);
+                }
+                for (int index = 0; index < 3; ++index) {
+                    int& mappedIndex = vertexMapping[triangleVertices[index]];
+                    if (mappedIndex < 0) {
+                        mappedIndex = int(meshParameterValues.size());
+                        meshParameterValues.push_back(parameterValues[triangleVertices[index]]);
+                    }
+                    meshIndices.push_back(mappedIndex);
+                }
+            }
+
+            std::vector<Point3d> vertices = _surface.expression().evaluate(meshParameterValues);
+            std::vector<UnitVector3d> normals = _surface.normalVector().evaluate(
+                meshParameterValues
+            );
+            return SurfaceMesh3d(
+                std::move(vertices),
+                std::move(normals),
+                std::move(meshParameterValues),
+                std::move(meshIndices)
+            );
+        }
+    }
+}
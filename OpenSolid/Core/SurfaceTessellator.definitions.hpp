@@ -0,0 +1,88 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#pragma once
+
+#include <OpenSolid/config.hpp>
+
+#include <OpenSolid/Core/SurfaceTessellator.declarations.hpp>
+
+#include <OpenSolid/Core/Box.definitions.hpp>
+#include <OpenSolid/Core/ParametricSurface.definitions.hpp>
+#include <OpenSolid/Core/Point.definitions.hpp>
+#include <OpenSolid/Core/SurfaceMesh.declarations.hpp>
+
+#include <vector>
+
+namespace opensolid
+{
+    namespace detail
+    {
+        // Meshes a trimmed parametric surface. The rectangle bounding the parameter domain is
+        // refined as a quadtree until, within each cell, bounds on the second derivatives of
+        // the surface show that two flat triangles stay within the chord tolerance of the
+        // surface and that the tangent directions turn by less than the angle tolerance. Bounds
+        // for all cells at each level of the quadtree are evaluated together in a single batch,
+        // and cells are classified in parallel. Cells crossed by the boundary of the domain
+        // (approximated by polylines, tessellated in 3D) are further refined until each is
+        // crossed by a single boundary segment, cells entirely outside the domain are dropped,
+        // and vertices of straddling triangles that fall outside the domain are moved onto the
+        // nearest boundary point. Where a cell is next to finer cells, it is split into a fan of
+        // triangles around its center so that the mesh has no cracks.
+        class SurfaceTessellator
+        {
+        private:
+            ParametricSurface3d _surface;
+            double _chordTolerance;
+            double _angleTolerance;
+            std::vector<std::vector<Point<2>>> _boundaries;
+
+            // Number of boundary segments touching the given parameter bounds, counting no
+            // higher than the given limit
+            int
+            numCrossings(const Box<2>& parameterBounds, int limit) const;
+
+            // Whether the given parameter values are inside the (tessellated) domain
+            bool
+            isInside(const Point<2>& parameterValues) const;
+
+            // Closest point on the (tessellated) boundary, which must be within the given
+            // distance of the given parameter values
+            Point<2>
+            closestBoundaryPoint(const Point<2>& parameterValues, double maxDistance) const;
+        public:
+            // Throws if either tolerance is not positive
+            OPENSOLID_CORE_EXPORT
+            SurfaceTessellator(
+                const ParametricSurface3d& surface,
+                double chordTolerance,
+                double angleTolerance
+            );
+
+            OPENSOLID_CORE_EXPORT
+            SurfaceMesh3d
+            mesh() const;
+        };
+    }
+}
@@ -0,0 +1,255 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#include <OpenSolid/Core/ThreadPool.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <exception>
+
+namespace opensolid
+{
+    struct ThreadPool::Batch
+    {
+        const std::function<void (int, int)>* function;
+        int numRemainingTasks;
+        std::exception_ptr exception;
+        std::mutex mutex;
+        std::condition_variable condition;
+    };
+
+    bool
+    ThreadPool::popTask(int queueIndex, Task& task) {
+        int numQueues = int(_queues.size());
+        for (int offset = 0; offset < numQueues; ++offset) {
+            int index = (queueIndex + offset) % numQueues;
+            Queue& queue = *_queues[index];
+            std::lock_guard<std::mutex> queueLock(queue.mutex);
+            if (!queue.tasks.empty()) {
+                // Take from the back of our own queue (most recently pushed, likely still in
+                // cache) but steal from the front of other queues
+                if (offset == 0) {
+                    task = queue.tasks.back();
+                    queue.tasks.pop_back();
+                } else {
+                    task = queue.tasks.front();
+                    queue.tasks.pop_front();
+                }
+                std::lock_guard<std::mutex> lock(_mutex);
+                --_numQueuedTasks;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void
+    ThreadPool::runTask(const Task& task) {
+        Batch& batch = *task.batch;
+        std::exception_ptr exception;
+        try {
+            (*batch.function)(task.begin, task.end);
+        } catch (...) {
+            exception = std::current_exception();
+        }
+        std::lock_guard<std::mutex> batchLock(batch.mutex);
+        if (exception && !batch.exception) {
+            batch.exception = exception;
+        }
+        --batch.numRemainingTasks;
+        if (batch.numRemainingTasks == 0) {
+            batch.condition.notify_all();
+        }
+    }
+
+    void
+    ThreadPool::workerLoop(int queueIndex) {
+        while (true) {
+            Task task;
+            if (popTask(queueIndex, task)) {
+                runTask(task);
+            } else {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _condition.wait(
+                    lock,
+                    [this] () {
+                        return _stopping || _numQueuedTasks > 0;
+                    }
+                );
+                if (_stopping) {
+                    return;
+                }
+            }
+        }
+    }
+
+    ThreadPool::ThreadPool(int numThreads, int minChunkSize) :
+        _numThreads(numThreads),
+        _minChunkSize(minChunkSize),
+        _numQueuedTasks(0),
+        _stopping(false) {
+
+        assert(numThreads >= 1);
+        assert(minChunkSize >= 1);
+        // Queue 0 is used by calling (non-worker) threads; worker i uses queue i
+        for (int i = 0; i < numThreads; ++i) {
+            _queues.emplace_back(new Queue());
+        }
+        for (int i = 1; i < numThreads; ++i) {
+            _threads.emplace_back(&ThreadPool::workerLoop, this, i);
+        }
+    }
+
+    void
+    ThreadPool::stopWorkers() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stopping = true;
+        }
+        _condition.notify_all();
+    }
+
+    ThreadPool::~ThreadPool() {
+        stopWorkers();
+        for (std::thread& thread : _threads) {
+            thread.join();
+        }
+    }
+
+    void
+    ThreadPool::setMinChunkSize(int minChunkSize) {
+        assert(minChunkSize >= 1);
+        _minChunkSize.store(minChunkSize, std::memory_order_relaxed);
+    }
+
+    void
+    ThreadPool::parallelFor(int numItems, const std::function<void (int, int)>& function) {
+        parallelFor(numItems, minChunkSize(), function);
+    }
+
+    void
+    ThreadPool::parallelFor(
+        int numItems,
+        int minChunkSize,
+        const std::function<void (int, int)>& function
+    ) {
+        assert(minChunkSize >= 1);
+        if (numItems <= 0) {
+            return;
+        }
+        // Use a few chunks per thread so that stealing can even out imbalanced work
+        int numChunks = std::min(numItems / minChunkSize, 4 * _numThreads);
+        if (_numThreads == 1 || numChunks <= 1) {
+            function(0, numItems);
+            return;
+        }
+
+        Batch batch;
+        batch.function = &function;
+        batch.numRemainingTasks = numChunks;
+        for (int i = 0; i < numChunks; ++i) {
+            Task task;
+            task.batch = &batch;
+            task.begin = int((static_cast<long long>(numItems) * i) / numChunks);
+            task.end = int((static_cast<long long>(numItems) * (i + 1)) / numChunks);
+            Queue& queue = *_queues[i % _numThreads];
+            std::lock_guard<std::mutex> queueLock(queue.mutex);
+            queue.tasks.push_back(task);
+        }
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _numQueuedTasks += numChunks;
+        }
+        _condition.notify_all();
+
+        // Help out until no queued work remains, then wait for any chunks still running on
+        // worker threads
+        Task task;
+        while (popTask(0, task)) {
+            runTask(task);
+        }
+        std::unique_lock<std::mutex> batchLock(batch.mutex);
+        batch.condition.wait(
+            batchLock,
+            [&batch] () {
+                return batch.numRemainingTasks == 0;
+            }
+        );
+        if (batch.exception) {
+            std::rethrow_exception(batch.exception);
+        }
+    }
+
+    namespace
+    {
+        std::mutex&
+        globalPoolMutex() {
+            static std::mutex mutex;
+            return mutex;
+        }
+
+        // Every global pool created so far, the current one last (replaced pools are kept since
+        // other threads may still be using them)
+        std::vector<std::unique_ptr<ThreadPool>>&
+        globalPools() {
+            static std::vector<std::unique_ptr<ThreadPool>> pools;
+            return pools;
+        }
+
+        // Current global pool; a namespace-scope atomic (rather than a function-local static) so
+        // that it is initialized at compile time and reading it needs no guard
+        std::atomic<ThreadPool*> currentGlobalPool(nullptr);
+    }
+
+    ThreadPool&
+    ThreadPool::global() {
+        ThreadPool* pool = currentGlobalPool.load(std::memory_order_acquire);
+        if (pool) {
+            return *pool;
+        }
+        std::lock_guard<std::mutex> lock(globalPoolMutex());
+        pool = currentGlobalPool.load(std::memory_order_relaxed);
+        if (!pool) {
+            int numThreads = std::max(int(std::thread::hardware_concurrency()), 1);
+            globalPools().emplace_back(new ThreadPool(numThreads));
+            pool = globalPools().back().get();
+            currentGlobalPool.store(pool, std::memory_order_release);
+        }
+        return *pool;
+    }
+
+    void
+    ThreadPool::setGlobalNumThreads(int numThreads) {
+        std::lock_guard<std::mutex> lock(globalPoolMutex());
+        ThreadPool* oldPool = currentGlobalPool.load(std::memory_order_relaxed);
+        int minChunkSize = oldPool ? oldPool->minChunkSize() : 1024;
+        globalPools().emplace_back(new ThreadPool(numThreads, minChunkSize));
+        currentGlobalPool.store(globalPools().back().get(), std::memory_order_release);
+        if (oldPool) {
+            // Not destroyed (or joined) here, since another thread - or the calling thread
+            // itself, if it is one of the pool's workers - may still be using it
+            oldPool->stopWorkers();
+        }
+    }
+}
@@ -0,0 +1,139 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#pragma once
+
+#include <OpenSolid/config.hpp>
+
+#include <OpenSolid/Core/ThreadPool.declarations.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace opensolid
+{
+    // Work-stealing thread pool used for data-parallel operations such as batch evaluation of
+    // parametric expressions. Work is split into chunks which are distributed across per-thread
+    // queues; idle threads steal chunks from the queues of busy threads. The calling thread
+    // always takes part in executing its own work, so a pool with one thread (no workers) runs
+    // everything serially on the caller.
+    class ThreadPool
+    {
+    private:
+        struct Batch;
+
+        struct Task
+        {
+            Batch* batch;
+            int begin;
+            int end;
+        };
+
+        struct Queue
+        {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        int _numThreads;
+        std::atomic<int> _minChunkSize;
+        std::vector<std::unique_ptr<Queue>> _queues;
+        std::vector<std::thread> _threads;
+        std::mutex _mutex;
+        std::condition_variable _condition;
+        int _numQueuedTasks;
+        bool _stopping;
+
+        bool
+        popTask(int queueIndex, Task& task);
+
+        void
+        runTask(const Task& task);
+
+        void
+        workerLoop(int queueIndex);
+
+        // Let worker threads exit once they run out of work, without waiting for them (so
+        // that this can be called from a worker thread)
+        void
+        stopWorkers();
+    public:
+        OPENSOLID_CORE_EXPORT
+        explicit
+        ThreadPool(int numThreads, int minChunkSize = 1024);
+
+        OPENSOLID_CORE_EXPORT
+        ~ThreadPool();
+
+        int
+        numThreads() const;
+
+        int
+        minChunkSize() const;
+
+        OPENSOLID_CORE_EXPORT
+        void
+        setMinChunkSize(int minChunkSize);
+
+        // Call function(begin, end) for disjoint subranges covering [0, numItems), in parallel
+        // where worthwhile. No subrange (except possibly the last) is smaller than the minimum
+        // chunk size. Returns once all subranges have completed; if any call throws, the first
+        // exception is rethrown on the calling thread.
+        OPENSOLID_CORE_EXPORT
+        void
+        parallelFor(int numItems, const std::function<void (int, int)>& function);
+
+        // As above, but with an explicit minimum chunk size; useful when each item represents
+        // a large amount of work (a chunk size of 1 allows every item to run on its own thread)
+        OPENSOLID_CORE_EXPORT
+        void
+        parallelFor(
+            int numItems,
+            int minChunkSize,
+            const std::function<void (int, int)>& function
+        );
+
+        // Pool shared by all parallel operations in OpenSolid, created on first use with one
+        // thread per hardware thread. Only the first call takes a lock.
+        OPENSOLID_CORE_EXPORT
+        static ThreadPool&
+        global();
+
+        // Replace the global pool with one using the given number of threads (1 disables
+        // parallelism). This may be called at any time, even from within work running on the
+        // global pool: the old pool's workers are stopped but the pool itself is kept alive
+        // until program exit, so references to it remain valid (and it still completes any
+        // work given to it, on the calling thread). Each call therefore holds on to a small
+        // amount of memory, so this is meant to be called rarely (at startup, for instance).
+        OPENSOLID_CORE_EXPORT
+        static void
+        setGlobalNumThreads(int numThreads);
+    };
+}
@@ -23,6 +23,8 @@
 ************************************************************************************/
 
 #include <OpenSolid/Core/Axis.hpp>
+#include <OpenSolid/Core/BoundedArea.hpp>
+#include <OpenSolid/Core/ChebyshevProxy.hpp>
 #include <OpenSolid/Core/LineSegment.hpp>
 #include <OpenSolid/Core/Parameter.hpp>
 #include <OpenSolid/Core/ParametricCurve.hpp>
@@ -154,3 +156,90 @@ TEST_CASE("Multi-evaluation") {
     REQUIRE((points[1] - Point2d(1 / sqrt(2.0), 1 / sqrt(2.0))).isZero());
     REQUIRE((points[2] - Point2d(0, 1)).isZero());
 }
+
+TEST_CASE("Chebyshev proxy") {
+    ParametricCurve3d helix = ParametricCurve3d::helix(
+        Point3d(0, 0, 0),
+        Point3d(0, 0, 4),
+        2.0,
+        COUNTERCLOCKWISE,
+        1.0,
+        0.0
+    );
+    ChebyshevProxy<Point3d> proxy = helix.proxy(1e-9);
+    REQUIRE(proxy.numSegments() > 1);
+    REQUIRE(proxy.errorBound() <= 1e-9);
+
+    ParametricExpression<Vector3d, double> derivative = helix.expression().derivative();
+    for (int index = 0; index <= 100; ++index) {
+        double parameterValue = index / 100.0;
+        Point3d point = helix.evaluate(parameterValue);
+        REQUIRE((proxy.evaluate(parameterValue) - point).norm() < 1e-8);
+        Vector3d derivativeValue = derivative.evaluate(parameterValue);
+        REQUIRE((proxy.derivative(parameterValue) - derivativeValue).norm() < 1e-5);
+        REQUIRE(proxy.evaluate(Interval(parameterValue - 0.01, parameterValue)).contains(point));
+    }
+    Box3d bounds = proxy.evaluate(Interval(0.0, 1.0));
+    REQUIRE(bounds.contains(helix.bounds(), 1e-6));
+    REQUIRE(bounds.z().lowerBound() > -1e-6);
+    REQUIRE(bounds.z().upperBound() < 4.0 + 1e-6);
+
+    // Scalar expressions can also be approximated
+    Parameter1d t;
+    ParametricExpression<double, double> expression = exp(sin(3.0 * t));
+    ChebyshevProxy<double> scalarProxy(expression, Interval(0.0, 2.0), 1e-10, 8);
+    std::vector<double> parameterValues(21);
+    for (int index = 0; index <= 20; ++index) {
+        parameterValues[index] = index / 10.0;
+    }
+    std::vector<double> values = scalarProxy.evaluate(parameterValues);
+    for (int index = 0; index <= 20; ++index) {
+        REQUIRE((values[index] - expression.evaluate(parameterValues[index])) == Zero(1e-9));
+    }
+}
+
+TEST_CASE("Tessellation") {
+    // A circle needs about 2 * pi / acos(1 - chordTolerance) segments
+    double chordTolerance = 1e-3;
+    double angleTolerance = 0.5;
+    ParametricCurve2d circle = ParametricCurve2d::circle(Point2d::ORIGIN(), 1.0);
+    std::vector<Point2d> points = circle.tessellate(chordTolerance, angleTolerance);
+    REQUIRE((points.front() - circle.startPoint()).isZero());
+    REQUIRE((points.back() - circle.endPoint()).isZero());
+    REQUIRE(points.size() > 70u);
+    REQUIRE(points.size() < 300u);
+    for (std::size_t index = 1; index < points.size(); ++index) {
+        Vector2d firstVector = points[index - 1] - Point2d::ORIGIN();
+        Vector2d secondVector = points[index] - Point2d::ORIGIN();
+        double angle = acos(std::min(firstVector.dot(secondVector), 1.0));
+        REQUIRE(angle <= angleTolerance);
+        REQUIRE((1.0 - cos(angle / 2)) <= chordTolerance);
+    }
+
+    // A looser angle tolerance is what limits the number of segments for a coarse chord
+    // tolerance
+    std::vector<Point2d> coarsePoints = circle.tessellate(1.0, M_PI / 8);
+    REQUIRE(coarsePoints.size() >= 17u);
+    REQUIRE(coarsePoints.size() < 100u);
+
+    // Straight curves need only a single segment
+    Parameter1d t;
+    ParametricCurve3d line(Point3d(1, 2, 3) + t * Vector3d(1, -1, 2), Interval(0.0, 2.0));
+    std::vector<Point3d> linePoints = line.tessellate(1e-6, 1e-3);
+    REQUIRE(linePoints.size() == 2u);
+    REQUIRE((linePoints.back() - Point3d(3, 0, 7)).isZero());
+
+    // Boundaries of an area are tessellated in parallel
+    std::vector<ParametricCurve2d> curves;
+    curves.push_back(circle);
+    curves.push_back(ParametricCurve2d::circle(Point2d(3, 0), 0.5));
+    BoundedArea2d area((SpatialSet<ParametricCurve2d>(std::move(curves))));
+    std::vector<std::vector<Point2d>> boundaries =
+        area.tessellatedBoundaries(chordTolerance, angleTolerance);
+    REQUIRE(boundaries.size() == 2u);
+    for (std::size_t index = 0; index < boundaries.size(); ++index) {
+        const ParametricCurve2d& boundary = area.boundaries()[index];
+        REQUIRE(boundaries[index].size() > 2u);
+        REQUIRE((boundaries[index].front() - boundary.startPoint()).isZero());
+    }
+}
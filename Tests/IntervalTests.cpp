@@ -28,6 +28,7 @@
 
 #include <cmath>
 #include <cfloat>
+#include <limits>
 
 using namespace opensolid;
 
@@ -69,6 +70,32 @@ TEST_CASE("Subtraction") {
     REQUIRE(constant_difference.upperBound() == -1.0);
 }
 
+TEST_CASE("Division") {
+    Interval two_three(2.0, 3.0);
+    Interval quotient = 6.0 / two_three;
+    REQUIRE(quotient.lowerBound() == 2.0);
+    REQUIRE(quotient.upperBound() == 3.0);
+
+    // Divisors touching zero at one end give half-unbounded results, regardless of the sign of
+    // the zero bound
+    double infinity = std::numeric_limits<double>::infinity();
+    Interval negative = 1.0 / Interval(-1.0, 0.0);
+    REQUIRE(negative.lowerBound() == -infinity);
+    REQUIRE(negative.upperBound() == -1.0);
+    Interval negativeZero = 1.0 / Interval(-1.0, -0.0);
+    REQUIRE(negativeZero.lowerBound() == -infinity);
+    REQUIRE(negativeZero.upperBound() == -1.0);
+    Interval positive = Interval(-3.0, -2.0) / Interval(-0.0, 4.0);
+    REQUIRE(positive.lowerBound() == -infinity);
+    REQUIRE(positive.upperBound() == -0.5);
+
+    REQUIRE((1.0 / Interval(0.0, 0.0)) == Interval::WHOLE());
+    REQUIRE((two_three / Interval(-1.0, 1.0)) == Interval::WHOLE());
+    REQUIRE((Interval(-1.0, 1.0) / Interval(0.0, 1.0)) == Interval::WHOLE());
+    REQUIRE((Interval(0.0) / Interval(0.0, 1.0)) == 0.0);
+    REQUIRE((two_three / Interval::EMPTY()).isEmpty());
+}
+
 TEST_CASE("Squaring") {
     Interval two_three(2.0, 3.0);
     Interval four_nine = two_three.squared();
@@ -23,14 +23,36 @@
 ************************************************************************************/
 
 #include <OpenSolid/Core/Axis.hpp>
+#include <OpenSolid/Core/EquationSolver.hpp>
+#include <OpenSolid/Core/ExpressionInterning.hpp>
+#include <OpenSolid/Core/GlobalOptimizer.hpp>
+#include <OpenSolid/Core/NativeCode.hpp>
 #include <OpenSolid/Core/ParametricExpression.hpp>
+#include <OpenSolid/Core/ParametricExpression/Bytecode/BatchKernels.hpp>
+#include <OpenSolid/Core/ParametricExpression/Bytecode/Compiler.hpp>
 #include <OpenSolid/Core/ParametricExpression/ConstantExpression.hpp>
+#include <OpenSolid/Core/ParametricExpression/CrossProductExpression.hpp>
+#include <OpenSolid/Core/ParametricExpression/EvaluationWorkspace.hpp>
+#include <OpenSolid/Core/ParametricExpression/NormExpression.hpp>
+#include <OpenSolid/Core/ParametricExpression/PolynomialExpression.hpp>
+#include <OpenSolid/Core/ParametricExpression/ScalingExpression.hpp>
+#include <OpenSolid/Core/ParametricExpression/Simplifier.hpp>
+#include <OpenSolid/Core/ParametricExpression/SineExpression.hpp>
+#include <OpenSolid/Core/ParametricExpression/SumExpression.hpp>
+#include <OpenSolid/Core/ParametricExpression/TranslationExpression.hpp>
 #include <OpenSolid/Core/Plane.hpp>
+#include <OpenSolid/Core/ThreadPool.hpp>
 #include <OpenSolid/Core/Zero.hpp>
 
 #include <boost/timer.hpp>
 #include <catch/catch.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <thread>
 #include <vector>
 
 using namespace opensolid;
@@ -104,6 +126,21 @@ namespace
         assert(index >= 0 && index < iNumDimensions);
         return point + amount * UnitVector<iNumDimensions>(index);
     }
+
+    // Enables expression interning for as long as it exists, so that a test case that fails
+    // part way through does not leave interning enabled for later test cases
+    class InterningGuard
+    {
+    public:
+        InterningGuard() {
+            ExpressionInterning::setEnabled(true);
+        }
+
+        ~InterningGuard() {
+            ExpressionInterning::setEnabled(false);
+            ExpressionInterning::clear();
+        }
+    };
 }
 
 template <class TValue, class TParameter>
@@ -152,6 +189,55 @@ void testJacobian(
     }
 }
 
+template <class TValue, class TParameter>
+void testBytecode(
+    const ParametricExpression<TValue, TParameter>& expression,
+    const TParameter& parameterValues
+) {
+    // Compare against interval evaluation at the (degenerate) parameter bounds, which exercises
+    // an independent set of instruction implementations
+    Matrix<double, NumDimensions<TParameter>::Value, 1> parameterMatrix =
+        matrixComponents(parameterValues);
+    Matrix<Interval, NumDimensions<TParameter>::Value, 1> parameterBounds;
+    for (int i = 0; i < parameterMatrix.numComponents(); ++i) {
+        parameterBounds(i) = Interval(parameterMatrix(i));
+    }
+    Matrix<Interval, NumDimensions<TValue>::Value, 1> expectedBounds;
+    ConstIntervalMatrixViewXd parameterView = parameterBounds.view();
+    IntervalMatrixViewXd expectedView = expectedBounds.view();
+    detail::Compiler::compile(expression.implementation()).evaluate(parameterView, expectedView);
+
+    Matrix<double, NumDimensions<TValue>::Value, 1> values =
+        matrixComponents(expression.evaluate(parameterValues));
+    CAPTURE(expression);
+    CAPTURE(parameterValues);
+    CAPTURE(values);
+    CAPTURE(expectedBounds);
+    for (int i = 0; i < values.numComponents(); ++i) {
+        REQUIRE(expectedBounds(i).width() == Zero());
+        REQUIRE(expectedBounds(i).contains(values(i)));
+    }
+}
+
+template <class TValue, class TParameter>
+void testBatchEvaluation(
+    const ParametricExpression<TValue, TParameter>& expression,
+    const std::vector<TParameter>& parameterValues
+) {
+    std::vector<TValue> values = expression.evaluate(parameterValues);
+    REQUIRE(values.size() == parameterValues.size());
+    for (unsigned i = 0; i < parameterValues.size(); ++i) {
+        Matrix<double, NumDimensions<TValue>::Value, 1> value = matrixComponents(values[i]);
+        Matrix<double, NumDimensions<TValue>::Value, 1> expectedValue =
+            matrixComponents(expression.evaluate(parameterValues[i]));
+        CAPTURE(expression);
+        CAPTURE(parameterValues[i]);
+        CAPTURE(value);
+        CAPTURE(expectedValue);
+        REQUIRE((value - expectedValue).isZero());
+    }
+}
+
 TEST_CASE("Constant") {
     ParametricExpression<double, double> expression = (
         ParametricExpression<double, double>::constant(3.0)
@@ -475,6 +561,73 @@ TEST_CASE("Deduplication") {
     }
 }
 
+TEST_CASE("Structural hashing") {
+    Parameter2d u = Parameter2d(0);
+    Parameter2d v = Parameter2d(1);
+
+    ParametricExpression<double, Point2d> expression1 = cos(u.squared() + v.squared());
+    ParametricExpression<double, Point2d> expression2 = cos(v.squared() + u.squared());
+    REQUIRE(
+        expression1.implementation()->structuralHash() ==
+        expression2.implementation()->structuralHash()
+    );
+
+    // Deduplicating two independently built copies of the same large expression should map both
+    // to the same implementation
+    ParametricExpression<double, Point2d> squiggle1 = scalarSquiggle() * scalarSquiggle();
+    ParametricExpression<double, Point2d> squiggle2 = scalarSquiggle() * scalarSquiggle();
+    detail::DeduplicationCache deduplicationCache;
+    detail::ExpressionImplementationPtr deduplicated1 =
+        squiggle1.derivative(0).derivative(1).implementation()->deduplicated(deduplicationCache);
+    detail::ExpressionImplementationPtr deduplicated2 =
+        squiggle2.derivative(0).derivative(1).implementation()->deduplicated(deduplicationCache);
+    REQUIRE(deduplicated1 == deduplicated2);
+}
+
+TEST_CASE("Expression interning") {
+    Parameter2d u = Parameter2d(0);
+    Parameter2d v = Parameter2d(1);
+
+    ParametricExpression<double, Point2d> expression1 = sin(u) * cos(v);
+    ParametricExpression<double, Point2d> expression2 = sin(u) * cos(v);
+    REQUIRE(expression1.implementation() != expression2.implementation());
+
+    {
+        InterningGuard interningGuard;
+        ParametricExpression<double, Point2d> expression3 = sin(u) * cos(v);
+        ParametricExpression<double, Point2d> expression4 = cos(v) * sin(u);
+        ParametricExpression<double, Point2d> expression5 = sin(u) * sin(v);
+        REQUIRE(expression3.implementation() == expression4.implementation());
+        REQUIRE(expression3.implementation() != expression5.implementation());
+
+        // Independently built curves should share their common subexpressions
+        ParametricExpression<double, Point2d> sum1 = sin(u) * cos(v) + u;
+        ParametricExpression<double, Point2d> sum2 = sin(u) * cos(v) + v;
+        const detail::SumExpression* sumImplementation1 =
+            sum1.implementation()->cast<detail::SumExpression>();
+        const detail::SumExpression* sumImplementation2 =
+            sum2.implementation()->cast<detail::SumExpression>();
+        REQUIRE(sumImplementation1->firstOperand() == sumImplementation2->firstOperand());
+
+        // Numeric data is compared exactly, so nearly equal offsets are not merged
+        ParametricExpression<double, Point2d> offset1 = sin(u) + 1.0;
+        ParametricExpression<double, Point2d> offset2 = sin(u) + 1.0;
+        ParametricExpression<double, Point2d> offset3 = sin(u) + (1.0 + 1e-13);
+        REQUIRE(offset1.implementation() == offset2.implementation());
+        REQUIRE(offset1.implementation() != offset3.implementation());
+        REQUIRE((offset3.evaluate(Point2d(0, 0)) - (1.0 + 1e-13)) == Zero(1e-15));
+    }
+    REQUIRE_FALSE(ExpressionInterning::isEnabled());
+    REQUIRE(ExpressionInterning::numEntries() == 0);
+
+    // Different constants should hash differently (so that they do not all share one bucket)
+    detail::ExpressionImplementationPtr one = std::make_shared<detail::ConstantExpression>(1.0, 2);
+    detail::ExpressionImplementationPtr two = std::make_shared<detail::ConstantExpression>(2.0, 2);
+    REQUIRE(one->structuralHash() != two->structuralHash());
+    detail::ExpressionImplementationPtr zero = std::make_shared<detail::ConstantExpression>(0.0, 2);
+    REQUIRE_FALSE(zero->isDuplicateOf(std::make_shared<detail::ConstantExpression>(1e-13, 2)));
+}
+
 TEST_CASE("Deduplicated output") {
     Parameter1d t;
     ParametricExpression<double, double> expression = t.squared() + sin(t.squared());
@@ -545,6 +698,1082 @@ TEST_CASE("Squiggle Jacobians") {
     }
 }
 
+TEST_CASE("Bytecode evaluation") {
+    Parameter2d u = Parameter2d(0);
+    Parameter2d v = Parameter2d(1);
+    ParametricExpression<double, Point2d> scalar = scalarSquiggle();
+    ParametricExpression<Vector3d, Point2d> vector = vectorSquiggle();
+    std::vector<Point2d> parameterValues = squiggleParameterValues();
+
+    for (unsigned i = 0; i < parameterValues.size(); ++i) {
+        testBytecode(scalar, parameterValues[i]);
+        testBytecode(vector, parameterValues[i]);
+        testBytecode(acos(scalar / 2.0), parameterValues[i]);
+        testBytecode(asin(scalar / 2.0), parameterValues[i]);
+        testBytecode(vector.cross(vector + Vector3d(0, 0, 1)), parameterValues[i]);
+        testBytecode(vector.dot(vector + Vector3d(0, 0, 1)), parameterValues[i]);
+        testBytecode(exp(scalar) - log(scalar + 2.0), parameterValues[i]);
+        testBytecode(vector.rotatedAbout(UnitVector3d::X(), M_PI / 4), parameterValues[i]);
+        testBytecode(-vector.normalized(), parameterValues[i]);
+        testBytecode(vector.norm() + vector.squaredNorm(), parameterValues[i]);
+        testBytecode(pow(2.0, scalar) + pow(scalar + 2.0, 3.0), parameterValues[i]);
+        testBytecode(pow(scalar + 2.0, 0.5) + pow(scalar + 2.0, u), parameterValues[i]);
+        testBytecode(vector * (scalar + 1.0) + vector / (scalar + 2.0), parameterValues[i]);
+        testBytecode(sqrt(scalar + 2.0) * tan(v), parameterValues[i]);
+        testBytecode(
+            ParametricExpression<Vector2d, Point2d>::fromComponents(vector.z(), 3.0 * u),
+            parameterValues[i]
+        );
+    }
+
+    Parameter1d t;
+    ParametricExpression<double, double> composed = scalar.composed(
+        ParametricExpression<Point2d, double>::fromComponents(t, t.squared())
+    );
+    testBytecode(composed, 0.25);
+    testBytecode(composed, 0.75);
+
+    ParametricExpression<double, double> quotient = 1.0 / (t - 1.0);
+    REQUIRE_THROWS(quotient.evaluate(1.0));
+
+    ParametricExpression<double, double> sine = sin(t);
+    Interval sineBounds = sine.evaluate(Interval(0, M_PI));
+    REQUIRE((sineBounds.lowerBound() - 0.0) == Zero());
+    REQUIRE((sineBounds.upperBound() - 1.0) == Zero());
+}
+
+TEST_CASE("Evaluation workspace reuse") {
+    ParametricExpression<double, Point2d> scalar = scalarSquiggle();
+    ParametricExpression<Vector3d, Point2d> vector = vectorSquiggle() * scalarSquiggle();
+    detail::Evaluator scalarEvaluator = detail::Compiler::compile(scalar.implementation());
+    detail::Evaluator vectorEvaluator = detail::Compiler::compile(vector.implementation());
+    detail::Evaluator jacobianEvaluator =
+        detail::Compiler::compileJacobian(vector.implementation());
+    std::vector<Point2d> parameterValues = squiggleParameterValues();
+
+    // Alternate between expressions of different sizes using the same workspace
+    detail::EvaluationWorkspace<double> workspace;
+    for (unsigned i = 0; i < parameterValues.size(); ++i) {
+        ConstMatrixViewXd parameterView = parameterValues[i].components().view();
+
+        double scalarValue;
+        MatrixViewXd scalarView(&scalarValue, 1, 1, sizeof(double));
+        scalarEvaluator.evaluate(parameterView, scalarView, workspace);
+        REQUIRE((scalarValue - scalar.evaluate(parameterValues[i])) == Zero());
+
+        Vector3d vectorValue;
+        MatrixViewXd vectorView = vectorValue.components().view();
+        vectorEvaluator.evaluate(parameterView, vectorView, workspace);
+        REQUIRE((vectorValue - vector.evaluate(parameterValues[i])).isZero());
+
+        Matrix<double, 3, 2> jacobian;
+        MatrixViewXd jacobianView = detail::flattenedView(jacobian);
+        jacobianEvaluator.evaluate(parameterView, jacobianView, workspace);
+        REQUIRE((jacobian - vector.jacobian(parameterValues[i])).isZero());
+    }
+}
+
+TEST_CASE("Batch kernels") {
+    const detail::BatchKernels& scalarKernels = detail::BatchKernels::scalar();
+    const detail::BatchKernels& bestKernels = detail::BatchKernels::best();
+    CAPTURE(bestKernels.name);
+
+    // Use an odd count to exercise the remainder handling of vectorized kernels
+    const int count = 19;
+    std::vector<double> first(count);
+    std::vector<double> second(count);
+    for (int i = 0; i < count; ++i) {
+        first[i] = 0.5 + i * 0.25;
+        second[i] = 3.0 - i * 0.125;
+    }
+    std::vector<double> expected(count);
+    std::vector<double> actual(count);
+
+    scalarKernels.add(first.data(), second.data(), expected.data(), count);
+    bestKernels.add(first.data(), second.data(), actual.data(), count);
+    REQUIRE(actual == expected);
+
+    scalarKernels.subtract(first.data(), second.data(), expected.data(), count);
+    bestKernels.subtract(first.data(), second.data(), actual.data(), count);
+    REQUIRE(actual == expected);
+
+    scalarKernels.multiply(first.data(), second.data(), expected.data(), count);
+    bestKernels.multiply(first.data(), second.data(), actual.data(), count);
+    REQUIRE(actual == expected);
+
+    scalarKernels.divide(first.data(), second.data(), expected.data(), count);
+    bestKernels.divide(first.data(), second.data(), actual.data(), count);
+    REQUIRE(actual == expected);
+
+    scalarKernels.negate(first.data(), expected.data(), count);
+    bestKernels.negate(first.data(), actual.data(), count);
+    REQUIRE(actual == expected);
+
+    // Negating zero must give negative zero, as in scalar evaluation
+    std::vector<double> zeros(count, 0.0);
+    bestKernels.negate(zeros.data(), actual.data(), count);
+    for (int i = 0; i < count; ++i) {
+        REQUIRE(std::signbit(actual[i]));
+    }
+
+    scalarKernels.square(first.data(), expected.data(), count);
+    bestKernels.square(first.data(), actual.data(), count);
+    REQUIRE(actual == expected);
+
+    scalarKernels.sqrt(first.data(), expected.data(), count);
+    bestKernels.sqrt(first.data(), actual.data(), count);
+    REQUIRE(actual == expected);
+}
+
+TEST_CASE("Non-finite constants") {
+    // Each constant should get its own register even when NaN constants are present (NaN
+    // compares unequal to everything, so must not be used directly as a lookup key)
+    Parameter1d t;
+    double infinity = std::numeric_limits<double>::infinity();
+    double nan = std::numeric_limits<double>::quiet_NaN();
+    ParametricExpression<Vector3d, double> function = sin(t) * Vector3d(infinity, -infinity, nan);
+    Vector3d value = function.evaluate(0.5);
+    REQUIRE(value.x() == infinity);
+    REQUIRE(value.y() == -infinity);
+    REQUIRE(std::isnan(value.z()));
+}
+
+TEST_CASE("Batch evaluation") {
+    Parameter2d u = Parameter2d(0);
+    Parameter2d v = Parameter2d(1);
+    ParametricExpression<double, Point2d> scalar = scalarSquiggle();
+    ParametricExpression<Vector3d, Point2d> vector = vectorSquiggle();
+    std::vector<Point2d> parameterValues = squiggleParameterValues();
+
+    testBatchEvaluation(scalar, parameterValues);
+    testBatchEvaluation(vector, parameterValues);
+    testBatchEvaluation(acos(scalar / 2.0) + asin(scalar / 2.0), parameterValues);
+    testBatchEvaluation(vector.cross(vector + Vector3d(0, 0, 1)), parameterValues);
+    testBatchEvaluation(vector.dot(vector + Vector3d(0, 0, 1)), parameterValues);
+    testBatchEvaluation(exp(scalar) - log(scalar + 2.0) * tan(v), parameterValues);
+    testBatchEvaluation(vector.normalized() * vector.norm(), parameterValues);
+    testBatchEvaluation(pow(scalar + 2.0, 3.0) + pow(scalar + 2.0, u), parameterValues);
+    testBatchEvaluation(sqrt(vector.squaredNorm()) / (scalar + 2.0), parameterValues);
+
+    Parameter1d t;
+    std::vector<double> lineParameterValues(5);
+    for (int i = 0; i < 5; ++i) {
+        lineParameterValues[i] = i / 4.0;
+    }
+    ParametricExpression<double, double> quotient = 1.0 / (t - 0.5);
+    REQUIRE_THROWS(quotient.evaluate(lineParameterValues));
+}
+
+TEST_CASE("Thread pool") {
+    ThreadPool threadPool(4, 10);
+    std::vector<int> counts(1000, 0);
+    std::vector<int> chunkSizes(1000, 0);
+    threadPool.parallelFor(
+        1000,
+        [&counts, &chunkSizes] (int begin, int end) {
+            for (int i = begin; i < end; ++i) {
+                ++counts[i];
+                chunkSizes[i] = end - begin;
+            }
+        }
+    );
+    for (int i = 0; i < 1000; ++i) {
+        REQUIRE(counts[i] == 1);
+        REQUIRE(chunkSizes[i] >= 10);
+    }
+    REQUIRE_THROWS(
+        threadPool.parallelFor(
+            1000,
+            [] (int begin, int end) {
+                if (begin <= 500 && 500 < end) {
+                    throw std::runtime_error("Test");
+                }
+            }
+        )
+    );
+
+    // Replacing the global pool from within work running on it (even on one of its worker
+    // threads) should leave the old pool usable
+    ThreadPool::setGlobalNumThreads(4);
+    ThreadPool& originalPool = ThreadPool::global();
+    std::thread::id callingThreadId = std::this_thread::get_id();
+    std::atomic<bool> replaced(false);
+    originalPool.parallelFor(
+        100,
+        1,
+        [callingThreadId, &replaced] (int begin, int end) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            if (std::this_thread::get_id() != callingThreadId && !replaced.exchange(true)) {
+                ThreadPool::setGlobalNumThreads(3);
+            }
+        }
+    );
+    if (!replaced) {
+        ThreadPool::setGlobalNumThreads(3);
+    }
+    REQUIRE(&ThreadPool::global() != &originalPool);
+    REQUIRE(ThreadPool::global().numThreads() == 3);
+    std::vector<int> oldPoolCounts(100, 0);
+    originalPool.parallelFor(
+        100,
+        1,
+        [&oldPoolCounts] (int begin, int end) {
+            for (int i = begin; i < end; ++i) {
+                ++oldPoolCounts[i];
+            }
+        }
+    );
+    REQUIRE(oldPoolCounts == std::vector<int>(100, 1));
+}
+
+TEST_CASE("Parallel batch evaluation") {
+    ThreadPool::setGlobalNumThreads(4);
+    ThreadPool::global().setMinChunkSize(16);
+
+    ParametricExpression<Vector3d, Point2d> vector = vectorSquiggle();
+    std::vector<Point2d> parameterValues(1000);
+    std::vector<Box2d> parameterBounds(1000);
+    for (int i = 0; i < 1000; ++i) {
+        double u = i / 999.0;
+        double v = 1.0 - u;
+        parameterValues[i] = Point2d(u, v);
+        parameterBounds[i] = Box2d(Interval(u, u + 0.01), Interval(v - 0.01, v));
+    }
+    testBatchEvaluation(vector, parameterValues);
+    testBatchEvaluation(vector.normalized() * vector.norm(), parameterValues);
+
+    std::vector<IntervalVector3d> bounds = vector.evaluate(parameterBounds);
+    REQUIRE(bounds.size() == parameterBounds.size());
+    for (int i = 0; i < 1000; ++i) {
+        IntervalVector3d expectedBounds = vector.evaluate(parameterBounds[i]);
+        for (int component = 0; component < 3; ++component) {
+            REQUIRE(
+                bounds[i].component(component).lowerBound() ==
+                expectedBounds.component(component).lowerBound()
+            );
+            REQUIRE(
+                bounds[i].component(component).upperBound() ==
+                expectedBounds.component(component).upperBound()
+            );
+        }
+    }
+
+    Parameter1d t;
+    std::vector<double> lineParameterValues(1000);
+    for (int i = 0; i < 1000; ++i) {
+        lineParameterValues[i] = i / 999.0;
+    }
+    lineParameterValues[700] = 0.5;
+    ParametricExpression<double, double> quotient = 1.0 / (t - 0.5);
+    REQUIRE_THROWS(quotient.evaluate(lineParameterValues));
+
+    ThreadPool::global().setMinChunkSize(1024);
+}
+
+TEST_CASE("Batch Jacobians") {
+    ParametricExpression<Vector3d, Point2d> vector = vectorSquiggle() * scalarSquiggle();
+    std::vector<Point2d> parameterValues = squiggleParameterValues();
+    std::vector<Box2d> parameterBounds(parameterValues.size());
+    for (unsigned i = 0; i < parameterValues.size(); ++i) {
+        parameterBounds[i] = parameterValues[i].hull(parameterValues[i] + Vector2d(0.01, 0.01));
+    }
+
+    std::vector<Matrix<double, 3, 2>> jacobians = vector.jacobian(parameterValues);
+    std::vector<Matrix<Interval, 3, 2>> jacobianBounds = vector.jacobian(parameterBounds);
+    REQUIRE(jacobians.size() == parameterValues.size());
+    REQUIRE(jacobianBounds.size() == parameterBounds.size());
+    for (unsigned i = 0; i < parameterValues.size(); ++i) {
+        Matrix<double, 3, 2> expectedJacobian = vector.jacobian(parameterValues[i]);
+        Matrix<Interval, 3, 2> expectedBounds = vector.jacobian(parameterBounds[i]);
+        CAPTURE(parameterValues[i]);
+        CAPTURE(jacobians[i]);
+        CAPTURE(expectedJacobian);
+        REQUIRE((jacobians[i] - expectedJacobian).isZero());
+        for (int j = 0; j < 6; ++j) {
+            REQUIRE(jacobianBounds[i](j).lowerBound() == expectedBounds(j).lowerBound());
+            REQUIRE(jacobianBounds[i](j).upperBound() == expectedBounds(j).upperBound());
+            REQUIRE(jacobianBounds[i](j).contains(jacobians[i](j)));
+        }
+    }
+    REQUIRE(vector.jacobian(std::vector<Point2d>()).empty());
+}
+
+TEST_CASE("Value and Jacobian") {
+    ParametricExpression<Vector3d, Point2d> vector = vectorSquiggle() * scalarSquiggle();
+    std::vector<Point2d> parameterValues = squiggleParameterValues();
+
+    // Values and derivatives share most of their intermediate results, so compiling them
+    // together should be significantly cheaper than compiling them separately
+    detail::Evaluator valueEvaluator = detail::Compiler::compile(vector.implementation());
+    detail::Evaluator jacobianEvaluator =
+        detail::Compiler::compileJacobian(vector.implementation());
+    detail::Evaluator combinedEvaluator =
+        detail::Compiler::compileWithJacobian(vector.implementation());
+    REQUIRE(
+        combinedEvaluator.instructions().size() <
+        valueEvaluator.instructions().size() + jacobianEvaluator.instructions().size()
+    );
+
+    for (unsigned i = 0; i < parameterValues.size(); ++i) {
+        Vector3d value;
+        Matrix<double, 3, 2> jacobian;
+        vector.evaluateWithJacobian(parameterValues[i], value, jacobian);
+        REQUIRE((value - vector.evaluate(parameterValues[i])).isZero());
+        REQUIRE((jacobian - vector.jacobian(parameterValues[i])).isZero());
+
+        Box2d parameterBounds = parameterValues[i].hull(parameterValues[i] + Vector2d(0.01, 0.01));
+        IntervalVector3d bounds;
+        Matrix<Interval, 3, 2> jacobianBounds;
+        vector.evaluateWithJacobian(parameterBounds, bounds, jacobianBounds);
+        for (int j = 0; j < 3; ++j) {
+            REQUIRE(bounds.component(j).contains(value.component(j)));
+        }
+        for (int j = 0; j < 6; ++j) {
+            REQUIRE(jacobianBounds(j).contains(jacobian(j)));
+        }
+    }
+
+    std::vector<Vector3d> values;
+    std::vector<Matrix<double, 3, 2>> jacobians;
+    vector.evaluateWithJacobian(parameterValues, values, jacobians);
+    REQUIRE(values.size() == parameterValues.size());
+    REQUIRE(jacobians.size() == parameterValues.size());
+    for (unsigned i = 0; i < parameterValues.size(); ++i) {
+        REQUIRE((values[i] - vector.evaluate(parameterValues[i])).isZero());
+        REQUIRE((jacobians[i] - vector.jacobian(parameterValues[i])).isZero());
+    }
+}
+
+TEST_CASE("Simplification") {
+    Parameter1d t;
+    ParametricExpression<Vector3d, double> vector = (
+        Vector3d(1, 2, 3) * t + Vector3d(0, 1, 0) * t * t
+    );
+    std::vector<double> parameterValues(5);
+    for (int i = 0; i < 5; ++i) {
+        parameterValues[i] = i / 4.0;
+    }
+
+    detail::Simplifier simplifier;
+
+    // sqrt(x.squaredNorm()) should become x.norm()
+    ParametricExpression<double, double> length = sqrt(vector.squaredNorm());
+    detail::ExpressionImplementationPtr lengthPtr = simplifier.simplified(length.implementation());
+    REQUIRE(typeid(*lengthPtr) == typeid(detail::NormExpression));
+    REQUIRE(simplifier.statistics().numNormRewrites == 1);
+
+    // Scaling a translation should become a translation of a scaling, with the constant parts
+    // folded together
+    ParametricExpression<Vector3d, double> scaled = 2.0 * (vector + Vector3d(1, 2, 3));
+    detail::ExpressionImplementationPtr scaledPtr = simplifier.simplified(scaled.implementation());
+    REQUIRE(typeid(*scaledPtr) == typeid(detail::TranslationExpression));
+    const detail::TranslationExpression* translationExpression =
+        scaledPtr->cast<detail::TranslationExpression>();
+    REQUIRE(typeid(*translationExpression->operand()) == typeid(detail::ScalingExpression));
+    REQUIRE((translationExpression->columnMatrix() - Vector3d(2, 4, 6).components()).isZero());
+    REQUIRE(simplifier.statistics().numAffineMerges == 1);
+
+    // Subtracting a duplicate subexpression should give zero
+    ParametricExpression<Vector3d, double> difference = (
+        (Vector3d(1, 2, 3) * t + Vector3d(0, 1, 0) * t * t) - vector
+    );
+    detail::ExpressionImplementationPtr differencePtr =
+        simplifier.simplified(difference.implementation());
+    REQUIRE(differencePtr->isConstantExpression());
+    REQUIRE(simplifier.statistics().numDuplicateOperandRewrites == 1);
+    REQUIRE(simplifier.statistics().numInputNodes > simplifier.statistics().numOutputNodes);
+
+    // Nearly equal operands are not duplicates, since their difference is small but nonzero
+    ParametricExpression<double, double> nearlyEqual = (sin(t) + 1.0) - (sin(t) + (1.0 + 1e-13));
+    detail::ExpressionImplementationPtr nearlyEqualPtr =
+        simplifier.simplified(nearlyEqual.implementation());
+    REQUIRE_FALSE(nearlyEqualPtr->isConstantExpression());
+    REQUIRE(simplifier.statistics().numDuplicateOperandRewrites == 1);
+    REQUIRE((nearlyEqual.evaluate(0.5) + 1e-13) == Zero(1e-15));
+
+    // Nodes with only constant operands (which the construction operators would normally have
+    // evaluated immediately) should be folded, all in a single pass
+    detail::ExpressionImplementationPtr xAxisPtr =
+        std::make_shared<detail::ConstantExpression>(Vector3d(1, 0, 0).components(), 1);
+    detail::ExpressionImplementationPtr yAxisPtr =
+        std::make_shared<detail::ConstantExpression>(Vector3d(0, 1, 0).components(), 1);
+    detail::ExpressionImplementationPtr anglePtr =
+        std::make_shared<detail::ConstantExpression>(0.5, 1);
+    detail::ExpressionImplementationPtr crossPtr =
+        std::make_shared<detail::CrossProductExpression>(xAxisPtr, yAxisPtr);
+    detail::ExpressionImplementationPtr sinePtr =
+        std::make_shared<detail::SineExpression>(anglePtr);
+    ParametricExpression<Vector3d, double> folded(
+        vector.implementation() + sinePtr * crossPtr
+    );
+    detail::ExpressionImplementationPtr foldedPtr = simplifier.simplified(folded.implementation());
+    REQUIRE(typeid(*foldedPtr) == typeid(detail::TranslationExpression));
+    REQUIRE(
+        (
+            foldedPtr->cast<detail::TranslationExpression>()->columnMatrix() -
+            Vector3d(0, 0, sin(0.5)).components()
+        ).isZero()
+    );
+    REQUIRE(simplifier.statistics().numConstantFolds == 2);
+
+    // Compiled expressions are simplified, so should still give the same results
+    detail::Simplifier::resetTotalStatistics();
+    for (unsigned i = 0; i < parameterValues.size(); ++i) {
+        double expectedLength = vector.evaluate(parameterValues[i]).norm();
+        REQUIRE((length.evaluate(parameterValues[i]) - expectedLength) == Zero());
+        Vector3d expectedScaled = 2.0 * (vector.evaluate(parameterValues[i]) + Vector3d(1, 2, 3));
+        REQUIRE((scaled.evaluate(parameterValues[i]) - expectedScaled).isZero());
+        REQUIRE(difference.evaluate(parameterValues[i]).isZero());
+        Vector3d expectedFolded = vector.evaluate(parameterValues[i]) + Vector3d(0, 0, sin(0.5));
+        REQUIRE((folded.evaluate(parameterValues[i]) - expectedFolded).isZero());
+    }
+    REQUIRE(detail::Simplifier::totalStatistics().numNormRewrites > 0);
+}
+
+TEST_CASE("Memoized derivatives") {
+    Parameter1d t;
+    ParametricExpression<double, double> function = exp(t * t) + sin(t);
+
+    // Derivatives are shared for as long as they are in use, both at the implementation level
+    // and at the compiled level
+    detail::ExpressionImplementationPtr derivativePtr = function.implementation()->derivative();
+    REQUIRE(function.implementation()->derivative() == derivativePtr);
+    ParametricExpression<double, double> derivative = function.derivative();
+    REQUIRE(function.derivative().implementation() == derivative.implementation());
+
+    // Higher-order derivatives are computed from the shared lower-order ones
+    ParametricExpression<double, double> secondDerivative = derivative.derivative();
+    ParametricExpression<double, double> recomputed = function.derivative().derivative();
+    REQUIRE(recomputed.implementation() == secondDerivative.implementation());
+    for (int i = 0; i <= 4; ++i) {
+        double u = i / 4.0;
+        double expected = exp(u * u) * (2 + 4 * u * u) - sin(u);
+        REQUIRE((secondDerivative.evaluate(u) - expected) == Zero());
+    }
+
+    // Derivatives are held weakly, so do not keep each other alive
+    std::weak_ptr<const detail::ExpressionImplementation> weakPtr(derivativePtr);
+    derivativePtr.reset();
+    derivative = ParametricExpression<double, double>();
+    secondDerivative = ParametricExpression<double, double>();
+    recomputed = ParametricExpression<double, double>();
+    REQUIRE(weakPtr.expired());
+}
+
+namespace
+{
+    template <class TScalar>
+    void
+    constantNativeFunction(const TScalar* parameters, TScalar* results) {
+        results[0] = TScalar(42.0);
+    }
+}
+
+TEST_CASE("Native code") {
+    Parameter1d t;
+    ParametricExpression<double, double> function = t * t + sin(t);
+
+    std::string source = NativeCode::generate(function, "function");
+    REQUIRE(source.find("function_value(") != std::string::npos);
+    REQUIRE(source.find("function_jacobian(") != std::string::npos);
+    REQUIRE(source.find("function_valueAndJacobian(") != std::string::npos);
+    REQUIRE(source.find("function_register()") != std::string::npos);
+    REQUIRE(source.find("opensolid::sin(") != std::string::npos);
+
+    // Compiled expressions with matching bytecode should call registered native functions
+    // (here a deliberately wrong one, to make sure it is actually being called)
+    detail::Evaluator evaluator = detail::Compiler::compile(function.implementation());
+    REQUIRE_FALSE(evaluator.isNative());
+    NativeCode::registerFunctions(
+        evaluator,
+        &constantNativeFunction<double>,
+        &constantNativeFunction<Interval>
+    );
+    ParametricExpression<double, double> nativeFunction = t * t + sin(t);
+    REQUIRE(nativeFunction.evaluate(0.5) == 42.0);
+    REQUIRE(nativeFunction.evaluate(Interval(0, 1)).lowerBound() == 42.0);
+    std::vector<double> values = nativeFunction.evaluate(std::vector<double>(10, 0.5));
+    REQUIRE(values.back() == 42.0);
+
+    // Expressions with different bytecode should be unaffected
+    ParametricExpression<double, double> otherFunction = t * t + cos(t);
+    REQUIRE((otherFunction.evaluate(0.5) - (0.25 + cos(0.5))) == Zero());
+
+    // Registrations with a matching fingerprint but different bytecode (a fingerprint
+    // collision) should never be used
+    ParametricExpression<double, double> collidingFunction = t * t + exp(t);
+    detail::Evaluator collidingEvaluator =
+        detail::Compiler::compile(collidingFunction.implementation());
+    NativeCode::registerFunctions(
+        collidingEvaluator.fingerprint(),
+        std::vector<int>(),
+        std::vector<double>(),
+        &constantNativeFunction<double>,
+        &constantNativeFunction<Interval>
+    );
+    REQUIRE_FALSE(detail::Compiler::compile(collidingFunction.implementation()).isNative());
+    REQUIRE((collidingFunction.evaluate(0.5) - (0.25 + exp(0.5))) == Zero());
+
+    // Non-finite constants have no C++ literal syntax, so should be generated using
+    // std::numeric_limits; bytecode containing NaN constants should still match its registration
+    double infinity = std::numeric_limits<double>::infinity();
+    double nan = std::numeric_limits<double>::quiet_NaN();
+    ParametricExpression<Vector3d, double> nonFiniteFunction =
+        sin(t) * Vector3d(infinity, -infinity, nan);
+    std::string nonFiniteSource = NativeCode::generate(nonFiniteFunction, "nonFinite");
+    REQUIRE(nonFiniteSource.find("#include <limits>") != std::string::npos);
+    REQUIRE(nonFiniteSource.find(" std::numeric_limits<double>::infinity()") != std::string::npos);
+    REQUIRE(nonFiniteSource.find("-std::numeric_limits<double>::infinity()") != std::string::npos);
+    REQUIRE(nonFiniteSource.find("std::numeric_limits<double>::quiet_NaN()") != std::string::npos);
+    REQUIRE(nonFiniteSource.find("inf.0") == std::string::npos);
+    REQUIRE(nonFiniteSource.find("nan.0") == std::string::npos);
+    detail::Evaluator nonFiniteEvaluator =
+        detail::Compiler::compile(nonFiniteFunction.implementation());
+    NativeCode::registerFunctions(
+        nonFiniteEvaluator,
+        &constantNativeFunction<double>,
+        &constantNativeFunction<Interval>
+    );
+    REQUIRE(detail::Compiler::compile(nonFiniteFunction.implementation()).isNative());
+
+    NativeCode::clear();
+    REQUIRE(NativeCode::numRegisteredFunctions() == 0);
+    ParametricExpression<double, double> interpretedFunction = t * t + sin(t);
+    REQUIRE((interpretedFunction.evaluate(0.5) - (0.25 + sin(0.5))) == Zero());
+}
+
+TEST_CASE("Single-precision evaluation") {
+    ParametricExpression<Vector3d, Point2d> vector = vectorSquiggle() * scalarSquiggle();
+    std::vector<Point2d> parameterValues = squiggleParameterValues();
+    std::vector<Vector3d> values = vector.evaluate(parameterValues);
+
+    std::vector<float> results(3 * parameterValues.size());
+    vector.evaluate(parameterValues, results.data());
+    for (unsigned i = 0; i < parameterValues.size(); ++i) {
+        for (int j = 0; j < 3; ++j) {
+            REQUIRE((results[3 * i + j] - float(values[i].component(j))) == Zero(1e-6));
+        }
+    }
+
+    std::vector<Point2d> singleParameterValue(1, parameterValues.front());
+    float singleResult[3];
+    vector.evaluate(singleParameterValue, singleResult);
+    REQUIRE((singleResult[0] - results[0]) == Zero(1e-6));
+
+    // Parameter values and intermediate results are not rounded to float, so large parameter
+    // values (where the spacing between adjacent floats is about 1e-3) still give accurate results
+    Parameter1d t;
+    ParametricExpression<double, double> wave = sin(1000.0 * t);
+    std::vector<double> tValues(20);
+    for (unsigned i = 0; i < tValues.size(); ++i) {
+        tValues[i] = 1e4 + i * 1.234e-4;
+    }
+    std::vector<float> waveResults(tValues.size());
+    wave.evaluate(tValues, waveResults.data());
+    for (unsigned i = 0; i < tValues.size(); ++i) {
+        REQUIRE((waveResults[i] - std::sin(1000.0 * tValues[i])) == Zero(1e-6));
+    }
+}
+
+TEST_CASE("Affine bounds") {
+    Parameter1d t;
+    ParametricExpression<double, double> parabola = t * (1.0 - t);
+    Interval domain(0.4, 0.6);
+    Interval naturalBounds = parabola.evaluate(domain);
+    Interval affineBounds = parabola.evaluate(domain, AFFINE_BOUNDS);
+    REQUIRE(naturalBounds.width() > 0.1);
+    REQUIRE(affineBounds.width() < 0.021);
+    REQUIRE(affineBounds.contains(0.24));
+    REQUIRE(affineBounds.contains(0.25));
+
+    ParametricExpression<double, Point2d> squiggle = scalarSquiggle() * (2.0 - scalarSquiggle());
+    Box2d box(Interval(0.3, 0.4), Interval(0.6, 0.7));
+    Interval squiggleBounds = squiggle.evaluate(box, AFFINE_BOUNDS);
+    REQUIRE(squiggle.evaluate(box).contains(squiggleBounds));
+    REQUIRE(squiggleBounds.width() < squiggle.evaluate(box).width());
+    for (int i = 0; i <= 10; ++i) {
+        for (int j = 0; j <= 10; ++j) {
+            Point2d parameterValue(0.3 + i / 100.0, 0.6 + j / 100.0);
+            REQUIRE(squiggleBounds.contains(squiggle.evaluate(parameterValue)));
+        }
+    }
+}
+
+TEST_CASE("Mean value bounds") {
+    Parameter1d t;
+    ParametricExpression<double, double> parabola = t * (1.0 - t);
+    Interval meanValueBounds = parabola.evaluate(Interval(0.4, 0.6), MEAN_VALUE_BOUNDS);
+    REQUIRE(meanValueBounds.width() < 0.041);
+    REQUIRE(meanValueBounds.contains(0.24));
+    REQUIRE(meanValueBounds.contains(0.25));
+
+    // Overestimation should shrink quadratically with domain width
+    ParametricExpression<double, Point2d> squiggle = scalarSquiggle() * (2.0 - scalarSquiggle());
+    Point2d center(0.35, 0.65);
+    std::vector<double> excessWidths;
+    for (double radius = 1e-2; radius > 1e-4; radius /= 10) {
+        Box2d box(Interval(-radius, radius) + center.x(), Interval(-radius, radius) + center.y());
+        Interval meanValueBounds = squiggle.evaluate(box, MEAN_VALUE_BOUNDS);
+        REQUIRE(squiggle.evaluate(box).contains(meanValueBounds));
+        Interval sampledBounds;
+        for (int i = 0; i <= 10; ++i) {
+            for (int j = 0; j <= 10; ++j) {
+                Point2d parameterValue = box.interpolated(i / 10.0, j / 10.0);
+                double value = squiggle.evaluate(parameterValue);
+                REQUIRE(meanValueBounds.contains(value));
+                sampledBounds = sampledBounds.hull(value);
+            }
+        }
+        excessWidths.push_back(meanValueBounds.width() - sampledBounds.width());
+    }
+    REQUIRE(excessWidths[1] < 0.02 * excessWidths[0]);
+}
+
+TEST_CASE("Global optimization") {
+    Parameter1d t;
+    ParametricExpression<double, double> parabola = t * (1.0 - t);
+    GlobalOptimizer serialOptimizer(1e-9, false);
+    Extremum<double> parabolaMaximum = serialOptimizer.maximum(parabola, Interval(0.0, 1.0));
+    REQUIRE(parabolaMaximum.value.contains(0.25));
+    REQUIRE(parabolaMaximum.value.width() <= 1e-9);
+    REQUIRE((parabolaMaximum.parameterValue - 0.5) == Zero(1e-4));
+    Extremum<double> parabolaMinimum = serialOptimizer.minimum(parabola, Interval(0.2, 1.0));
+    REQUIRE(parabolaMinimum.value.contains(0.0));
+    REQUIRE((parabolaMinimum.parameterValue - 1.0) == Zero());
+
+    ParametricExpression<double, Point2d> squiggle = scalarSquiggle();
+    Box2d domain(Interval(0.0, 1.0), Interval(0.1, 0.9));
+    for (int parallel = 0; parallel <= 1; ++parallel) {
+        GlobalOptimizer optimizer(1e-9, parallel == 1);
+        Extremum<Point2d> minimum = optimizer.minimum(squiggle, domain);
+        REQUIRE(minimum.value.contains(-2.0));
+        REQUIRE(minimum.value.width() <= 1e-9);
+        REQUIRE((minimum.parameterValue - Point2d(0.75, 0.5)).norm() == Zero(1e-4));
+
+        Extremum<Point2d> maximum = optimizer.maximum(squiggle, domain);
+        REQUIRE(maximum.value.contains(1.0 + cos(0.2 * M_PI)));
+        REQUIRE(maximum.value.width() <= 1e-9);
+    }
+}
+
+TEST_CASE("Zeros") {
+    Parameter1d t;
+
+    std::vector<double> linearZeros = (t - 1.0).zeros(Interval(0.0, 2.0));
+    REQUIRE(linearZeros.size() == 1u);
+    REQUIRE((linearZeros[0] - 1.0) == Zero());
+
+    std::vector<double> quadraticZeros = (t.squared() - 1.0).zeros(Interval(-2.0, 2.0));
+    REQUIRE(quadraticZeros.size() == 2u);
+    REQUIRE((quadraticZeros[0] + 1.0) == Zero());
+    REQUIRE((quadraticZeros[1] - 1.0) == Zero());
+
+    // Double zero at t = 1 and simple zero at t = 2
+    ParametricExpression<double, double> cubic = t * t * t - 4.0 * t * t + 5.0 * t - 2.0;
+    std::vector<double> cubicZeros = cubic.zeros(Interval(0.0, 3.0), 1e-9);
+    REQUIRE(cubicZeros.size() == 2u);
+    REQUIRE((cubicZeros[0] - 1.0) == Zero(1e-8));
+    REQUIRE((cubicZeros[1] - 2.0) == Zero());
+
+    // Tangential zeros of sin(t) squared plus 2 sin(t) plus 1 (that is, (sin(t) + 1) squared)
+    ParametricExpression<double, double> tangential = sin(t).squared() + 2.0 * sin(t) + 1.0;
+    std::vector<double> tangentialZeros = tangential.zeros(Interval(-M_PI, 2 * M_PI), 1e-9);
+    REQUIRE(tangentialZeros.size() == 2u);
+    REQUIRE((tangentialZeros[0] + M_PI / 2) == Zero(1e-4));
+    REQUIRE((tangentialZeros[1] - 3 * M_PI / 2) == Zero(1e-4));
+
+    // Two nearby simple zeros at 1 +/- 1e-5
+    std::vector<double> nearbyZeros = ((t - 1.0).squared() - 1e-10).zeros(Interval(0.0, 2.0));
+    REQUIRE(nearbyZeros.size() == 2u);
+    REQUIRE((nearbyZeros[0] - (1.0 - 1e-5)) == Zero(1e-10));
+    REQUIRE((nearbyZeros[1] - (1.0 + 1e-5)) == Zero(1e-10));
+
+    REQUIRE((sqrt(t) - 0.5).zeros(Interval(0.0, 1.0)).size() == 1u);
+    REQUIRE((t.squared() + 1.0).zeros(Interval(-2.0, 2.0)).empty());
+
+    // Zero precision is relative to the magnitude of the expression, so tiny expressions still
+    // have well-defined zeros and tiny offsets are not mistaken for zeros
+    std::vector<double> scaledZeros = (1e-11 * (t - 0.3)).zeros(Interval(0.0, 1.0));
+    REQUIRE(scaledZeros.size() == 1u);
+    REQUIRE((scaledZeros[0] - 0.3) == Zero());
+    REQUIRE((t.squared() + 1e-11).zeros(Interval(-1.0, 1.0)).empty());
+
+    // Poles are not zeros (and bisecting at a pole must not fail)
+    REQUIRE((1.0 / t).zeros(Interval(-1.0, 1.0)).empty());
+    std::vector<double> poleZeros = (1.0 / t - 2.0).zeros(Interval(-1.0, 1.0));
+    REQUIRE(poleZeros.size() == 1u);
+    REQUIRE((poleZeros[0] - 0.5) == Zero());
+}
+
+TEST_CASE("Equation solving") {
+    Parameter2d u = Parameter2d(0);
+    Parameter2d v = Parameter2d(1);
+    Box2d domain(Interval(-2.0, 2.0), Interval(-2.0, 2.0));
+    double root = 1.0 / sqrt(2.0);
+
+    // Intersection of the unit circle with the line u = v
+    ParametricExpression<Vector2d, Point2d> circleLine =
+        ParametricExpression<Vector2d, Point2d>::fromComponents(u * u + v * v - 1.0, u - v);
+    for (int parallel = 0; parallel <= 1; ++parallel) {
+        EquationSolver solver(1e-12, parallel == 1);
+        std::vector<Solution<Point2d>> solutions = solver.solutions(circleLine, domain);
+        REQUIRE(solutions.size() == 2u);
+        REQUIRE(solutions[0].isUnique);
+        REQUIRE(solutions[1].isUnique);
+        REQUIRE((solutions[0].parameterValue - Point2d(-root, -root)).norm() == Zero());
+        REQUIRE((solutions[1].parameterValue - Point2d(root, root)).norm() == Zero());
+        REQUIRE(solutions[1].bounds.contains(Point2d(root, root)));
+    }
+
+    // Tangential intersection of the unit circle with the line v = 1 cannot be proven unique
+    ParametricExpression<Vector2d, Point2d> tangent =
+        ParametricExpression<Vector2d, Point2d>::fromComponents(u * u + v * v - 1.0, v - 1.0);
+    std::vector<Solution<Point2d>> tangentSolutions = EquationSolver(1e-9).solutions(
+        tangent,
+        domain
+    );
+    REQUIRE(tangentSolutions.size() == 1u);
+    REQUIRE((tangentSolutions[0].parameterValue - Point2d(0.0, 1.0)).norm() == Zero(1e-6));
+
+    // Unit sphere intersected with the line x = y = z
+    Parameter3d x = Parameter3d(0);
+    Parameter3d y = Parameter3d(1);
+    Parameter3d z = Parameter3d(2);
+    ParametricExpression<Vector3d, Point3d> sphereLine =
+        ParametricExpression<Vector3d, Point3d>::fromComponents(
+            x * x + y * y + z * z - 1.0,
+            x - y,
+            y - z
+        );
+    Box3d box(Interval(0.0, 2.0), Interval(-2.0, 2.0), Interval(-2.0, 2.0));
+    std::vector<Solution<Point3d>> sphereSolutions = EquationSolver().solutions(sphereLine, box);
+    REQUIRE(sphereSolutions.size() == 1u);
+    REQUIRE(sphereSolutions[0].isUnique);
+    double component = 1.0 / sqrt(3.0);
+    Point3d expected(component, component, component);
+    REQUIRE((sphereSolutions[0].parameterValue - expected).norm() == Zero());
+
+    // Scalar equations are also supported
+    Parameter1d t;
+    std::vector<Solution<double>> scalarSolutions = EquationSolver().solutions(
+        t.squared() - 2.0,
+        Interval(0.0, 2.0)
+    );
+    REQUIRE(scalarSolutions.size() == 1u);
+    REQUIRE((scalarSolutions[0].parameterValue - sqrt(2.0)) == Zero());
+
+    Box2d emptyDomain(Interval(2.0, 3.0), Interval(2.0, 3.0));
+    REQUIRE(EquationSolver().solutions(circleLine, emptyDomain).empty());
+
+    // Zero precision is relative to the magnitude of each equation
+    std::vector<Solution<Point2d>> scaledSolutions = EquationSolver().solutions(
+        1e-11 * circleLine,
+        domain
+    );
+    REQUIRE(scaledSolutions.size() == 2u);
+    REQUIRE((scaledSolutions[1].parameterValue - Point2d(root, root)).norm() == Zero());
+    ParametricExpression<Vector2d, Point2d> offsetCircleLine =
+        ParametricExpression<Vector2d, Point2d>::fromComponents(u * u + v * v + 1e-11, u - v);
+    REQUIRE(EquationSolver().solutions(offsetCircleLine, domain).empty());
+}
+
+TEST_CASE("Contraction") {
+    Parameter1d t;
+    Interval squareRootBounds = t.squared().contracted(Interval(0.0, 3.0), Interval(1.0, 4.0));
+    REQUIRE((squareRootBounds.lowerBound() - 1.0) == Zero());
+    REQUIRE((squareRootBounds.upperBound() - 2.0) == Zero());
+    REQUIRE(t.squared().contracted(Interval(0.0, 3.0), Interval(-2.0, -1.0)).isEmpty());
+
+    // Bounds propagate back through nested operations
+    ParametricExpression<double, double> exponential = exp(2.0 * t) + 1.0;
+    Interval exponentialBounds = exponential.contracted(
+        Interval(-5.0, 5.0),
+        Interval(2.0, exp(2.0) + 1.0)
+    );
+    REQUIRE(exponentialBounds.lowerBound() == Zero());
+    REQUIRE((exponentialBounds.upperBound() - 1.0) == Zero());
+
+    // Vector-valued expressions narrow each parameter using every component
+    Parameter2d u = Parameter2d(0);
+    Parameter2d v = Parameter2d(1);
+    ParametricExpression<Vector2d, Point2d> circleLine =
+        ParametricExpression<Vector2d, Point2d>::fromComponents(u * u + v * v, u - v);
+    Box2d circleLineBounds = circleLine.contracted(
+        Box2d(Interval(0.0, 2.0), Interval(-2.0, 2.0)),
+        IntervalVector2d(Interval(1.0), Interval(0.0))
+    );
+    double root = 1.0 / sqrt(2.0);
+    REQUIRE(circleLineBounds.contains(Point2d(root, root)));
+    REQUIRE(circleLineBounds.x().upperBound() < 1.0 + 1e-6);
+    REQUIRE(circleLineBounds.y().lowerBound() > -1e-6);
+    REQUIRE(circleLineBounds.y().upperBound() < 1.0 + 1e-6);
+
+    // Preimage of sin(t) in [0.5, 1] is [pi/6, 5pi/6]
+    std::vector<Interval> sinePreimage = sin(t).preimage(
+        Interval(0.5, 1.0),
+        Interval(0.0, 2 * M_PI)
+    );
+    REQUIRE_FALSE(sinePreimage.empty());
+    Interval sineHull = sinePreimage.front();
+    for (Interval interval : sinePreimage) {
+        sineHull = sineHull.hull(interval);
+    }
+    REQUIRE((sineHull.lowerBound() - M_PI / 6.0) == Zero(1e-6));
+    REQUIRE((sineHull.upperBound() - 5.0 * M_PI / 6.0) == Zero(1e-6));
+
+    // Preimage of an annulus covers it with little excess area
+    std::vector<Box2d> annulus = (u * u + v * v).preimage(
+        Interval(1.0, 4.0),
+        Box2d(Interval(-3.0, 3.0), Interval(-3.0, 3.0)),
+        1e-2
+    );
+    double area = 0.0;
+    for (const Box2d& box : annulus) {
+        area += box.x().width() * box.y().width();
+        Interval radius = sqrt(box.x().squared() + box.y().squared());
+        REQUIRE(radius.overlaps(Interval(1.0, 2.0)));
+    }
+    REQUIRE(area > 3 * M_PI - 1e-6);
+    REQUIRE(area < 3 * M_PI + 0.5);
+    Box2d unitBox(Interval(0.0, 1.0), Interval(0.0, 1.0));
+    REQUIRE((u * u + v * v).preimage(Interval(10.0, 20.0), unitBox).empty());
+
+    // Operand bounds that are or end at zero: every point (0, v) solves u * v = 0, so nothing
+    // can be removed, while a product bounded away from zero still narrows both operands
+    Box2d zeroBounds = (u * v).contracted(
+        Box2d(Interval(0.0, 0.0), Interval(0.0, 3.0)),
+        Interval(0.0, 1.0)
+    );
+    REQUIRE(zeroBounds.contains(Point2d(0.0, 0.0)));
+    REQUIRE(zeroBounds.contains(Point2d(0.0, 3.0)));
+    Box2d positiveBounds = (u * v).contracted(
+        Box2d(Interval(0.0, 2.0), Interval(0.0, 3.0)),
+        Interval(4.0, 6.0)
+    );
+    REQUIRE(positiveBounds.x().lowerBound() > 4.0 / 3.0 - 1e-6);
+    REQUIRE(positiveBounds.y().lowerBound() > 2.0 - 1e-6);
+    Box2d noSolution = (u * v).contracted(
+        Box2d(Interval(0.0, 0.0), Interval(-1.0, 1.0)),
+        Interval(1.0, 2.0)
+    );
+    REQUIRE(noSolution.isEmpty());
+    Interval reciprocalBounds = (1.0 / t).contracted(Interval(0.0, 2.0), Interval(1.0, 2.0));
+    REQUIRE((reciprocalBounds.lowerBound() - 0.5) == Zero(1e-9));
+    REQUIRE((reciprocalBounds.upperBound() - 1.0) == Zero(1e-9));
+
+    // Bisection gives boxes ending exactly at zero
+    std::vector<Box2d> hyperbola = (u * v).preimage(
+        Interval(0.0, 0.25),
+        Box2d(Interval(-1.0, 1.0), Interval(-1.0, 1.0)),
+        0.1
+    );
+    bool containsPositive = false;
+    bool containsAxis = false;
+    for (const Box2d& box : hyperbola) {
+        containsPositive = containsPositive || box.contains(Point2d(0.5, 0.25));
+        containsAxis = containsAxis || box.contains(Point2d(-0.5, 0.0));
+    }
+    REQUIRE(containsPositive);
+    REQUIRE(containsAxis);
+}
+
+TEST_CASE("B-spline expressions") {
+    // A quadratic B-spline with a single span is a Bezier curve
+    Parameter1d t;
+    std::vector<double> bezierKnots(3, 0.0);
+    bezierKnots.resize(6, 1.0);
+    std::vector<Point2d> bezierPoints;
+    bezierPoints.push_back(Point2d(0.0, 0.0));
+    bezierPoints.push_back(Point2d(1.0, 2.0));
+    bezierPoints.push_back(Point2d(3.0, 1.0));
+    ParametricExpression<Point2d, double> bezier =
+        ParametricExpression<Point2d, double>::bspline(2, bezierKnots, bezierPoints);
+    ParametricExpression<Vector2d, double> polynomial =
+        2.0 * t * (1.0 - t) * Vector2d(1.0, 2.0) + t.squared() * Vector2d(3.0, 1.0);
+    for (int i = 0; i <= 10; ++i) {
+        double parameterValue = i / 10.0;
+        Vector2d expected = polynomial.evaluate(parameterValue);
+        REQUIRE((bezier.evaluate(parameterValue) - Point2d::ORIGIN() - expected).isZero());
+        Vector2d expectedDerivative = polynomial.derivative().evaluate(parameterValue);
+        REQUIRE((bezier.derivative().evaluate(parameterValue) - expectedDerivative).isZero());
+    }
+
+    // Vector-valued splines work the same way
+    std::vector<Vector3d> bezierVectors;
+    bezierVectors.push_back(Vector3d(0.0, 0.0, 0.0));
+    bezierVectors.push_back(Vector3d(1.0, 2.0, -1.0));
+    bezierVectors.push_back(Vector3d(3.0, 1.0, 2.0));
+    ParametricExpression<Vector3d, double> vectorBezier =
+        ParametricExpression<Vector3d, double>::bspline(2, bezierKnots, bezierVectors);
+    ParametricExpression<Vector3d, double> vectorPolynomial =
+        2.0 * t * (1.0 - t) * Vector3d(1.0, 2.0, -1.0) + t.squared() * Vector3d(3.0, 1.0, 2.0);
+    for (int i = 0; i <= 10; ++i) {
+        double parameterValue = i / 10.0;
+        Vector3d expected = vectorPolynomial.evaluate(parameterValue);
+        REQUIRE((vectorBezier.evaluate(parameterValue) - expected).isZero());
+        Vector3d expectedDerivative = vectorPolynomial.derivative().evaluate(parameterValue);
+        Vector3d derivative = vectorBezier.derivative().evaluate(parameterValue);
+        REQUIRE((derivative - expectedDerivative).isZero());
+    }
+
+    // Rational quadratic quarter circle, evaluated through compiled bytecode and bounded over
+    // intervals spanning several knot spans
+    std::vector<double> circleKnots(3, 0.0);
+    circleKnots.resize(5, 0.5);
+    circleKnots.resize(8, 1.0);
+    std::vector<Point2d> circlePoints;
+    circlePoints.push_back(Point2d(1.0, 0.0));
+    circlePoints.push_back(Point2d(1.0, 1.0));
+    circlePoints.push_back(Point2d(0.0, 1.0));
+    circlePoints.push_back(Point2d(-1.0, 1.0));
+    circlePoints.push_back(Point2d(-1.0, 0.0));
+    std::vector<double> circleWeights(5, 1.0);
+    circleWeights[1] = sqrt(2.0) / 2.0;
+    circleWeights[3] = sqrt(2.0) / 2.0;
+    ParametricExpression<Point2d, double> arc = ParametricExpression<Point2d, double>::bspline(
+        2,
+        circleKnots,
+        circlePoints,
+        circleWeights
+    );
+    Interval domain(0.1, 0.8);
+    Box2d arcBounds = arc.evaluate(domain);
+    for (int i = 0; i <= 20; ++i) {
+        double parameterValue = domain.interpolated(i / 20.0);
+        Point2d point = arc.evaluate(parameterValue);
+        REQUIRE(((point - Point2d::ORIGIN()).norm() - 1.0) == Zero());
+        REQUIRE(arcBounds.contains(point));
+
+        double step = 1e-6;
+        Vector2d numericalDerivative =
+            (arc.evaluate(parameterValue + step) - arc.evaluate(parameterValue - step)) /
+            (2 * step);
+        Vector2d derivative = arc.derivative().evaluate(parameterValue);
+        REQUIRE((derivative - numericalDerivative).isZero(1e-6));
+    }
+    REQUIRE(arcBounds.x().width() < 2.0);
+    REQUIRE(arcBounds.y().upperBound() < 1.0 + 1e-12);
+
+    // Bilinear surface patch
+    Parameter2d u = Parameter2d(0);
+    Parameter2d v = Parameter2d(1);
+    std::vector<double> linearKnots(2, 0.0);
+    linearKnots.resize(4, 1.0);
+    std::vector<std::vector<double>> heights(2, std::vector<double>(2));
+    heights[0][1] = 1.0;
+    heights[1][0] = 2.0;
+    heights[1][1] = 4.0;
+    ParametricExpression<double, Point2d> patch =
+        ParametricExpression<double, Point2d>::bspline(1, 1, linearKnots, linearKnots, heights);
+    ParametricExpression<double, Point2d> bilinear =
+        2.0 * u * (1.0 - v) + v * (1.0 - u) + 4.0 * u * v;
+    for (int i = 0; i <= 4; ++i) {
+        for (int j = 0; j <= 4; ++j) {
+            Point2d parameterValue(i / 4.0, j / 4.0);
+            double expected = bilinear.evaluate(parameterValue);
+            REQUIRE((patch.evaluate(parameterValue) - expected) == Zero());
+            double expectedDerivative = bilinear.derivative(v).evaluate(parameterValue);
+            REQUIRE((patch.derivative(v).evaluate(parameterValue) - expectedDerivative) == Zero());
+        }
+    }
+    Interval patchBounds = patch.evaluate(Box2d(Interval(0.0, 0.5), Interval(0.0, 0.5)));
+    REQUIRE(patchBounds.lowerBound() == Zero());
+    REQUIRE((patchBounds.upperBound() - 1.75) == Zero());
+
+    // Control points and weights must be consistent
+    std::vector<double> shortWeights(2, 1.0);
+    typedef ParametricExpression<Point2d, double> Curve;
+    REQUIRE_THROWS(Curve::bspline(2, bezierKnots, bezierPoints, shortWeights));
+
+    // Splines differing only in their control points should hash differently
+    std::vector<Point2d> otherPoints = bezierPoints;
+    otherPoints[1] = Point2d(1.0, 3.0);
+    Curve otherBezier = Curve::bspline(2, bezierKnots, otherPoints);
+    REQUIRE(
+        bezier.implementation()->structuralHash() !=
+        otherBezier.implementation()->structuralHash()
+    );
+    REQUIRE_FALSE(bezier.implementation()->isDuplicateOf(otherBezier.implementation()));
+}
+
+TEST_CASE("Polynomial expressions") {
+    // 1 - 2t + 3t^2 - t^3
+    Parameter1d t;
+    std::vector<double> coefficients(4);
+    coefficients[0] = 1.0;
+    coefficients[1] = -2.0;
+    coefficients[2] = 3.0;
+    coefficients[3] = -1.0;
+    ParametricExpression<double, double> cubic =
+        ParametricExpression<double, double>::polynomial(coefficients);
+    ParametricExpression<double, double> expanded = 1.0 - 2.0 * t + 3.0 * t.squared() - t * t * t;
+    for (int i = 0; i <= 10; ++i) {
+        double parameterValue = -1.0 + i / 5.0;
+        REQUIRE((cubic.evaluate(parameterValue) - expanded.evaluate(parameterValue)) == Zero());
+        double derivativeValue = cubic.derivative().evaluate(parameterValue);
+        REQUIRE((derivativeValue - expanded.derivative().evaluate(parameterValue)) == Zero());
+        double secondDerivativeValue = cubic.derivative().derivative().evaluate(parameterValue);
+        REQUIRE((secondDerivativeValue - (6.0 - 6.0 * parameterValue)) == Zero());
+    }
+
+    // Centered form bounds (used for contraction and optimization) are much tighter than
+    // natural bounds on small intervals
+    Interval domain(0.4, 0.5);
+    const detail::PolynomialExpression* cubicPtr =
+        cubic.implementation()->cast<detail::PolynomialExpression>();
+    Interval centeredBounds;
+    cubicPtr->evaluate(&domain, &centeredBounds);
+    Interval hornerBounds = cubic.evaluate(domain);
+    REQUIRE(hornerBounds.width() < expanded.evaluate(domain).width());
+    REQUIRE(centeredBounds.width() < 0.5 * hornerBounds.width());
+    for (int i = 0; i <= 10; ++i) {
+        double value = cubic.evaluate(domain.interpolated(i / 10.0));
+        REQUIRE(centeredBounds.contains(value));
+        REQUIRE(hornerBounds.contains(value));
+    }
+    REQUIRE(cubic.evaluate(Interval::WHOLE()) == Interval::WHOLE());
+
+    // Polynomials differing only in their coefficients should hash differently (so that
+    // they do not all end up in the same bucket when interning or deduplicating)
+    std::vector<double> otherCoefficients = coefficients;
+    otherCoefficients[2] = 4.0;
+    ParametricExpression<double, double> otherCubic =
+        ParametricExpression<double, double>::polynomial(otherCoefficients);
+    REQUIRE(
+        cubic.implementation()->structuralHash() !=
+        otherCubic.implementation()->structuralHash()
+    );
+    REQUIRE_FALSE(cubic.implementation()->isDuplicateOf(otherCubic.implementation()));
+
+    // Vector-valued surface polynomial (u, v, u * v)
+    Parameter2d u = Parameter2d(0);
+    Parameter2d v = Parameter2d(1);
+    std::vector<std::vector<Vector3d>> surfaceCoefficients(2, std::vector<Vector3d>(2));
+    surfaceCoefficients[0][1] = Vector3d(0.0, 1.0, 0.0);
+    surfaceCoefficients[1][0] = Vector3d(1.0, 0.0, 0.0);
+    surfaceCoefficients[1][1] = Vector3d(0.0, 0.0, 1.0);
+    ParametricExpression<Vector3d, Point2d> saddle =
+        ParametricExpression<Vector3d, Point2d>::polynomial(surfaceCoefficients);
+    ParametricExpression<Vector3d, Point2d> expectedSaddle =
+        ParametricExpression<Vector3d, Point2d>::fromComponents(u, v, u * v);
+    for (int i = 0; i <= 4; ++i) {
+        for (int j = 0; j <= 4; ++j) {
+            Point2d parameterValue(i / 4.0, j / 4.0);
+            Vector3d value = saddle.evaluate(parameterValue);
+            REQUIRE((value - expectedSaddle.evaluate(parameterValue)).isZero());
+            Vector3d derivative = saddle.derivative(u).evaluate(parameterValue);
+            REQUIRE((derivative - expectedSaddle.derivative(u).evaluate(parameterValue)).isZero());
+        }
+    }
+    Matrix<double, 3, 2> jacobian = saddle.jacobian(Point2d(0.5, 0.25));
+    REQUIRE((jacobian(2, 0) - 0.25) == Zero());
+    REQUIRE((jacobian(2, 1) - 0.5) == Zero());
+
+    // Transformations are applied directly to the coefficients
+    ParametricExpression<double, double> transformed = 2.0 * cubic + 1.0;
+    REQUIRE((transformed.evaluate(2.0) - 2.0 * cubic.evaluate(2.0) - 1.0) == Zero());
+}
+
 TEST_CASE("Dot product with constant") {
     Parameter1d t;
     ParametricExpression<Vector3d, double> line = (
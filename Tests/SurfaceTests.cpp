@@ -0,0 +1,134 @@
+/************************************************************************************
+*                                                                                   *
+*  OpenSolid is a generic library for the representation and manipulation of        *
+*  geometric objects such as points, curves, surfaces, and volumes.                 *
+*                                                                                   *
+*  Copyright (C) 2007-2014 by Ian Mackenzie                                         *
+*  ian.e.mackenzie@gmail.com                                                        *
+*                                                                                   *
+*  This library is free software; you can redistribute it and/or                    *
+*  modify it under the terms of the GNU Lesser General Public                       *
+*  License as published by the Free Software Foundation; either                     *
+*  version 2.1 of the License, or (at your option) any later version.               *
+*                                                                                   *
+*  This library is distributed in the hope that it will be useful,                  *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of                   *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU                *
+*  Lesser General Public License for more details.                                  *
+*                                                                                   *
+*  You should have received a copy of the GNU Lesser General Public                 *
+*  License along with this library; if not, write to the Free Software              *
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA   *
+*                                                                                   *
+************************************************************************************/
+
+#include <OpenSolid/Core/BoundedArea.hpp>
+#include <OpenSolid/Core/Parameter.hpp>
+#include <OpenSolid/Core/ParametricCurve.hpp>
+#include <OpenSolid/Core/ParametricSurface.hpp>
+#include <OpenSolid/Core/SpatialSet.hpp>
+#include <OpenSolid/Core/SurfaceMesh.hpp>
+#include <OpenSolid/Core/Triangle.hpp>
+#include <OpenSolid/Core/Zero.hpp>
+
+#include <catch/catch.hpp>
+
+#include <algorithm>
+#include <vector>
+
+using namespace opensolid;
+
+ParametricCurve2d
+line(const Point2d& startPoint, const Point2d& endPoint) {
+    Parameter1d t;
+    return ParametricCurve2d(startPoint + t * (endPoint - startPoint), Interval::UNIT());
+}
+
+TEST_CASE("Surface tessellation") {
+    // Half cylinder of radius 2 and height 3, with a circular hole of radius 0.5 in the
+    // parameter domain
+    double chordTolerance = 1e-3;
+    double angleTolerance = 0.2;
+    Point2d holeCenter(M_PI / 2, 1.5);
+    std::vector<ParametricCurve2d> curves;
+    curves.push_back(line(Point2d(0, 0), Point2d(M_PI, 0)));
+    curves.push_back(line(Point2d(M_PI, 0), Point2d(M_PI, 3)));
+    curves.push_back(line(Point2d(M_PI, 3), Point2d(0, 3)));
+    curves.push_back(line(Point2d(0, 3), Point2d(0, 0)));
+    curves.push_back(ParametricCurve2d::circle(holeCenter, 0.5));
+    BoundedArea2d domain((SpatialSet<ParametricCurve2d>(std::move(curves))));
+
+    Parameter2d u = Parameter2d(0);
+    Parameter2d v = Parameter2d(1);
+    ParametricSurface3d cylinder(
+        ParametricExpression<Point3d, Point2d>::fromComponents(2.0 * cos(u), 2.0 * sin(u), v),
+        domain
+    );
+    SurfaceMesh3d mesh = cylinder.tessellate(chordTolerance, angleTolerance);
+    REQUIRE(!mesh.isEmpty());
+    REQUIRE(mesh.normals().size() == mesh.vertices().size());
+    REQUIRE(mesh.parameterValues().size() == mesh.vertices().size());
+    REQUIRE(mesh.indices().size() == 3u * mesh.numTriangles());
+
+    // Vertices are on the cylinder, with outward normals, and none are inside the hole (other
+    // than by the chord tolerance, for vertices on the tessellated boundary)
+    for (std::size_t index = 0; index < mesh.vertices().size(); ++index) {
+        Point3d vertex = mesh.vertices()[index];
+        Vector3d radialVector(vertex.x() / 2, vertex.y() / 2, 0.0);
+        REQUIRE((radialVector.norm() - 1.0) == Zero());
+        REQUIRE((mesh.normals()[index].dot(radialVector) - 1.0) == Zero(1e-9));
+        REQUIRE(((mesh.parameterValues()[index] - holeCenter).norm() - 0.5) >= -chordTolerance);
+    }
+
+    // Triangles are close to the surface, wind counterclockwise around the normals and cover
+    // the trimmed area (6 * pi for the half cylinder, less pi / 2 for the hole)
+    double area = 0.0;
+    for (int index = 0; index < mesh.numTriangles(); ++index) {
+        Triangle3d triangle = mesh.triangle(index);
+        Point3d centroid = triangle.centroid();
+        double radius = Vector3d(centroid.x(), centroid.y(), 0.0).norm();
+        REQUIRE(radius >= 2.0 - chordTolerance);
+        Vector3d outwardVector(centroid.x(), centroid.y(), 0.0);
+        REQUIRE(triangle.normalVector().dot(outwardVector) > 0.0);
+        area += triangle.area();
+    }
+    REQUIRE((area - 5.5 * M_PI) == Zero(0.1));
+
+    // Left-handed surfaces get reversed normals and triangles
+    ParametricSurface3d reversed(cylinder.expression(), domain, Handedness::LEFT_HANDED());
+    SurfaceMesh3d reversedMesh = reversed.tessellate(chordTolerance, angleTolerance);
+    REQUIRE(reversedMesh.numTriangles() == mesh.numTriangles());
+    Triangle3d reversedTriangle = reversedMesh.triangle(0);
+    REQUIRE(reversedTriangle.normalVector().dot(reversedMesh.normals()[0]) > 0.0);
+    REQUIRE(reversedMesh.normals()[0].dot(mesh.normals()[0]) < 0.0);
+
+    // Tolerances must be positive
+    REQUIRE_THROWS(cylinder.tessellate(0.0, angleTolerance));
+
+
+    // The angle tolerance should still be respected when the chord tolerance is larger than
+    // the whole surface (the first derivatives of a cylinder are never zero, so no cells are
+    // exempt from the angle check)
+    std::vector<ParametricCurve2d> rectangleCurves;
+    rectangleCurves.push_back(line(Point2d(0, 0), Point2d(M_PI, 0)));
+    rectangleCurves.push_back(line(Point2d(M_PI, 0), Point2d(M_PI, 3)));
+    rectangleCurves.push_back(line(Point2d(M_PI, 3), Point2d(0, 3)));
+    rectangleCurves.push_back(line(Point2d(0, 3), Point2d(0, 0)));
+    ParametricSurface3d untrimmedCylinder(
+        cylinder.expression(),
+        BoundedArea2d(SpatialSet<ParametricCurve2d>(std::move(rectangleCurves)))
+    );
+    SurfaceMesh3d coarseMesh = untrimmedCylinder.tessellate(10.0, angleTolerance);
+    for (int index = 0; index < coarseMesh.numTriangles(); ++index) {
+        double minU = M_PI;
+        double maxU = 0.0;
+        for (int vertexIndex = 0; vertexIndex < 3; ++vertexIndex) {
+            int meshIndex = coarseMesh.indices()[3 * index + vertexIndex];
+            double u = coarseMesh.parameterValues()[meshIndex].x();
+            minU = std::min(minU, u);
+            maxU = std::max(maxU, u);
+        }
+        // The tangent of a cylinder turns by exactly the change in u
+        REQUIRE((maxU - minU) <= angleTolerance);
+    }
+}
@@ -112,7 +112,8 @@ for path, directories, files in os.walk(sys.argv[1]):
     i = 0
     while i < len(directories):
         directory = directories[i]
-        if directory in ['Bindings', 'External', 'IO', 'Python', 'UI', '.hg'] or directory.lower().startswith('build'):
+        isBuildDirectory = directory.lower().startswith('build') or os.path.exists(os.path.join(path, directory, 'CMakeCache.txt'))
+        if directory in ['Bindings', 'External', 'IO', 'Python', 'UI', '.hg'] or isBuildDirectory:
             del directories[i]
         else:
             i = i + 1
@@ -0,0 +1,100 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/OpenSolid/Core/AffineForm.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/AffineForm.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/AffineForm.cpp.o.d"
+  "/root/repo/OpenSolid/Core/Axis.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Axis.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Axis.cpp.o.d"
+  "/root/repo/OpenSolid/Core/AxisPlaneIntersection3d.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/AxisPlaneIntersection3d.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/AxisPlaneIntersection3d.cpp.o.d"
+  "/root/repo/OpenSolid/Core/AxisTriangleIntersection3d.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/AxisTriangleIntersection3d.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/AxisTriangleIntersection3d.cpp.o.d"
+  "/root/repo/OpenSolid/Core/BoundedArea.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/BoundedArea.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/BoundedArea.cpp.o.d"
+  "/root/repo/OpenSolid/Core/BoundedVolume.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/BoundedVolume.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/BoundedVolume.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ChebyshevProxy.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ChebyshevProxy.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ChebyshevProxy.cpp.o.d"
+  "/root/repo/OpenSolid/Core/Circle.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Circle.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Circle.cpp.o.d"
+  "/root/repo/OpenSolid/Core/Component.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Component.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Component.cpp.o.d"
+  "/root/repo/OpenSolid/Core/EquationSolver.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/EquationSolver.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/EquationSolver.cpp.o.d"
+  "/root/repo/OpenSolid/Core/Error.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Error.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Error.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ExpressionInterning.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ExpressionInterning.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ExpressionInterning.cpp.o.d"
+  "/root/repo/OpenSolid/Core/Frame.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Frame.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Frame.cpp.o.d"
+  "/root/repo/OpenSolid/Core/GlobalOptimizer.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/GlobalOptimizer.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/GlobalOptimizer.cpp.o.d"
+  "/root/repo/OpenSolid/Core/Intersection/XAxisTriangleIntersection2d.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Intersection/XAxisTriangleIntersection2d.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Intersection/XAxisTriangleIntersection2d.cpp.o.d"
+  "/root/repo/OpenSolid/Core/Interval.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Interval.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Interval.cpp.o.d"
+  "/root/repo/OpenSolid/Core/LineSegmentPlaneIntersection3d.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/LineSegmentPlaneIntersection3d.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/LineSegmentPlaneIntersection3d.cpp.o.d"
+  "/root/repo/OpenSolid/Core/NativeCode.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/NativeCode.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/NativeCode.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricArea.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricArea.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricArea.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricCurve.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricCurve.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricCurve.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricCurve/CurveTessellator.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricCurve/CurveTessellator.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricCurve/CurveTessellator.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/ArccosineExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/ArccosineExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/ArccosineExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/ArcsineExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/ArcsineExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/ArcsineExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/BSplineExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/BSplineExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/BSplineExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/BinaryOperation.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/BinaryOperation.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/BinaryOperation.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/Bytecode/BatchKernels.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/Bytecode/BatchKernels.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/Bytecode/BatchKernels.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/Bytecode/Bytecode.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/Bytecode/Bytecode.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/Bytecode/Bytecode.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/Bytecode/Compiler.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/Bytecode/Compiler.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/Bytecode/Compiler.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/Bytecode/Evaluator.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/Bytecode/Evaluator.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/Bytecode/Evaluator.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/CompiledExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/CompiledExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/CompiledExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/ComponentsExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/ComponentsExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/ComponentsExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/CompositionExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/CompositionExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/CompositionExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/ConcatenationExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/ConcatenationExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/ConcatenationExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/ConstantExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/ConstantExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/ConstantExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/Contractor.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/Contractor.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/Contractor.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/CosineExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/CosineExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/CosineExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/CrossProductExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/CrossProductExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/CrossProductExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/DifferenceExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/DifferenceExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/DifferenceExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/DotProductExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/DotProductExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/DotProductExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/EvaluationWorkspace.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/EvaluationWorkspace.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/EvaluationWorkspace.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/ExponentialExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/ExponentialExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/ExponentialExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/ExpressionImplementation.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/ExpressionImplementation.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/ExpressionImplementation.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/IdentityExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/IdentityExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/IdentityExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/LogarithmExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/LogarithmExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/LogarithmExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/NegatedExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/NegatedExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/NegatedExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/NormExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/NormExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/NormExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/NormalizedExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/NormalizedExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/NormalizedExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/ParameterExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/ParameterExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/ParameterExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/PolynomialExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/PolynomialExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/PolynomialExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/PowerExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/PowerExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/PowerExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/ProductExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/ProductExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/ProductExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/QuotientExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/QuotientExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/QuotientExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/ScalingExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/ScalingExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/ScalingExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/Simplifier.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/Simplifier.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/Simplifier.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/SineExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/SineExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/SineExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/SquareRootExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/SquareRootExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/SquareRootExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/SquaredNormExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/SquaredNormExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/SquaredNormExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/SumExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/SumExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/SumExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/TangentExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/TangentExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/TangentExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/TransformationExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/TransformationExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/TransformationExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/TranslationExpression.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/TranslationExpression.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/TranslationExpression.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/UnaryOperation.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/UnaryOperation.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/UnaryOperation.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricExpression/ZeroFinder.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/ZeroFinder.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricExpression/ZeroFinder.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricSurface.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricSurface.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricSurface.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ParametricVolume.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricVolume.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ParametricVolume.cpp.o.d"
+  "/root/repo/OpenSolid/Core/Plane.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Plane.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Plane.cpp.o.d"
+  "/root/repo/OpenSolid/Core/Point.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Point.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Point.cpp.o.d"
+  "/root/repo/OpenSolid/Core/Quaternion.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Quaternion.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Quaternion.cpp.o.d"
+  "/root/repo/OpenSolid/Core/SurfaceTessellator.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/SurfaceTessellator.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/SurfaceTessellator.cpp.o.d"
+  "/root/repo/OpenSolid/Core/Tetrahedron.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Tetrahedron.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Tetrahedron.cpp.o.d"
+  "/root/repo/OpenSolid/Core/ThreadPool.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ThreadPool.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/ThreadPool.cpp.o.d"
+  "/root/repo/OpenSolid/Core/Triangle.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Triangle.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Triangle.cpp.o.d"
+  "/root/repo/OpenSolid/Core/UnitVector.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/UnitVector.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/UnitVector.cpp.o.d"
+  "/root/repo/OpenSolid/Core/Variant.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Variant.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Variant.cpp.o.d"
+  "/root/repo/OpenSolid/Core/Variant/ComponentValue.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Variant/ComponentValue.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Variant/ComponentValue.cpp.o.d"
+  "/root/repo/OpenSolid/Core/Variant/DoubleValue.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Variant/DoubleValue.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Variant/DoubleValue.cpp.o.d"
+  "/root/repo/OpenSolid/Core/Variant/IntValue.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Variant/IntValue.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Variant/IntValue.cpp.o.d"
+  "/root/repo/OpenSolid/Core/Variant/IntervalValue.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Variant/IntervalValue.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Variant/IntervalValue.cpp.o.d"
+  "/root/repo/OpenSolid/Core/Variant/StringValue.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Variant/StringValue.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Variant/StringValue.cpp.o.d"
+  "/root/repo/OpenSolid/Core/Variant/VariantValue.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Variant/VariantValue.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Variant/VariantValue.cpp.o.d"
+  "/root/repo/OpenSolid/Core/Vector.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Vector.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Vector.cpp.o.d"
+  "/root/repo/OpenSolid/Core/Zero.cpp" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Zero.cpp.o" "gcc" "OpenSolid/Core/CMakeFiles/OpenSolidCore.dir/Zero.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,173 @@
+file(REMOVE_RECURSE
+  "../../bin/libOpenSolidCore.pdb"
+  "../../bin/libOpenSolidCore.so"
+  "CMakeFiles/OpenSolidCore.dir/AffineForm.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/AffineForm.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/Axis.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/Axis.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/AxisPlaneIntersection3d.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/AxisPlaneIntersection3d.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/AxisTriangleIntersection3d.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/AxisTriangleIntersection3d.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/BoundedArea.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/BoundedArea.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/BoundedVolume.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/BoundedVolume.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ChebyshevProxy.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ChebyshevProxy.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/Circle.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/Circle.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/Component.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/Component.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/EquationSolver.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/EquationSolver.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/Error.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/Error.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ExpressionInterning.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ExpressionInterning.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/Frame.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/Frame.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/GlobalOptimizer.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/GlobalOptimizer.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/Intersection/XAxisTriangleIntersection2d.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/Intersection/XAxisTriangleIntersection2d.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/Interval.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/Interval.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/LineSegmentPlaneIntersection3d.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/LineSegmentPlaneIntersection3d.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/NativeCode.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/NativeCode.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricArea.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricArea.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricCurve.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricCurve.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricCurve/CurveTessellator.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricCurve/CurveTessellator.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/ArccosineExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/ArccosineExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/ArcsineExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/ArcsineExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/BSplineExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/BSplineExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/BinaryOperation.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/BinaryOperation.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/Bytecode/BatchKernels.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/Bytecode/BatchKernels.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/Bytecode/Bytecode.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/Bytecode/Bytecode.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/Bytecode/Compiler.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/Bytecode/Compiler.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/Bytecode/Evaluator.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/Bytecode/Evaluator.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/CompiledExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/CompiledExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/ComponentsExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/ComponentsExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/CompositionExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/CompositionExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/ConcatenationExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/ConcatenationExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/ConstantExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/ConstantExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/Contractor.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/Contractor.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/CosineExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/CosineExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/CrossProductExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/CrossProductExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/DifferenceExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/DifferenceExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/DotProductExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/DotProductExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/EvaluationWorkspace.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/EvaluationWorkspace.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/ExponentialExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/ExponentialExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/ExpressionImplementation.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/ExpressionImplementation.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/IdentityExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/IdentityExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/LogarithmExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/LogarithmExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/NegatedExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/NegatedExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/NormExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/NormExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/NormalizedExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/NormalizedExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/ParameterExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/ParameterExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/PolynomialExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/PolynomialExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/PowerExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/PowerExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/ProductExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/ProductExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/QuotientExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/QuotientExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/ScalingExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/ScalingExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/Simplifier.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/Simplifier.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/SineExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/SineExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/SquareRootExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/SquareRootExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/SquaredNormExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/SquaredNormExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/SumExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/SumExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/TangentExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/TangentExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/TransformationExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/TransformationExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/TranslationExpression.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/TranslationExpression.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/UnaryOperation.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/UnaryOperation.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/ZeroFinder.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricExpression/ZeroFinder.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricSurface.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricSurface.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ParametricVolume.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ParametricVolume.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/Plane.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/Plane.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/Point.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/Point.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/Quaternion.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/Quaternion.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/SurfaceTessellator.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/SurfaceTessellator.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/Tetrahedron.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/Tetrahedron.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/ThreadPool.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/ThreadPool.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/Triangle.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/Triangle.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/UnitVector.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/UnitVector.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/Variant.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/Variant.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/Variant/ComponentValue.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/Variant/ComponentValue.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/Variant/DoubleValue.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/Variant/DoubleValue.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/Variant/IntValue.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/Variant/IntValue.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/Variant/IntervalValue.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/Variant/IntervalValue.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/Variant/StringValue.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/Variant/StringValue.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/Variant/VariantValue.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/Variant/VariantValue.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/Vector.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/Vector.cpp.o.d"
+  "CMakeFiles/OpenSolidCore.dir/Zero.cpp.o"
+  "CMakeFiles/OpenSolidCore.dir/Zero.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/OpenSolidCore.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
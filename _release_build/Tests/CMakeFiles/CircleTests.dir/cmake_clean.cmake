@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/CircleTests"
+  "../bin/CircleTests.pdb"
+  "CMakeFiles/CircleTests.dir/CircleTests.cpp.o"
+  "CMakeFiles/CircleTests.dir/CircleTests.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CircleTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
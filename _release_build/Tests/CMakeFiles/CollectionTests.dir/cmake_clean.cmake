@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/CollectionTests"
+  "../bin/CollectionTests.pdb"
+  "CMakeFiles/CollectionTests.dir/CollectionTests.cpp.o"
+  "CMakeFiles/CollectionTests.dir/CollectionTests.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CollectionTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/CoordinateSystemTests"
+  "../bin/CoordinateSystemTests.pdb"
+  "CMakeFiles/CoordinateSystemTests.dir/CoordinateSystemTests.cpp.o"
+  "CMakeFiles/CoordinateSystemTests.dir/CoordinateSystemTests.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CoordinateSystemTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
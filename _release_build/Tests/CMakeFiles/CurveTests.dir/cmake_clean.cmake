@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/CurveTests"
+  "../bin/CurveTests.pdb"
+  "CMakeFiles/CurveTests.dir/CurveTests.cpp.o"
+  "CMakeFiles/CurveTests.dir/CurveTests.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CurveTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/DatumTests"
+  "../bin/DatumTests.pdb"
+  "CMakeFiles/DatumTests.dir/DatumTests.cpp.o"
+  "CMakeFiles/DatumTests.dir/DatumTests.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DatumTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/IntervalTests"
+  "../bin/IntervalTests.pdb"
+  "CMakeFiles/IntervalTests.dir/IntervalTests.cpp.o"
+  "CMakeFiles/IntervalTests.dir/IntervalTests.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/IntervalTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
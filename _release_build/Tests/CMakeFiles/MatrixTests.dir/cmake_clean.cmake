@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/MatrixTests"
+  "../bin/MatrixTests.pdb"
+  "CMakeFiles/MatrixTests.dir/MatrixTests.cpp.o"
+  "CMakeFiles/MatrixTests.dir/MatrixTests.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MatrixTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
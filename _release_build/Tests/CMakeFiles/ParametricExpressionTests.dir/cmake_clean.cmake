@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/ParametricExpressionTests"
+  "../bin/ParametricExpressionTests.pdb"
+  "CMakeFiles/ParametricExpressionTests.dir/ParametricExpressionTests.cpp.o"
+  "CMakeFiles/ParametricExpressionTests.dir/ParametricExpressionTests.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ParametricExpressionTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
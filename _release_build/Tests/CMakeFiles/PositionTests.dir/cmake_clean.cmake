@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/PositionTests"
+  "../bin/PositionTests.pdb"
+  "CMakeFiles/PositionTests.dir/PositionTests.cpp.o"
+  "CMakeFiles/PositionTests.dir/PositionTests.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PositionTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/QuaternionTests"
+  "../bin/QuaternionTests.pdb"
+  "CMakeFiles/QuaternionTests.dir/QuaternionTests.cpp.o"
+  "CMakeFiles/QuaternionTests.dir/QuaternionTests.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/QuaternionTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/SetTests"
+  "../bin/SetTests.pdb"
+  "CMakeFiles/SetTests.dir/SetTests.cpp.o"
+  "CMakeFiles/SetTests.dir/SetTests.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SetTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/SimplexTests"
+  "../bin/SimplexTests.pdb"
+  "CMakeFiles/SimplexTests.dir/SimplexTests.cpp.o"
+  "CMakeFiles/SimplexTests.dir/SimplexTests.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SimplexTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/SphereTests"
+  "../bin/SphereTests.pdb"
+  "CMakeFiles/SphereTests.dir/SphereTests.cpp.o"
+  "CMakeFiles/SphereTests.dir/SphereTests.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SphereTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/SurfaceTests"
+  "../bin/SurfaceTests.pdb"
+  "CMakeFiles/SurfaceTests.dir/SurfaceTests.cpp.o"
+  "CMakeFiles/SurfaceTests.dir/SurfaceTests.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SurfaceTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
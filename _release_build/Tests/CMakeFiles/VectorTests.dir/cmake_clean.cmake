@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/VectorTests"
+  "../bin/VectorTests.pdb"
+  "CMakeFiles/VectorTests.dir/VectorTests.cpp.o"
+  "CMakeFiles/VectorTests.dir/VectorTests.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/VectorTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
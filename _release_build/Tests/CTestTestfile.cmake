@@ -0,0 +1,38 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests
+# Build directory: /root/repo/_release_build/Tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(SourceChecks "/root/.pyenv/shims/python" "/root/repo/Tests/checker.py" "/root/repo")
+set_tests_properties(SourceChecks PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;19;add_test;/root/repo/Tests/CMakeLists.txt;0;")
+add_test(CircleTests "/root/repo/_release_build/bin/CircleTests")
+set_tests_properties(CircleTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;11;add_test;/root/repo/Tests/CMakeLists.txt;28;add_simple_test;/root/repo/Tests/CMakeLists.txt;0;")
+add_test(CollectionTests "/root/repo/_release_build/bin/CollectionTests")
+set_tests_properties(CollectionTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;11;add_test;/root/repo/Tests/CMakeLists.txt;29;add_simple_test;/root/repo/Tests/CMakeLists.txt;0;")
+add_test(CoordinateSystemTests "/root/repo/_release_build/bin/CoordinateSystemTests")
+set_tests_properties(CoordinateSystemTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;11;add_test;/root/repo/Tests/CMakeLists.txt;30;add_simple_test;/root/repo/Tests/CMakeLists.txt;0;")
+add_test(CurveTests "/root/repo/_release_build/bin/CurveTests")
+set_tests_properties(CurveTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;11;add_test;/root/repo/Tests/CMakeLists.txt;31;add_simple_test;/root/repo/Tests/CMakeLists.txt;0;")
+add_test(DatumTests "/root/repo/_release_build/bin/DatumTests")
+set_tests_properties(DatumTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;11;add_test;/root/repo/Tests/CMakeLists.txt;32;add_simple_test;/root/repo/Tests/CMakeLists.txt;0;")
+add_test(IntervalTests "/root/repo/_release_build/bin/IntervalTests")
+set_tests_properties(IntervalTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;11;add_test;/root/repo/Tests/CMakeLists.txt;33;add_simple_test;/root/repo/Tests/CMakeLists.txt;0;")
+add_test(MatrixTests "/root/repo/_release_build/bin/MatrixTests")
+set_tests_properties(MatrixTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;11;add_test;/root/repo/Tests/CMakeLists.txt;34;add_simple_test;/root/repo/Tests/CMakeLists.txt;0;")
+add_test(ParametricExpressionTests "/root/repo/_release_build/bin/ParametricExpressionTests")
+set_tests_properties(ParametricExpressionTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;11;add_test;/root/repo/Tests/CMakeLists.txt;35;add_simple_test;/root/repo/Tests/CMakeLists.txt;0;")
+add_test(PositionTests "/root/repo/_release_build/bin/PositionTests")
+set_tests_properties(PositionTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;11;add_test;/root/repo/Tests/CMakeLists.txt;36;add_simple_test;/root/repo/Tests/CMakeLists.txt;0;")
+add_test(QuaternionTests "/root/repo/_release_build/bin/QuaternionTests")
+set_tests_properties(QuaternionTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;11;add_test;/root/repo/Tests/CMakeLists.txt;37;add_simple_test;/root/repo/Tests/CMakeLists.txt;0;")
+add_test(SetTests "/root/repo/_release_build/bin/SetTests")
+set_tests_properties(SetTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;11;add_test;/root/repo/Tests/CMakeLists.txt;38;add_simple_test;/root/repo/Tests/CMakeLists.txt;0;")
+add_test(SimplexTests "/root/repo/_release_build/bin/SimplexTests")
+set_tests_properties(SimplexTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;11;add_test;/root/repo/Tests/CMakeLists.txt;39;add_simple_test;/root/repo/Tests/CMakeLists.txt;0;")
+add_test(SphereTests "/root/repo/_release_build/bin/SphereTests")
+set_tests_properties(SphereTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;11;add_test;/root/repo/Tests/CMakeLists.txt;40;add_simple_test;/root/repo/Tests/CMakeLists.txt;0;")
+add_test(SurfaceTests "/root/repo/_release_build/bin/SurfaceTests")
+set_tests_properties(SurfaceTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;11;add_test;/root/repo/Tests/CMakeLists.txt;41;add_simple_test;/root/repo/Tests/CMakeLists.txt;0;")
+add_test(VectorTests "/root/repo/_release_build/bin/VectorTests")
+set_tests_properties(VectorTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;11;add_test;/root/repo/Tests/CMakeLists.txt;42;add_simple_test;/root/repo/Tests/CMakeLists.txt;0;")